@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "EventReader.hpp"
+
+
+EventReader::EventReader(int fd, bool nonblocking, size_t read_bytes)
+    : fd(fd), read_bytes(std::max<size_t>(read_bytes, 4096)), buffer(this->read_bytes)
+{
+    if (nonblocking) {
+        int flags = fcntl(fd, F_GETFL);
+        if (flags < 0)
+            throw std::runtime_error(std::string("EventReader: fcntl(): ") + strerror(errno));
+        if (!(flags & O_NONBLOCK)) {
+            if (fcntl(fd, F_SETFL, flags | O_NONBLOCK))
+                throw std::runtime_error(std::string("EventReader: fcntl(): ") + strerror(errno));
+            this->saved_flags = flags;
+        }
+    }
+}
+
+
+EventReader::~EventReader()
+{
+    if (this->saved_flags >= 0)
+        fcntl(this->fd, F_SETFL, this->saved_flags);
+}
+
+
+bool EventReader::read(Lansnoop::Event& event)
+{
+    while (!next(event))
+        if (!fill()) {
+            if (this->at_eof && this->end != this->begin)
+                throw std::runtime_error("EventReader: input ended partway through an event");
+            return false;
+        }
+    return true;
+}
+
+
+bool EventReader::next(Lansnoop::Event& event)
+{
+    //  Same framing as operator>>(std::istream&, Lansnoop::Event&).
+    size_t available = this->end - this->begin;
+    if (available < sizeof(uint32_t)) {
+        this->wanted = sizeof(uint32_t);
+        return false;
+    }
+    uint32_t serialized_length;
+    memcpy(&serialized_length, &this->buffer[this->begin], sizeof(serialized_length));
+    size_t length = ntohl(serialized_length);
+    if (length > max_event_bytes)
+        throw std::runtime_error("EventReader: event length " + std::to_string(length) + " is too large");
+    this->wanted = sizeof(uint32_t) + length;
+    if (available < this->wanted)
+        return false;
+
+    if (!event.ParseFromArray(&this->buffer[this->begin + sizeof(uint32_t)], length))
+        throw std::runtime_error("EventReader: failed deserializing event");
+    this->begin += this->wanted;
+    this->stats.events++;
+    return true;
+}
+
+
+bool EventReader::fill()
+{
+    if (this->at_eof)
+        return false;
+
+    //  Move what's left of the last read to the front, and grow the buffer
+    //  if even then the next event wouldn't fit.
+    if (this->begin) {
+        std::copy(this->buffer.begin() + this->begin, this->buffer.begin() + this->end, this->buffer.begin());
+        this->end -= this->begin;
+        this->begin = 0;
+    }
+    if (this->buffer.size() < this->wanted)
+        this->buffer.resize(this->wanted);
+    if (this->end == this->buffer.size())
+        return false;  //  A whole event is waiting for next().
+
+    for (;;) {
+        ssize_t n = ::read(this->fd, &this->buffer[this->end], this->buffer.size() - this->end);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return false;
+            throw std::runtime_error(std::string("EventReader: read(): ") + strerror(errno));
+        }
+        if (n == 0) {
+            this->at_eof = true;
+            return false;
+        }
+        this->end += n;
+        this->stats.bytes += n;
+        this->stats.reads++;
+        return true;
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "event.pb.h"
+
+
+//  Reads framed events (see EventSerialization.cpp) from a file descriptor.
+//
+//  Input is read in large chunks into a reusable buffer, and each event is
+//  parsed in place, straight from the buffer, into an Event the caller
+//  reuses.  Once the buffer has grown to hold the largest event, reading
+//  allocates nothing but what parsing the events themselves needs.
+//
+//  If :nonblocking:, the descriptor is made nonblocking, and read() returns
+//  false when no whole event has arrived yet, keeping any part of one for
+//  the next call.  A render loop that mustn't stall can instead call
+//  fill() once per frame, then next() until it returns false, so as not to
+//  chase a writer that's always a little ahead.
+//
+class EventReader
+{
+public:
+    struct Stats {
+        long events = 0;
+        long bytes = 0;
+        long reads = 0;  // Successful read() calls.
+    };
+
+    static constexpr size_t default_read_bytes = 1024 * 1024;
+    //  Larger length fields are taken for corrupt input.
+    static constexpr size_t max_event_bytes = 64 * 1024 * 1024;
+
+    explicit EventReader(int fd, bool nonblocking = false, size_t read_bytes = default_read_bytes);
+    ~EventReader();
+    EventReader(const EventReader&) = delete;
+    EventReader& operator=(const EventReader&) = delete;
+
+    //  Read the next event into :event:.  Returns false at the end of the
+    //  input or, if nonblocking, if no whole event is available yet.
+    //  Throws on errors, and on input ending partway through an event.
+    bool read(Lansnoop::Event& event);
+
+    //  Parse the next event already read into :event:, without reading
+    //  more.  Returns false if no whole event has been read.
+    bool next(Lansnoop::Event& event);
+    //  Read what input is available, at most about a chunk.  Returns
+    //  whether anything was read.  Blocks only if the descriptor does.
+    bool fill();
+
+    //  Whether the input has ended.  Always false until a read finds so.
+    bool eof() const { return this->at_eof; }
+
+    int get_fd() const { return this->fd; }
+    const Stats& get_stats() const { return this->stats; }
+
+private:
+    int fd;
+    int saved_flags = -1;  // The descriptor's flags, if we changed them.
+    size_t read_bytes;
+    bool at_eof = false;
+
+    //  Bytes [begin, end) are read but not yet parsed.
+    std::vector<char> buffer;
+    size_t begin = 0;
+    size_t end = 0;
+    size_t wanted = sizeof(uint32_t);  //  Unparsed bytes needed for the next event.
+    Stats stats;
+};
@@ -0,0 +1,131 @@
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "EventWriter.hpp"
+
+
+EventWriter::EventWriter(int fd, long flush_usec, size_t flush_bytes)
+    : fd(fd), flush_bytes(flush_bytes)
+{
+    set_flush_usec(flush_usec);
+    this->buffer.reserve(flush_bytes + 4096);
+
+    //  Only pipes and sockets can have a slow reader on the other end.
+    //  Leave files and terminals alone.  A terminal's descriptor is usually
+    //  shared with stderr, which shouldn't become nonblocking.  Nor should
+    //  a pipe that stderr was redirected into (2>&1): O_NONBLOCK belongs to
+    //  the open pipe, not the descriptor, and stderr's writers don't retry.
+    struct stat st, err_st;
+    bool shared_with_stderr = fd != 2 && !fstat(2, &err_st) && !fstat(fd, &st)
+        && st.st_dev == err_st.st_dev && st.st_ino == err_st.st_ino;
+    if (!shared_with_stderr && !fstat(fd, &st) && (S_ISFIFO(st.st_mode) || S_ISSOCK(st.st_mode))) {
+        int flags = fcntl(fd, F_GETFL);
+        if (flags >= 0 && !(flags & O_NONBLOCK) && !fcntl(fd, F_SETFL, flags | O_NONBLOCK))
+            this->saved_flags = flags;
+    }
+}
+
+
+EventWriter::~EventWriter()
+{
+    try {
+        flush();
+    }
+    catch (...) {
+        //  The reader has gone away.  Nothing more to do.
+    }
+    if (this->saved_flags >= 0)
+        fcntl(this->fd, F_SETFL, this->saved_flags);
+}
+
+
+void EventWriter::set_flush_usec(long usec)
+{
+    if (usec < 0)
+        throw std::invalid_argument("EventWriter: flush latency can't be negative");
+    this->flush_latency = std::chrono::microseconds(usec);
+}
+
+
+void EventWriter::write(const Lansnoop::Event& event)
+{
+    //  Same framing as operator<<(std::ostream&, const Lansnoop::Event&).
+    size_t length = event.ByteSizeLong();
+    if (!this->buffered())
+        this->deadline = Clock::now() + this->flush_latency;
+    size_t offset = this->buffer.size();
+    this->buffer.resize(offset + sizeof(uint32_t) + length);
+    uint32_t serialized_length = htonl(length);
+    memcpy(&this->buffer[offset], &serialized_length, sizeof(serialized_length));
+    event.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(&this->buffer[offset + sizeof(serialized_length)]));
+    this->stats.events++;
+
+    if (this->buffered() >= this->flush_bytes || this->flush_latency == Clock::duration::zero())
+        write_some();
+    else
+        poll();
+
+    if (this->buffered() >= max_buffered_bytes) {
+        this->stats.stalls++;
+        flush();
+    }
+}
+
+
+void EventWriter::poll()
+{
+    if (this->buffered() && Clock::now() >= this->deadline)
+        write_some();
+}
+
+
+void EventWriter::write_some()
+{
+    while (this->buffered()) {
+        ssize_t n = ::write(this->fd, &this->buffer[this->begin], this->buffered());
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                //  The reader is behind.  Try again after another flush interval.
+                this->deadline = Clock::now() + this->flush_latency;
+                break;
+            }
+            throw std::runtime_error(std::string("EventWriter: write(): ") + strerror(errno));
+        }
+        this->begin += n;
+        this->stats.bytes += n;
+        this->stats.writes++;
+    }
+
+    if (!this->buffered()) {
+        this->buffer.clear();
+        this->begin = 0;
+    }
+    else if (this->begin >= this->buffer.size() / 2) {
+        //  Reclaim the space already written.
+        this->buffer.erase(this->buffer.begin(), this->buffer.begin() + this->begin);
+        this->begin = 0;
+    }
+}
+
+
+void EventWriter::flush()
+{
+    for (;;) {
+        write_some();
+        if (!this->buffered())
+            return;
+        struct pollfd pfd { this->fd, POLLOUT, 0 };
+        if (::poll(&pfd, 1, -1) < 0 && errno != EINTR)
+            throw std::runtime_error(std::string("EventWriter: poll(): ") + strerror(errno));
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "event.pb.h"
+
+
+//  Writes framed events (see EventSerialization.cpp) to a file descriptor.
+//
+//  Events are serialized straight into a reusable buffer, which is written
+//  out once it holds :flush_bytes:, or once the oldest buffered event is
+//  :flush_usec: microseconds old.  So a burst of events costs one system
+//  call rather than one each.
+//
+//  If the descriptor is a pipe or socket it's made nonblocking, and a
+//  reader that falls behind doesn't stall the writer until
+//  :max_buffered_bytes: are waiting.  No events are ever dropped.  Its
+//  flags are restored on destruction.  A pipe that stderr also writes to
+//  is left blocking, since stderr would share its nonblocking mode.
+//
+class EventWriter
+{
+public:
+    struct Stats {
+        long events = 0;
+        long bytes = 0;
+        long writes = 0;  // Successful write() calls.
+        long stalls = 0;  // Times the buffer was full and we had to wait for the reader.
+    };
+
+    static constexpr long default_flush_usec = 2000;
+    static constexpr size_t default_flush_bytes = 64 * 1024;
+    static constexpr size_t max_buffered_bytes = 16 * 1024 * 1024;
+
+    //  A :flush_usec: of 0 writes out each event as soon as it's written.
+    explicit EventWriter(int fd, long flush_usec = default_flush_usec, size_t flush_bytes = default_flush_bytes);
+    ~EventWriter();
+    EventWriter(const EventWriter&) = delete;
+    EventWriter& operator=(const EventWriter&) = delete;
+
+    void write(const Lansnoop::Event& event);
+
+    //  Write out buffered events if the latency deadline has passed.
+    //  Call regularly, even when there are no new events.
+    void poll();
+
+    //  Write out all buffered events, waiting for the reader if necessary.
+    void flush();
+
+    void set_flush_usec(long usec);
+
+    const Stats& get_stats() const { return this->stats; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    int fd;
+    int saved_flags = -1;  // The descriptor's flags, if we changed them.
+    Clock::duration flush_latency;
+    size_t flush_bytes;
+
+    //  Bytes [begin, buffer.size()) are yet to be written.
+    std::vector<char> buffer;
+    size_t begin = 0;
+    Clock::time_point deadline;
+    Stats stats;
+
+    size_t buffered() const { return this->buffer.size() - this->begin; }
+
+    //  Write as much as the descriptor will take without blocking.
+    void write_some();
+};
@@ -1,19 +1,28 @@
+#include <chrono>
 #include <iostream>
+#include <map>
+#include <set>
 #include <iomanip>
-#include <fstream>
 #include <string>
 #include <cstring>
 #include <stdexcept>
 #include <time.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "event.pb.h"
-#include "EventSerialization.hpp"
+#include "EventReader.hpp"
 
 
 static void print(const Lansnoop::Network& network)
 {
     std::cout << "    " << "id:         " << network.id() << "\n";
     std::cout << "    " << "fini:       " << (network.fini()?"true":"false") << "\n";
+    if (network.merged_into())
+        std::cout << "    " << "merged_into: " << network.merged_into() << "\n";
+    if (network.vlan())
+        std::cout << "    " << "vlan:       " << network.vlan() << "\n";
 }
 
 
@@ -41,14 +50,21 @@ static void print(const Lansnoop::IPAddress& ip_address)
     std::cout << "    " << "id:         " << ip_address.id() << "\n";
     std::cout << "    " << "fini:       " << (ip_address.fini()?"true":"false") << "\n";
     std::cout << "    " << "address:    ";
-    bool first = true;
-    for (unsigned char c : ip_address.address()) {
-        if (first)
-            first = false;
-        else
-            std::cout << ".";
-        std::cout << int(c);
-    } //  TODO: format for IPv6 when needed.
+    if (ip_address.address().size() == 16) {
+        char text[INET6_ADDRSTRLEN];
+        inet_ntop(AF_INET6, ip_address.address().data(), text, sizeof(text));
+        std::cout << text;
+    }
+    else {
+        bool first = true;
+        for (unsigned char c : ip_address.address()) {
+            if (first)
+                first = false;
+            else
+                std::cout << ".";
+            std::cout << int(c);
+        }
+    }
     std::cout << "\n";
     switch (ip_address.attached_to_case()) {
         case Lansnoop::IPAddress::kInterfaceId:
@@ -82,27 +98,168 @@ static void print(const Lansnoop::Cloud& cloud)
 }
 
 
+static void print(const Lansnoop::Resolver& resolver)
+{
+    std::cout << "    " << "id:           " << resolver.id() << "\n";
+    std::cout << "    " << "fini:         " << (resolver.fini()?"true":"false") << "\n";
+    std::cout << "    " << "ipaddress_id: " << resolver.ipaddress_id() << "\n";
+    std::cout << "    " << "latency counts:\n";
+    for (int i = 0; i < resolver.latency_counts_size(); ++i) {
+        if (!resolver.latency_counts(i))
+            continue;
+        std::cout << "                ";
+        if (i == 0)
+            std::cout << "<1ms";
+        else if (i == resolver.latency_counts_size() - 1)
+            std::cout << ">=" << (1L << (i - 1)) << "ms";
+        else
+            std::cout << (1L << (i - 1)) << "-" << (1L << i) << "ms";
+        std::cout << " => " << resolver.latency_counts(i) << "\n";
+    }
+    std::cout << "    " << "latency_sum_usec: " << resolver.latency_sum_usec() << "\n";
+    std::cout << "    " << "timeouts:     " << resolver.timeouts() << "\n";
+}
+
+
+static void print(const Lansnoop::ConnectionCounts& counts)
+{
+    std::cout << "a " << counts.a_packets() << " packets " << counts.a_bytes() << " bytes, "
+              << "b " << counts.b_packets() << " packets " << counts.b_bytes() << " bytes";
+}
+
+
+static void print(const Lansnoop::Connection& connection)
+{
+    std::cout << "    " << "id:         " << connection.id() << "\n";
+    std::cout << "    " << "fini:       " << (connection.fini()?"true":"false") << "\n";
+    std::cout << "    " << "protocol:   " << Lansnoop::Connection::Protocol_Name(connection.protocol()) << "\n";
+    std::cout << "    " << "a:          " << connection.ipaddress_a_id() << " port " << connection.port_a() << "\n";
+    std::cout << "    " << "b:          " << connection.ipaddress_b_id() << " port " << connection.port_b() << "\n";
+    if (!connection.description().empty())
+        std::cout << "    " << "description: " << connection.description() << "\n";
+    if (connection.fini()) {
+        std::cout << "    " << "established: " << (connection.established()?"true":"false") << "\n";
+        std::cout << "    " << "end:        " << Lansnoop::Connection::End_Name(connection.end()) << "\n";
+        std::cout << "    " << "counts:     ";
+        print(connection.counts());
+        std::cout << "\n";
+    }
+}
+
+
+static void print(const Lansnoop::Rate& rate)
+{
+    std::cout << rate.packets_per_second() << " packets/s " << rate.bits_per_second() << " bits/s";
+}
+
+
+//  Print one kind of object's counts and rates, ordered by ID.
+template<class Counts, class Rates>
+static void print(const char* name, const Counts& packet_counts, const Counts& byte_counts, const Rates& rates)
+{
+    std::set<long> keys;
+    for (const auto& e : packet_counts)
+        keys.insert(e.first);
+    std::cout << "    " << name << " counts:\n";
+    for (long id : keys) {
+        std::cout << "                " << id << " => " << packet_counts.at(id);
+        if (byte_counts.count(id))
+            std::cout << " packets " << byte_counts.at(id) << " bytes";
+        if (rates.count(id)) {
+            std::cout << ", ";
+            print(rates.at(id));
+        }
+        std::cout << "\n";
+    }
+}
+
+
+//  Whole counts by object ID, kept by adding up the increases in
+//  compact Traffic messages.
+struct TrafficTotals {
+    std::map<long, uint64_t> packets;
+    std::map<long, uint64_t> bytes;
+};
+
+
+//  Print one kind of object's compact traffic as whole counts and
+//  rates, as print() above prints the map form.
+static void print(const char* name, const Lansnoop::TrafficDeltas& deltas, TrafficTotals& totals)
+{
+    std::set<long> keys;
+    long id = 0;
+    for (int i=0; i<deltas.ids_size(); ++i) {
+        id += deltas.ids(i);
+        keys.insert(id);
+        totals.packets[id] += deltas.packets(i);
+        totals.bytes[id] += deltas.bytes(i);
+    }
+    std::map<long, Lansnoop::Rate> rates;
+    id = 0;
+    for (int i=0; i<deltas.rate_ids_size(); ++i) {
+        id += deltas.rate_ids(i);
+        keys.insert(id);
+        rates[id].set_packets_per_second(deltas.packets_per_second(i));
+        rates[id].set_bits_per_second(deltas.bits_per_second(i));
+    }
+
+    std::cout << "    " << name << " counts:\n";
+    for (long id : keys) {
+        std::cout << "                " << id << " => " << totals.packets[id]
+                  << " packets " << totals.bytes[id] << " bytes";
+        if (rates.count(id)) {
+            std::cout << ", ";
+            print(rates.at(id));
+        }
+        std::cout << "\n";
+    }
+}
+
+
 static void print(const Lansnoop::Traffic& traffic)
 {
-    std::set<long> interface_keys;
-    for (const auto& e : traffic.interface_packet_counts())
-        interface_keys.insert(e.first);
-    std::set<long> cloud_keys;
-    for (const auto& e : traffic.cloud_packet_counts())
-        cloud_keys.insert(e.first);
-    std::set<long> ipaddress_keys;
-    for (const auto& e : traffic.ipaddress_packet_counts())
-        ipaddress_keys.insert(e.first);
-
-    std::cout << "    " << "interface counts:\n";
-    for (long id : interface_keys)
-        std::cout << "                " << id << " => " << traffic.interface_packet_counts().at(id) << "\n";
-    std::cout << "    " << "cloud counts:\n";
-    for (long id : cloud_keys)
-        std::cout << "                " << id << " => " << traffic.cloud_packet_counts().at(id) << "\n";
-    std::cout << "    " << "ipaddress counts:\n";
-    for (long id : ipaddress_keys)
-        std::cout << "                " << id << " => " << traffic.ipaddress_packet_counts().at(id) << "\n";
+    if (traffic.has_interfaces()) {
+        static TrafficTotals interface_totals, cloud_totals, ipaddress_totals, vlan_totals;
+        print("interface", traffic.interfaces(), interface_totals);
+        print("cloud", traffic.clouds(), cloud_totals);
+        print("ipaddress", traffic.ipaddresses(), ipaddress_totals);
+        if (traffic.has_connections()) {
+            const Lansnoop::ConnectionCountArrays& counts = traffic.connections();
+            std::cout << "    " << "connection counts:\n";
+            long id = 0;
+            for (int i=0; i<counts.ids_size(); ++i) {
+                id += counts.ids(i);
+                Lansnoop::ConnectionCounts c;
+                c.set_a_packets(counts.a_packets(i));
+                c.set_b_packets(counts.b_packets(i));
+                c.set_a_bytes(counts.a_bytes(i));
+                c.set_b_bytes(counts.b_bytes(i));
+                std::cout << "                " << id << " => ";
+                print(c);
+                std::cout << "\n";
+            }
+        }
+        if (traffic.has_vlans())
+            print("vlan", traffic.vlans(), vlan_totals);
+        return;
+    }
+
+    print("interface", traffic.interface_packet_counts(), traffic.interface_byte_counts(), traffic.interface_rates());
+    print("cloud", traffic.cloud_packet_counts(), traffic.cloud_byte_counts(), traffic.cloud_rates());
+    print("ipaddress", traffic.ipaddress_packet_counts(), traffic.ipaddress_byte_counts(), traffic.ipaddress_rates());
+    if (traffic.connection_counts().size()) {
+        std::set<long> connection_keys;
+        for (const auto& e : traffic.connection_counts())
+            connection_keys.insert(e.first);
+        std::cout << "    " << "connection counts:\n";
+        for (long id : connection_keys) {
+            std::cout << "                " << id << " => ";
+            print(traffic.connection_counts().at(id));
+            std::cout << "\n";
+        }
+    }
+    if (traffic.vlan_packet_counts().size())
+        print("vlan", traffic.vlan_packet_counts(), traffic.vlan_byte_counts(), traffic.vlan_rates());
 }
 
 
@@ -124,6 +281,12 @@ static void print(const Lansnoop::Event& event)
         case Lansnoop::Event::kCloud:
             std::cout << "Cloud\n";
             break;
+        case Lansnoop::Event::kResolver:
+            std::cout << "Resolver\n";
+            break;
+        case Lansnoop::Event::kConnection:
+            std::cout << "Connection\n";
+            break;
         case Lansnoop::Event::TYPE_NOT_SET:
         // default:
             std::cout << "[bad event]\n";
@@ -146,6 +309,12 @@ static void print(const Lansnoop::Event& event)
         case Lansnoop::Event::kCloud:
             print(event.cloud());
             break;
+        case Lansnoop::Event::kResolver:
+            print(event.resolver());
+            break;
+        case Lansnoop::Event::kConnection:
+            print(event.connection());
+            break;
         case Lansnoop::Event::TYPE_NOT_SET:
         // default:
             break;
@@ -163,19 +332,33 @@ static void print(const Lansnoop::Event& event)
 }
 
 
-static void run(const std::string& path)
+static void run(const std::string& path, bool count_only)
 {
-    std::ifstream in(path, std::ifstream::binary);
-    if (!in.good())
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
         throw std::invalid_argument("unable to open input path");
+    EventReader reader(fd);
 
-    int count = 0;
+    long count = 0;
     Lansnoop::Event event;
-    while (in >> event) {
+    auto t0 = std::chrono::steady_clock::now();
+    while (reader.read(event)) {
+        if (count_only) {
+            ++count;
+            continue;
+        }
         if (count++)
             std::cout << "\n";
         print(event);
     }
+    close(fd);
+
+    if (count_only) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        const EventReader::Stats& stats = reader.get_stats();
+        std::cout << count << " events, " << stats.bytes << " bytes in " << seconds << " s, "
+                  << count / seconds << " events/s, " << stats.bytes / seconds / 1e6 << " MB/s\n";
+    }
 }
 
 
@@ -184,13 +367,20 @@ int main(int argc, char **argv)
     int ret = 0;
     try {
         std::string path = "/dev/stdin";
+        bool count_only = false;
 
         int i = 1;
         while (i < argc) {
-            path = argv[i++];
+            if (std::string("--count") == argv[i]) {
+                //  Decode without printing, and report the rate.
+                ++i;
+                count_only = true;
+            }
+            else
+                path = argv[i++];
         }
 
-        run(path);
+        run(path, count_only);
     }
     catch (const std::exception& e) {
         std::cerr << argv[0] << ": " << e.what() << std::endl;
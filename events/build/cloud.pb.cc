@@ -0,0 +1,464 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cloud.proto
+
+#include "cloud.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Lansnoop {
+PROTOBUF_CONSTEXPR Cloud::Cloud(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.fini_)*/false
+  , /*decltype(_impl_.attached_to_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct CloudDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CloudDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CloudDefaultTypeInternal() {}
+  union {
+    Cloud _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CloudDefaultTypeInternal _Cloud_default_instance_;
+}  // namespace Lansnoop
+static ::_pb::Metadata file_level_metadata_cloud_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_cloud_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_cloud_2eproto = nullptr;
+
+const uint32_t TableStruct_cloud_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Cloud, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Cloud, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Cloud, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Cloud, _impl_.fini_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Cloud, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Cloud, _impl_.attached_to_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Lansnoop::Cloud)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Lansnoop::_Cloud_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_cloud_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013cloud.proto\022\010Lansnoop\"q\n\005Cloud\022\n\n\002id\030\001"
+  " \001(\r\022\014\n\004fini\030\002 \001(\010\022\026\n\014interface_id\030\003 \001(\r"
+  "H\000\022\022\n\010cloud_id\030\004 \001(\rH\000\022\023\n\013description\030\005 "
+  "\001(\tB\r\n\013attached_tob\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_cloud_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_cloud_2eproto = {
+    false, false, 146, descriptor_table_protodef_cloud_2eproto,
+    "cloud.proto",
+    &descriptor_table_cloud_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_cloud_2eproto::offsets,
+    file_level_metadata_cloud_2eproto, file_level_enum_descriptors_cloud_2eproto,
+    file_level_service_descriptors_cloud_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_cloud_2eproto_getter() {
+  return &descriptor_table_cloud_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_cloud_2eproto(&descriptor_table_cloud_2eproto);
+namespace Lansnoop {
+
+// ===================================================================
+
+class Cloud::_Internal {
+ public:
+};
+
+Cloud::Cloud(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.Cloud)
+}
+Cloud::Cloud(const Cloud& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Cloud* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.fini_){}
+    , decltype(_impl_.attached_to_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_description().empty()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fini_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.fini_));
+  clear_has_attached_to();
+  switch (from.attached_to_case()) {
+    case kInterfaceId: {
+      _this->_internal_set_interface_id(from._internal_interface_id());
+      break;
+    }
+    case kCloudId: {
+      _this->_internal_set_cloud_id(from._internal_cloud_id());
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.Cloud)
+}
+
+inline void Cloud::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.fini_){false}
+    , decltype(_impl_.attached_to_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_attached_to();
+}
+
+Cloud::~Cloud() {
+  // @@protoc_insertion_point(destructor:Lansnoop.Cloud)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Cloud::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.description_.Destroy();
+  if (has_attached_to()) {
+    clear_attached_to();
+  }
+}
+
+void Cloud::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Cloud::clear_attached_to() {
+// @@protoc_insertion_point(one_of_clear_start:Lansnoop.Cloud)
+  switch (attached_to_case()) {
+    case kInterfaceId: {
+      // No need to clear
+      break;
+    }
+    case kCloudId: {
+      // No need to clear
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = ATTACHED_TO_NOT_SET;
+}
+
+
+void Cloud::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.Cloud)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.description_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.fini_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.fini_));
+  clear_attached_to();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Cloud::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool fini = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.fini_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 interface_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _internal_set_interface_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cloud_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _internal_set_cloud_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string description = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Lansnoop.Cloud.description"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Cloud::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.Cloud)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_fini(), target);
+  }
+
+  // uint32 interface_id = 3;
+  if (_internal_has_interface_id()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_interface_id(), target);
+  }
+
+  // uint32 cloud_id = 4;
+  if (_internal_has_cloud_id()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_cloud_id(), target);
+  }
+
+  // string description = 5;
+  if (!this->_internal_description().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Lansnoop.Cloud.description");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_description(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.Cloud)
+  return target;
+}
+
+size_t Cloud::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.Cloud)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string description = 5;
+  if (!this->_internal_description().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_description());
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    total_size += 1 + 1;
+  }
+
+  switch (attached_to_case()) {
+    // uint32 interface_id = 3;
+    case kInterfaceId: {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_interface_id());
+      break;
+    }
+    // uint32 cloud_id = 4;
+    case kCloudId: {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cloud_id());
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Cloud::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Cloud::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Cloud::GetClassData() const { return &_class_data_; }
+
+
+void Cloud::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Cloud*>(&to_msg);
+  auto& from = static_cast<const Cloud&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.Cloud)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_fini() != 0) {
+    _this->_internal_set_fini(from._internal_fini());
+  }
+  switch (from.attached_to_case()) {
+    case kInterfaceId: {
+      _this->_internal_set_interface_id(from._internal_interface_id());
+      break;
+    }
+    case kCloudId: {
+      _this->_internal_set_cloud_id(from._internal_cloud_id());
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Cloud::CopyFrom(const Cloud& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.Cloud)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Cloud::IsInitialized() const {
+  return true;
+}
+
+void Cloud::InternalSwap(Cloud* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Cloud, _impl_.fini_)
+      + sizeof(Cloud::_impl_.fini_)
+      - PROTOBUF_FIELD_OFFSET(Cloud, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+  swap(_impl_.attached_to_, other->_impl_.attached_to_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Cloud::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_cloud_2eproto_getter, &descriptor_table_cloud_2eproto_once,
+      file_level_metadata_cloud_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Lansnoop::Cloud*
+Arena::CreateMaybeMessage< ::Lansnoop::Cloud >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Cloud >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,478 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: cloud.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_cloud_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_cloud_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_cloud_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_cloud_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_cloud_2eproto;
+namespace Lansnoop {
+class Cloud;
+struct CloudDefaultTypeInternal;
+extern CloudDefaultTypeInternal _Cloud_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::Cloud* Arena::CreateMaybeMessage<::Lansnoop::Cloud>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+// ===================================================================
+
+class Cloud final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Cloud) */ {
+ public:
+  inline Cloud() : Cloud(nullptr) {}
+  ~Cloud() override;
+  explicit PROTOBUF_CONSTEXPR Cloud(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Cloud(const Cloud& from);
+  Cloud(Cloud&& from) noexcept
+    : Cloud() {
+    *this = ::std::move(from);
+  }
+
+  inline Cloud& operator=(const Cloud& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Cloud& operator=(Cloud&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Cloud& default_instance() {
+    return *internal_default_instance();
+  }
+  enum AttachedToCase {
+    kInterfaceId = 3,
+    kCloudId = 4,
+    ATTACHED_TO_NOT_SET = 0,
+  };
+
+  static inline const Cloud* internal_default_instance() {
+    return reinterpret_cast<const Cloud*>(
+               &_Cloud_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Cloud& a, Cloud& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Cloud* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Cloud* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Cloud* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Cloud>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Cloud& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Cloud& from) {
+    Cloud::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Cloud* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Cloud";
+  }
+  protected:
+  explicit Cloud(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDescriptionFieldNumber = 5,
+    kIdFieldNumber = 1,
+    kFiniFieldNumber = 2,
+    kInterfaceIdFieldNumber = 3,
+    kCloudIdFieldNumber = 4,
+  };
+  // string description = 5;
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // bool fini = 2;
+  void clear_fini();
+  bool fini() const;
+  void set_fini(bool value);
+  private:
+  bool _internal_fini() const;
+  void _internal_set_fini(bool value);
+  public:
+
+  // uint32 interface_id = 3;
+  bool has_interface_id() const;
+  private:
+  bool _internal_has_interface_id() const;
+  public:
+  void clear_interface_id();
+  uint32_t interface_id() const;
+  void set_interface_id(uint32_t value);
+  private:
+  uint32_t _internal_interface_id() const;
+  void _internal_set_interface_id(uint32_t value);
+  public:
+
+  // uint32 cloud_id = 4;
+  bool has_cloud_id() const;
+  private:
+  bool _internal_has_cloud_id() const;
+  public:
+  void clear_cloud_id();
+  uint32_t cloud_id() const;
+  void set_cloud_id(uint32_t value);
+  private:
+  uint32_t _internal_cloud_id() const;
+  void _internal_set_cloud_id(uint32_t value);
+  public:
+
+  void clear_attached_to();
+  AttachedToCase attached_to_case() const;
+  // @@protoc_insertion_point(class_scope:Lansnoop.Cloud)
+ private:
+  class _Internal;
+  void set_has_interface_id();
+  void set_has_cloud_id();
+
+  inline bool has_attached_to() const;
+  inline void clear_has_attached_to();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    uint32_t id_;
+    bool fini_;
+    union AttachedToUnion {
+      constexpr AttachedToUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      uint32_t interface_id_;
+      uint32_t cloud_id_;
+    } attached_to_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_cloud_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Cloud
+
+// uint32 id = 1;
+inline void Cloud::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t Cloud::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Cloud::id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Cloud.id)
+  return _internal_id();
+}
+inline void Cloud::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Cloud::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Cloud.id)
+}
+
+// bool fini = 2;
+inline void Cloud::clear_fini() {
+  _impl_.fini_ = false;
+}
+inline bool Cloud::_internal_fini() const {
+  return _impl_.fini_;
+}
+inline bool Cloud::fini() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Cloud.fini)
+  return _internal_fini();
+}
+inline void Cloud::_internal_set_fini(bool value) {
+  
+  _impl_.fini_ = value;
+}
+inline void Cloud::set_fini(bool value) {
+  _internal_set_fini(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Cloud.fini)
+}
+
+// uint32 interface_id = 3;
+inline bool Cloud::_internal_has_interface_id() const {
+  return attached_to_case() == kInterfaceId;
+}
+inline bool Cloud::has_interface_id() const {
+  return _internal_has_interface_id();
+}
+inline void Cloud::set_has_interface_id() {
+  _impl_._oneof_case_[0] = kInterfaceId;
+}
+inline void Cloud::clear_interface_id() {
+  if (_internal_has_interface_id()) {
+    _impl_.attached_to_.interface_id_ = 0u;
+    clear_has_attached_to();
+  }
+}
+inline uint32_t Cloud::_internal_interface_id() const {
+  if (_internal_has_interface_id()) {
+    return _impl_.attached_to_.interface_id_;
+  }
+  return 0u;
+}
+inline void Cloud::_internal_set_interface_id(uint32_t value) {
+  if (!_internal_has_interface_id()) {
+    clear_attached_to();
+    set_has_interface_id();
+  }
+  _impl_.attached_to_.interface_id_ = value;
+}
+inline uint32_t Cloud::interface_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Cloud.interface_id)
+  return _internal_interface_id();
+}
+inline void Cloud::set_interface_id(uint32_t value) {
+  _internal_set_interface_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Cloud.interface_id)
+}
+
+// uint32 cloud_id = 4;
+inline bool Cloud::_internal_has_cloud_id() const {
+  return attached_to_case() == kCloudId;
+}
+inline bool Cloud::has_cloud_id() const {
+  return _internal_has_cloud_id();
+}
+inline void Cloud::set_has_cloud_id() {
+  _impl_._oneof_case_[0] = kCloudId;
+}
+inline void Cloud::clear_cloud_id() {
+  if (_internal_has_cloud_id()) {
+    _impl_.attached_to_.cloud_id_ = 0u;
+    clear_has_attached_to();
+  }
+}
+inline uint32_t Cloud::_internal_cloud_id() const {
+  if (_internal_has_cloud_id()) {
+    return _impl_.attached_to_.cloud_id_;
+  }
+  return 0u;
+}
+inline void Cloud::_internal_set_cloud_id(uint32_t value) {
+  if (!_internal_has_cloud_id()) {
+    clear_attached_to();
+    set_has_cloud_id();
+  }
+  _impl_.attached_to_.cloud_id_ = value;
+}
+inline uint32_t Cloud::cloud_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Cloud.cloud_id)
+  return _internal_cloud_id();
+}
+inline void Cloud::set_cloud_id(uint32_t value) {
+  _internal_set_cloud_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Cloud.cloud_id)
+}
+
+// string description = 5;
+inline void Cloud::clear_description() {
+  _impl_.description_.ClearToEmpty();
+}
+inline const std::string& Cloud::description() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Cloud.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Cloud::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Lansnoop.Cloud.description)
+}
+inline std::string* Cloud::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Cloud.description)
+  return _s;
+}
+inline const std::string& Cloud::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void Cloud::_internal_set_description(const std::string& value) {
+  
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Cloud::_internal_mutable_description() {
+  
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Cloud::release_description() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Cloud.description)
+  return _impl_.description_.Release();
+}
+inline void Cloud::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Cloud.description)
+}
+
+inline bool Cloud::has_attached_to() const {
+  return attached_to_case() != ATTACHED_TO_NOT_SET;
+}
+inline void Cloud::clear_has_attached_to() {
+  _impl_._oneof_case_[0] = ATTACHED_TO_NOT_SET;
+}
+inline Cloud::AttachedToCase Cloud::attached_to_case() const {
+  return Cloud::AttachedToCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_cloud_2eproto
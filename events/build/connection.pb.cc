@@ -0,0 +1,941 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: connection.proto
+
+#include "connection.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Lansnoop {
+PROTOBUF_CONSTEXPR Connection::Connection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.counts_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.ipaddress_a_id_)*/0u
+  , /*decltype(_impl_.ipaddress_b_id_)*/0u
+  , /*decltype(_impl_.protocol_)*/0
+  , /*decltype(_impl_.fini_)*/false
+  , /*decltype(_impl_.established_)*/false
+  , /*decltype(_impl_.port_a_)*/0u
+  , /*decltype(_impl_.port_b_)*/0u
+  , /*decltype(_impl_.end_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConnectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConnectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConnectionDefaultTypeInternal() {}
+  union {
+    Connection _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConnectionDefaultTypeInternal _Connection_default_instance_;
+PROTOBUF_CONSTEXPR ConnectionCounts::ConnectionCounts(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.a_packets_)*/uint64_t{0u}
+  , /*decltype(_impl_.b_packets_)*/uint64_t{0u}
+  , /*decltype(_impl_.a_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.b_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConnectionCountsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConnectionCountsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConnectionCountsDefaultTypeInternal() {}
+  union {
+    ConnectionCounts _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConnectionCountsDefaultTypeInternal _ConnectionCounts_default_instance_;
+}  // namespace Lansnoop
+static ::_pb::Metadata file_level_metadata_connection_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_connection_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_connection_2eproto = nullptr;
+
+const uint32_t TableStruct_connection_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.fini_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.ipaddress_a_id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.ipaddress_b_id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.protocol_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.port_a_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.port_b_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.established_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Connection, _impl_.counts_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCounts, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCounts, _impl_.a_packets_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCounts, _impl_.b_packets_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCounts, _impl_.a_bytes_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCounts, _impl_.b_bytes_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Lansnoop::Connection)},
+  { 17, -1, -1, sizeof(::Lansnoop::ConnectionCounts)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Lansnoop::_Connection_default_instance_._instance,
+  &::Lansnoop::_ConnectionCounts_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_connection_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020connection.proto\022\010Lansnoop\"\214\003\n\nConnect"
+  "ion\022\n\n\002id\030\001 \001(\r\022\014\n\004fini\030\002 \001(\010\022\026\n\016ipaddre"
+  "ss_a_id\030\003 \001(\r\022\026\n\016ipaddress_b_id\030\004 \001(\r\022/\n"
+  "\010protocol\030\005 \001(\0162\035.Lansnoop.Connection.Pr"
+  "otocol\022\023\n\013description\030\006 \001(\t\022\016\n\006port_a\030\007 "
+  "\001(\r\022\016\n\006port_b\030\010 \001(\r\022\023\n\013established\030\t \001(\010"
+  "\022%\n\003end\030\n \001(\0162\030.Lansnoop.Connection.End\022"
+  "*\n\006counts\030\013 \001(\0132\032.Lansnoop.ConnectionCou"
+  "nts\"%\n\010Protocol\022\007\n\003UDP\020\000\022\007\n\003TCP\020\001\022\007\n\003DNS"
+  "\020\002\"\?\n\003End\022\r\n\tNOT_ENDED\020\000\022\n\n\006CLOSED\020\001\022\t\n\005"
+  "RESET\020\002\022\010\n\004IDLE\020\003\022\010\n\004SHED\020\004\"Z\n\020Connectio"
+  "nCounts\022\021\n\ta_packets\030\001 \001(\004\022\021\n\tb_packets\030"
+  "\002 \001(\004\022\017\n\007a_bytes\030\003 \001(\004\022\017\n\007b_bytes\030\004 \001(\004b"
+  "\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_connection_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_connection_2eproto = {
+    false, false, 527, descriptor_table_protodef_connection_2eproto,
+    "connection.proto",
+    &descriptor_table_connection_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_connection_2eproto::offsets,
+    file_level_metadata_connection_2eproto, file_level_enum_descriptors_connection_2eproto,
+    file_level_service_descriptors_connection_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_connection_2eproto_getter() {
+  return &descriptor_table_connection_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_connection_2eproto(&descriptor_table_connection_2eproto);
+namespace Lansnoop {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Connection_Protocol_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_connection_2eproto);
+  return file_level_enum_descriptors_connection_2eproto[0];
+}
+bool Connection_Protocol_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Connection_Protocol Connection::UDP;
+constexpr Connection_Protocol Connection::TCP;
+constexpr Connection_Protocol Connection::DNS;
+constexpr Connection_Protocol Connection::Protocol_MIN;
+constexpr Connection_Protocol Connection::Protocol_MAX;
+constexpr int Connection::Protocol_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Connection_End_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_connection_2eproto);
+  return file_level_enum_descriptors_connection_2eproto[1];
+}
+bool Connection_End_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Connection_End Connection::NOT_ENDED;
+constexpr Connection_End Connection::CLOSED;
+constexpr Connection_End Connection::RESET;
+constexpr Connection_End Connection::IDLE;
+constexpr Connection_End Connection::SHED;
+constexpr Connection_End Connection::End_MIN;
+constexpr Connection_End Connection::End_MAX;
+constexpr int Connection::End_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Connection::_Internal {
+ public:
+  static const ::Lansnoop::ConnectionCounts& counts(const Connection* msg);
+};
+
+const ::Lansnoop::ConnectionCounts&
+Connection::_Internal::counts(const Connection* msg) {
+  return *msg->_impl_.counts_;
+}
+Connection::Connection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.Connection)
+}
+Connection::Connection(const Connection& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Connection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.counts_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.ipaddress_a_id_){}
+    , decltype(_impl_.ipaddress_b_id_){}
+    , decltype(_impl_.protocol_){}
+    , decltype(_impl_.fini_){}
+    , decltype(_impl_.established_){}
+    , decltype(_impl_.port_a_){}
+    , decltype(_impl_.port_b_){}
+    , decltype(_impl_.end_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_description().empty()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_counts()) {
+    _this->_impl_.counts_ = new ::Lansnoop::ConnectionCounts(*from._impl_.counts_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.Connection)
+}
+
+inline void Connection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.counts_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.ipaddress_a_id_){0u}
+    , decltype(_impl_.ipaddress_b_id_){0u}
+    , decltype(_impl_.protocol_){0}
+    , decltype(_impl_.fini_){false}
+    , decltype(_impl_.established_){false}
+    , decltype(_impl_.port_a_){0u}
+    , decltype(_impl_.port_b_){0u}
+    , decltype(_impl_.end_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Connection::~Connection() {
+  // @@protoc_insertion_point(destructor:Lansnoop.Connection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Connection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.description_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.counts_;
+}
+
+void Connection::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Connection::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.Connection)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.description_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.counts_ != nullptr) {
+    delete _impl_.counts_;
+  }
+  _impl_.counts_ = nullptr;
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.end_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.end_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Connection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool fini = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.fini_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 ipaddress_a_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ipaddress_a_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 ipaddress_b_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.ipaddress_b_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Connection.Protocol protocol = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_protocol(static_cast<::Lansnoop::Connection_Protocol>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string description = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Lansnoop.Connection.description"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 port_a = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.port_a_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 port_b = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.port_b_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool established = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.established_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Connection.End end = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_end(static_cast<::Lansnoop::Connection_End>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.ConnectionCounts counts = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_counts(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Connection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.Connection)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_fini(), target);
+  }
+
+  // uint32 ipaddress_a_id = 3;
+  if (this->_internal_ipaddress_a_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_ipaddress_a_id(), target);
+  }
+
+  // uint32 ipaddress_b_id = 4;
+  if (this->_internal_ipaddress_b_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_ipaddress_b_id(), target);
+  }
+
+  // .Lansnoop.Connection.Protocol protocol = 5;
+  if (this->_internal_protocol() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_protocol(), target);
+  }
+
+  // string description = 6;
+  if (!this->_internal_description().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Lansnoop.Connection.description");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_description(), target);
+  }
+
+  // uint32 port_a = 7;
+  if (this->_internal_port_a() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_port_a(), target);
+  }
+
+  // uint32 port_b = 8;
+  if (this->_internal_port_b() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_port_b(), target);
+  }
+
+  // bool established = 9;
+  if (this->_internal_established() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_established(), target);
+  }
+
+  // .Lansnoop.Connection.End end = 10;
+  if (this->_internal_end() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      10, this->_internal_end(), target);
+  }
+
+  // .Lansnoop.ConnectionCounts counts = 11;
+  if (this->_internal_has_counts()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::counts(this),
+        _Internal::counts(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.Connection)
+  return target;
+}
+
+size_t Connection::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.Connection)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string description = 6;
+  if (!this->_internal_description().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_description());
+  }
+
+  // .Lansnoop.ConnectionCounts counts = 11;
+  if (this->_internal_has_counts()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.counts_);
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  // uint32 ipaddress_a_id = 3;
+  if (this->_internal_ipaddress_a_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ipaddress_a_id());
+  }
+
+  // uint32 ipaddress_b_id = 4;
+  if (this->_internal_ipaddress_b_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ipaddress_b_id());
+  }
+
+  // .Lansnoop.Connection.Protocol protocol = 5;
+  if (this->_internal_protocol() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_protocol());
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool established = 9;
+  if (this->_internal_established() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 port_a = 7;
+  if (this->_internal_port_a() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port_a());
+  }
+
+  // uint32 port_b = 8;
+  if (this->_internal_port_b() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port_b());
+  }
+
+  // .Lansnoop.Connection.End end = 10;
+  if (this->_internal_end() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_end());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Connection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Connection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Connection::GetClassData() const { return &_class_data_; }
+
+
+void Connection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Connection*>(&to_msg);
+  auto& from = static_cast<const Connection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.Connection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
+  }
+  if (from._internal_has_counts()) {
+    _this->_internal_mutable_counts()->::Lansnoop::ConnectionCounts::MergeFrom(
+        from._internal_counts());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_ipaddress_a_id() != 0) {
+    _this->_internal_set_ipaddress_a_id(from._internal_ipaddress_a_id());
+  }
+  if (from._internal_ipaddress_b_id() != 0) {
+    _this->_internal_set_ipaddress_b_id(from._internal_ipaddress_b_id());
+  }
+  if (from._internal_protocol() != 0) {
+    _this->_internal_set_protocol(from._internal_protocol());
+  }
+  if (from._internal_fini() != 0) {
+    _this->_internal_set_fini(from._internal_fini());
+  }
+  if (from._internal_established() != 0) {
+    _this->_internal_set_established(from._internal_established());
+  }
+  if (from._internal_port_a() != 0) {
+    _this->_internal_set_port_a(from._internal_port_a());
+  }
+  if (from._internal_port_b() != 0) {
+    _this->_internal_set_port_b(from._internal_port_b());
+  }
+  if (from._internal_end() != 0) {
+    _this->_internal_set_end(from._internal_end());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Connection::CopyFrom(const Connection& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.Connection)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Connection::IsInitialized() const {
+  return true;
+}
+
+void Connection::InternalSwap(Connection* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Connection, _impl_.end_)
+      + sizeof(Connection::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(Connection, _impl_.counts_)>(
+          reinterpret_cast<char*>(&_impl_.counts_),
+          reinterpret_cast<char*>(&other->_impl_.counts_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Connection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_connection_2eproto_getter, &descriptor_table_connection_2eproto_once,
+      file_level_metadata_connection_2eproto[0]);
+}
+
+// ===================================================================
+
+class ConnectionCounts::_Internal {
+ public:
+};
+
+ConnectionCounts::ConnectionCounts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.ConnectionCounts)
+}
+ConnectionCounts::ConnectionCounts(const ConnectionCounts& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConnectionCounts* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.a_packets_){}
+    , decltype(_impl_.b_packets_){}
+    , decltype(_impl_.a_bytes_){}
+    , decltype(_impl_.b_bytes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.a_packets_, &from._impl_.a_packets_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.b_bytes_) -
+    reinterpret_cast<char*>(&_impl_.a_packets_)) + sizeof(_impl_.b_bytes_));
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.ConnectionCounts)
+}
+
+inline void ConnectionCounts::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.a_packets_){uint64_t{0u}}
+    , decltype(_impl_.b_packets_){uint64_t{0u}}
+    , decltype(_impl_.a_bytes_){uint64_t{0u}}
+    , decltype(_impl_.b_bytes_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ConnectionCounts::~ConnectionCounts() {
+  // @@protoc_insertion_point(destructor:Lansnoop.ConnectionCounts)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConnectionCounts::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ConnectionCounts::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConnectionCounts::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.ConnectionCounts)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.a_packets_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.b_bytes_) -
+      reinterpret_cast<char*>(&_impl_.a_packets_)) + sizeof(_impl_.b_bytes_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConnectionCounts::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 a_packets = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.a_packets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 b_packets = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.b_packets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 a_bytes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.a_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 b_bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.b_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConnectionCounts::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.ConnectionCounts)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 a_packets = 1;
+  if (this->_internal_a_packets() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_a_packets(), target);
+  }
+
+  // uint64 b_packets = 2;
+  if (this->_internal_b_packets() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_b_packets(), target);
+  }
+
+  // uint64 a_bytes = 3;
+  if (this->_internal_a_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_a_bytes(), target);
+  }
+
+  // uint64 b_bytes = 4;
+  if (this->_internal_b_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_b_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.ConnectionCounts)
+  return target;
+}
+
+size_t ConnectionCounts::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.ConnectionCounts)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 a_packets = 1;
+  if (this->_internal_a_packets() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_a_packets());
+  }
+
+  // uint64 b_packets = 2;
+  if (this->_internal_b_packets() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_b_packets());
+  }
+
+  // uint64 a_bytes = 3;
+  if (this->_internal_a_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_a_bytes());
+  }
+
+  // uint64 b_bytes = 4;
+  if (this->_internal_b_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_b_bytes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConnectionCounts::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConnectionCounts::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConnectionCounts::GetClassData() const { return &_class_data_; }
+
+
+void ConnectionCounts::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConnectionCounts*>(&to_msg);
+  auto& from = static_cast<const ConnectionCounts&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.ConnectionCounts)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_a_packets() != 0) {
+    _this->_internal_set_a_packets(from._internal_a_packets());
+  }
+  if (from._internal_b_packets() != 0) {
+    _this->_internal_set_b_packets(from._internal_b_packets());
+  }
+  if (from._internal_a_bytes() != 0) {
+    _this->_internal_set_a_bytes(from._internal_a_bytes());
+  }
+  if (from._internal_b_bytes() != 0) {
+    _this->_internal_set_b_bytes(from._internal_b_bytes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConnectionCounts::CopyFrom(const ConnectionCounts& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.ConnectionCounts)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConnectionCounts::IsInitialized() const {
+  return true;
+}
+
+void ConnectionCounts::InternalSwap(ConnectionCounts* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConnectionCounts, _impl_.b_bytes_)
+      + sizeof(ConnectionCounts::_impl_.b_bytes_)
+      - PROTOBUF_FIELD_OFFSET(ConnectionCounts, _impl_.a_packets_)>(
+          reinterpret_cast<char*>(&_impl_.a_packets_),
+          reinterpret_cast<char*>(&other->_impl_.a_packets_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConnectionCounts::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_connection_2eproto_getter, &descriptor_table_connection_2eproto_once,
+      file_level_metadata_connection_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Lansnoop::Connection*
+Arena::CreateMaybeMessage< ::Lansnoop::Connection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Connection >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::ConnectionCounts*
+Arena::CreateMaybeMessage< ::Lansnoop::ConnectionCounts >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::ConnectionCounts >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1080 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: connection.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_connection_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_connection_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_connection_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_connection_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_connection_2eproto;
+namespace Lansnoop {
+class Connection;
+struct ConnectionDefaultTypeInternal;
+extern ConnectionDefaultTypeInternal _Connection_default_instance_;
+class ConnectionCounts;
+struct ConnectionCountsDefaultTypeInternal;
+extern ConnectionCountsDefaultTypeInternal _ConnectionCounts_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::Connection* Arena::CreateMaybeMessage<::Lansnoop::Connection>(Arena*);
+template<> ::Lansnoop::ConnectionCounts* Arena::CreateMaybeMessage<::Lansnoop::ConnectionCounts>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+enum Connection_Protocol : int {
+  Connection_Protocol_UDP = 0,
+  Connection_Protocol_TCP = 1,
+  Connection_Protocol_DNS = 2,
+  Connection_Protocol_Connection_Protocol_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Connection_Protocol_Connection_Protocol_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Connection_Protocol_IsValid(int value);
+constexpr Connection_Protocol Connection_Protocol_Protocol_MIN = Connection_Protocol_UDP;
+constexpr Connection_Protocol Connection_Protocol_Protocol_MAX = Connection_Protocol_DNS;
+constexpr int Connection_Protocol_Protocol_ARRAYSIZE = Connection_Protocol_Protocol_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Connection_Protocol_descriptor();
+template<typename T>
+inline const std::string& Connection_Protocol_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Connection_Protocol>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Connection_Protocol_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Connection_Protocol_descriptor(), enum_t_value);
+}
+inline bool Connection_Protocol_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Connection_Protocol* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Connection_Protocol>(
+    Connection_Protocol_descriptor(), name, value);
+}
+enum Connection_End : int {
+  Connection_End_NOT_ENDED = 0,
+  Connection_End_CLOSED = 1,
+  Connection_End_RESET = 2,
+  Connection_End_IDLE = 3,
+  Connection_End_SHED = 4,
+  Connection_End_Connection_End_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Connection_End_Connection_End_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Connection_End_IsValid(int value);
+constexpr Connection_End Connection_End_End_MIN = Connection_End_NOT_ENDED;
+constexpr Connection_End Connection_End_End_MAX = Connection_End_SHED;
+constexpr int Connection_End_End_ARRAYSIZE = Connection_End_End_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Connection_End_descriptor();
+template<typename T>
+inline const std::string& Connection_End_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Connection_End>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Connection_End_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Connection_End_descriptor(), enum_t_value);
+}
+inline bool Connection_End_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Connection_End* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Connection_End>(
+    Connection_End_descriptor(), name, value);
+}
+// ===================================================================
+
+class Connection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Connection) */ {
+ public:
+  inline Connection() : Connection(nullptr) {}
+  ~Connection() override;
+  explicit PROTOBUF_CONSTEXPR Connection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Connection(const Connection& from);
+  Connection(Connection&& from) noexcept
+    : Connection() {
+    *this = ::std::move(from);
+  }
+
+  inline Connection& operator=(const Connection& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Connection& operator=(Connection&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Connection& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Connection* internal_default_instance() {
+    return reinterpret_cast<const Connection*>(
+               &_Connection_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Connection& a, Connection& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Connection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Connection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Connection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Connection>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Connection& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Connection& from) {
+    Connection::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Connection* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Connection";
+  }
+  protected:
+  explicit Connection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Connection_Protocol Protocol;
+  static constexpr Protocol UDP =
+    Connection_Protocol_UDP;
+  static constexpr Protocol TCP =
+    Connection_Protocol_TCP;
+  static constexpr Protocol DNS =
+    Connection_Protocol_DNS;
+  static inline bool Protocol_IsValid(int value) {
+    return Connection_Protocol_IsValid(value);
+  }
+  static constexpr Protocol Protocol_MIN =
+    Connection_Protocol_Protocol_MIN;
+  static constexpr Protocol Protocol_MAX =
+    Connection_Protocol_Protocol_MAX;
+  static constexpr int Protocol_ARRAYSIZE =
+    Connection_Protocol_Protocol_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Protocol_descriptor() {
+    return Connection_Protocol_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Protocol_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Protocol>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Protocol_Name.");
+    return Connection_Protocol_Name(enum_t_value);
+  }
+  static inline bool Protocol_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Protocol* value) {
+    return Connection_Protocol_Parse(name, value);
+  }
+
+  typedef Connection_End End;
+  static constexpr End NOT_ENDED =
+    Connection_End_NOT_ENDED;
+  static constexpr End CLOSED =
+    Connection_End_CLOSED;
+  static constexpr End RESET =
+    Connection_End_RESET;
+  static constexpr End IDLE =
+    Connection_End_IDLE;
+  static constexpr End SHED =
+    Connection_End_SHED;
+  static inline bool End_IsValid(int value) {
+    return Connection_End_IsValid(value);
+  }
+  static constexpr End End_MIN =
+    Connection_End_End_MIN;
+  static constexpr End End_MAX =
+    Connection_End_End_MAX;
+  static constexpr int End_ARRAYSIZE =
+    Connection_End_End_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  End_descriptor() {
+    return Connection_End_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& End_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, End>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function End_Name.");
+    return Connection_End_Name(enum_t_value);
+  }
+  static inline bool End_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      End* value) {
+    return Connection_End_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDescriptionFieldNumber = 6,
+    kCountsFieldNumber = 11,
+    kIdFieldNumber = 1,
+    kIpaddressAIdFieldNumber = 3,
+    kIpaddressBIdFieldNumber = 4,
+    kProtocolFieldNumber = 5,
+    kFiniFieldNumber = 2,
+    kEstablishedFieldNumber = 9,
+    kPortAFieldNumber = 7,
+    kPortBFieldNumber = 8,
+    kEndFieldNumber = 10,
+  };
+  // string description = 6;
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
+
+  // .Lansnoop.ConnectionCounts counts = 11;
+  bool has_counts() const;
+  private:
+  bool _internal_has_counts() const;
+  public:
+  void clear_counts();
+  const ::Lansnoop::ConnectionCounts& counts() const;
+  PROTOBUF_NODISCARD ::Lansnoop::ConnectionCounts* release_counts();
+  ::Lansnoop::ConnectionCounts* mutable_counts();
+  void set_allocated_counts(::Lansnoop::ConnectionCounts* counts);
+  private:
+  const ::Lansnoop::ConnectionCounts& _internal_counts() const;
+  ::Lansnoop::ConnectionCounts* _internal_mutable_counts();
+  public:
+  void unsafe_arena_set_allocated_counts(
+      ::Lansnoop::ConnectionCounts* counts);
+  ::Lansnoop::ConnectionCounts* unsafe_arena_release_counts();
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // uint32 ipaddress_a_id = 3;
+  void clear_ipaddress_a_id();
+  uint32_t ipaddress_a_id() const;
+  void set_ipaddress_a_id(uint32_t value);
+  private:
+  uint32_t _internal_ipaddress_a_id() const;
+  void _internal_set_ipaddress_a_id(uint32_t value);
+  public:
+
+  // uint32 ipaddress_b_id = 4;
+  void clear_ipaddress_b_id();
+  uint32_t ipaddress_b_id() const;
+  void set_ipaddress_b_id(uint32_t value);
+  private:
+  uint32_t _internal_ipaddress_b_id() const;
+  void _internal_set_ipaddress_b_id(uint32_t value);
+  public:
+
+  // .Lansnoop.Connection.Protocol protocol = 5;
+  void clear_protocol();
+  ::Lansnoop::Connection_Protocol protocol() const;
+  void set_protocol(::Lansnoop::Connection_Protocol value);
+  private:
+  ::Lansnoop::Connection_Protocol _internal_protocol() const;
+  void _internal_set_protocol(::Lansnoop::Connection_Protocol value);
+  public:
+
+  // bool fini = 2;
+  void clear_fini();
+  bool fini() const;
+  void set_fini(bool value);
+  private:
+  bool _internal_fini() const;
+  void _internal_set_fini(bool value);
+  public:
+
+  // bool established = 9;
+  void clear_established();
+  bool established() const;
+  void set_established(bool value);
+  private:
+  bool _internal_established() const;
+  void _internal_set_established(bool value);
+  public:
+
+  // uint32 port_a = 7;
+  void clear_port_a();
+  uint32_t port_a() const;
+  void set_port_a(uint32_t value);
+  private:
+  uint32_t _internal_port_a() const;
+  void _internal_set_port_a(uint32_t value);
+  public:
+
+  // uint32 port_b = 8;
+  void clear_port_b();
+  uint32_t port_b() const;
+  void set_port_b(uint32_t value);
+  private:
+  uint32_t _internal_port_b() const;
+  void _internal_set_port_b(uint32_t value);
+  public:
+
+  // .Lansnoop.Connection.End end = 10;
+  void clear_end();
+  ::Lansnoop::Connection_End end() const;
+  void set_end(::Lansnoop::Connection_End value);
+  private:
+  ::Lansnoop::Connection_End _internal_end() const;
+  void _internal_set_end(::Lansnoop::Connection_End value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.Connection)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::Lansnoop::ConnectionCounts* counts_;
+    uint32_t id_;
+    uint32_t ipaddress_a_id_;
+    uint32_t ipaddress_b_id_;
+    int protocol_;
+    bool fini_;
+    bool established_;
+    uint32_t port_a_;
+    uint32_t port_b_;
+    int end_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_connection_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConnectionCounts final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.ConnectionCounts) */ {
+ public:
+  inline ConnectionCounts() : ConnectionCounts(nullptr) {}
+  ~ConnectionCounts() override;
+  explicit PROTOBUF_CONSTEXPR ConnectionCounts(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConnectionCounts(const ConnectionCounts& from);
+  ConnectionCounts(ConnectionCounts&& from) noexcept
+    : ConnectionCounts() {
+    *this = ::std::move(from);
+  }
+
+  inline ConnectionCounts& operator=(const ConnectionCounts& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConnectionCounts& operator=(ConnectionCounts&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectionCounts& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectionCounts* internal_default_instance() {
+    return reinterpret_cast<const ConnectionCounts*>(
+               &_ConnectionCounts_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ConnectionCounts& a, ConnectionCounts& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConnectionCounts* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectionCounts* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConnectionCounts* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectionCounts>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConnectionCounts& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectionCounts& from) {
+    ConnectionCounts::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConnectionCounts* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.ConnectionCounts";
+  }
+  protected:
+  explicit ConnectionCounts(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAPacketsFieldNumber = 1,
+    kBPacketsFieldNumber = 2,
+    kABytesFieldNumber = 3,
+    kBBytesFieldNumber = 4,
+  };
+  // uint64 a_packets = 1;
+  void clear_a_packets();
+  uint64_t a_packets() const;
+  void set_a_packets(uint64_t value);
+  private:
+  uint64_t _internal_a_packets() const;
+  void _internal_set_a_packets(uint64_t value);
+  public:
+
+  // uint64 b_packets = 2;
+  void clear_b_packets();
+  uint64_t b_packets() const;
+  void set_b_packets(uint64_t value);
+  private:
+  uint64_t _internal_b_packets() const;
+  void _internal_set_b_packets(uint64_t value);
+  public:
+
+  // uint64 a_bytes = 3;
+  void clear_a_bytes();
+  uint64_t a_bytes() const;
+  void set_a_bytes(uint64_t value);
+  private:
+  uint64_t _internal_a_bytes() const;
+  void _internal_set_a_bytes(uint64_t value);
+  public:
+
+  // uint64 b_bytes = 4;
+  void clear_b_bytes();
+  uint64_t b_bytes() const;
+  void set_b_bytes(uint64_t value);
+  private:
+  uint64_t _internal_b_bytes() const;
+  void _internal_set_b_bytes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.ConnectionCounts)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t a_packets_;
+    uint64_t b_packets_;
+    uint64_t a_bytes_;
+    uint64_t b_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_connection_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Connection
+
+// uint32 id = 1;
+inline void Connection::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t Connection::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Connection::id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.id)
+  return _internal_id();
+}
+inline void Connection::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Connection::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.id)
+}
+
+// bool fini = 2;
+inline void Connection::clear_fini() {
+  _impl_.fini_ = false;
+}
+inline bool Connection::_internal_fini() const {
+  return _impl_.fini_;
+}
+inline bool Connection::fini() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.fini)
+  return _internal_fini();
+}
+inline void Connection::_internal_set_fini(bool value) {
+  
+  _impl_.fini_ = value;
+}
+inline void Connection::set_fini(bool value) {
+  _internal_set_fini(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.fini)
+}
+
+// uint32 ipaddress_a_id = 3;
+inline void Connection::clear_ipaddress_a_id() {
+  _impl_.ipaddress_a_id_ = 0u;
+}
+inline uint32_t Connection::_internal_ipaddress_a_id() const {
+  return _impl_.ipaddress_a_id_;
+}
+inline uint32_t Connection::ipaddress_a_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.ipaddress_a_id)
+  return _internal_ipaddress_a_id();
+}
+inline void Connection::_internal_set_ipaddress_a_id(uint32_t value) {
+  
+  _impl_.ipaddress_a_id_ = value;
+}
+inline void Connection::set_ipaddress_a_id(uint32_t value) {
+  _internal_set_ipaddress_a_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.ipaddress_a_id)
+}
+
+// uint32 ipaddress_b_id = 4;
+inline void Connection::clear_ipaddress_b_id() {
+  _impl_.ipaddress_b_id_ = 0u;
+}
+inline uint32_t Connection::_internal_ipaddress_b_id() const {
+  return _impl_.ipaddress_b_id_;
+}
+inline uint32_t Connection::ipaddress_b_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.ipaddress_b_id)
+  return _internal_ipaddress_b_id();
+}
+inline void Connection::_internal_set_ipaddress_b_id(uint32_t value) {
+  
+  _impl_.ipaddress_b_id_ = value;
+}
+inline void Connection::set_ipaddress_b_id(uint32_t value) {
+  _internal_set_ipaddress_b_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.ipaddress_b_id)
+}
+
+// .Lansnoop.Connection.Protocol protocol = 5;
+inline void Connection::clear_protocol() {
+  _impl_.protocol_ = 0;
+}
+inline ::Lansnoop::Connection_Protocol Connection::_internal_protocol() const {
+  return static_cast< ::Lansnoop::Connection_Protocol >(_impl_.protocol_);
+}
+inline ::Lansnoop::Connection_Protocol Connection::protocol() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.protocol)
+  return _internal_protocol();
+}
+inline void Connection::_internal_set_protocol(::Lansnoop::Connection_Protocol value) {
+  
+  _impl_.protocol_ = value;
+}
+inline void Connection::set_protocol(::Lansnoop::Connection_Protocol value) {
+  _internal_set_protocol(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.protocol)
+}
+
+// string description = 6;
+inline void Connection::clear_description() {
+  _impl_.description_.ClearToEmpty();
+}
+inline const std::string& Connection::description() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Connection::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.description)
+}
+inline std::string* Connection::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Connection.description)
+  return _s;
+}
+inline const std::string& Connection::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void Connection::_internal_set_description(const std::string& value) {
+  
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Connection::_internal_mutable_description() {
+  
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Connection::release_description() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Connection.description)
+  return _impl_.description_.Release();
+}
+inline void Connection::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Connection.description)
+}
+
+// uint32 port_a = 7;
+inline void Connection::clear_port_a() {
+  _impl_.port_a_ = 0u;
+}
+inline uint32_t Connection::_internal_port_a() const {
+  return _impl_.port_a_;
+}
+inline uint32_t Connection::port_a() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.port_a)
+  return _internal_port_a();
+}
+inline void Connection::_internal_set_port_a(uint32_t value) {
+  
+  _impl_.port_a_ = value;
+}
+inline void Connection::set_port_a(uint32_t value) {
+  _internal_set_port_a(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.port_a)
+}
+
+// uint32 port_b = 8;
+inline void Connection::clear_port_b() {
+  _impl_.port_b_ = 0u;
+}
+inline uint32_t Connection::_internal_port_b() const {
+  return _impl_.port_b_;
+}
+inline uint32_t Connection::port_b() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.port_b)
+  return _internal_port_b();
+}
+inline void Connection::_internal_set_port_b(uint32_t value) {
+  
+  _impl_.port_b_ = value;
+}
+inline void Connection::set_port_b(uint32_t value) {
+  _internal_set_port_b(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.port_b)
+}
+
+// bool established = 9;
+inline void Connection::clear_established() {
+  _impl_.established_ = false;
+}
+inline bool Connection::_internal_established() const {
+  return _impl_.established_;
+}
+inline bool Connection::established() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.established)
+  return _internal_established();
+}
+inline void Connection::_internal_set_established(bool value) {
+  
+  _impl_.established_ = value;
+}
+inline void Connection::set_established(bool value) {
+  _internal_set_established(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.established)
+}
+
+// .Lansnoop.Connection.End end = 10;
+inline void Connection::clear_end() {
+  _impl_.end_ = 0;
+}
+inline ::Lansnoop::Connection_End Connection::_internal_end() const {
+  return static_cast< ::Lansnoop::Connection_End >(_impl_.end_);
+}
+inline ::Lansnoop::Connection_End Connection::end() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.end)
+  return _internal_end();
+}
+inline void Connection::_internal_set_end(::Lansnoop::Connection_End value) {
+  
+  _impl_.end_ = value;
+}
+inline void Connection::set_end(::Lansnoop::Connection_End value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Connection.end)
+}
+
+// .Lansnoop.ConnectionCounts counts = 11;
+inline bool Connection::_internal_has_counts() const {
+  return this != internal_default_instance() && _impl_.counts_ != nullptr;
+}
+inline bool Connection::has_counts() const {
+  return _internal_has_counts();
+}
+inline void Connection::clear_counts() {
+  if (GetArenaForAllocation() == nullptr && _impl_.counts_ != nullptr) {
+    delete _impl_.counts_;
+  }
+  _impl_.counts_ = nullptr;
+}
+inline const ::Lansnoop::ConnectionCounts& Connection::_internal_counts() const {
+  const ::Lansnoop::ConnectionCounts* p = _impl_.counts_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lansnoop::ConnectionCounts&>(
+      ::Lansnoop::_ConnectionCounts_default_instance_);
+}
+inline const ::Lansnoop::ConnectionCounts& Connection::counts() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Connection.counts)
+  return _internal_counts();
+}
+inline void Connection::unsafe_arena_set_allocated_counts(
+    ::Lansnoop::ConnectionCounts* counts) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.counts_);
+  }
+  _impl_.counts_ = counts;
+  if (counts) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Connection.counts)
+}
+inline ::Lansnoop::ConnectionCounts* Connection::release_counts() {
+  
+  ::Lansnoop::ConnectionCounts* temp = _impl_.counts_;
+  _impl_.counts_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lansnoop::ConnectionCounts* Connection::unsafe_arena_release_counts() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Connection.counts)
+  
+  ::Lansnoop::ConnectionCounts* temp = _impl_.counts_;
+  _impl_.counts_ = nullptr;
+  return temp;
+}
+inline ::Lansnoop::ConnectionCounts* Connection::_internal_mutable_counts() {
+  
+  if (_impl_.counts_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lansnoop::ConnectionCounts>(GetArenaForAllocation());
+    _impl_.counts_ = p;
+  }
+  return _impl_.counts_;
+}
+inline ::Lansnoop::ConnectionCounts* Connection::mutable_counts() {
+  ::Lansnoop::ConnectionCounts* _msg = _internal_mutable_counts();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Connection.counts)
+  return _msg;
+}
+inline void Connection::set_allocated_counts(::Lansnoop::ConnectionCounts* counts) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.counts_;
+  }
+  if (counts) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(counts);
+    if (message_arena != submessage_arena) {
+      counts = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, counts, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.counts_ = counts;
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Connection.counts)
+}
+
+// -------------------------------------------------------------------
+
+// ConnectionCounts
+
+// uint64 a_packets = 1;
+inline void ConnectionCounts::clear_a_packets() {
+  _impl_.a_packets_ = uint64_t{0u};
+}
+inline uint64_t ConnectionCounts::_internal_a_packets() const {
+  return _impl_.a_packets_;
+}
+inline uint64_t ConnectionCounts::a_packets() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCounts.a_packets)
+  return _internal_a_packets();
+}
+inline void ConnectionCounts::_internal_set_a_packets(uint64_t value) {
+  
+  _impl_.a_packets_ = value;
+}
+inline void ConnectionCounts::set_a_packets(uint64_t value) {
+  _internal_set_a_packets(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCounts.a_packets)
+}
+
+// uint64 b_packets = 2;
+inline void ConnectionCounts::clear_b_packets() {
+  _impl_.b_packets_ = uint64_t{0u};
+}
+inline uint64_t ConnectionCounts::_internal_b_packets() const {
+  return _impl_.b_packets_;
+}
+inline uint64_t ConnectionCounts::b_packets() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCounts.b_packets)
+  return _internal_b_packets();
+}
+inline void ConnectionCounts::_internal_set_b_packets(uint64_t value) {
+  
+  _impl_.b_packets_ = value;
+}
+inline void ConnectionCounts::set_b_packets(uint64_t value) {
+  _internal_set_b_packets(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCounts.b_packets)
+}
+
+// uint64 a_bytes = 3;
+inline void ConnectionCounts::clear_a_bytes() {
+  _impl_.a_bytes_ = uint64_t{0u};
+}
+inline uint64_t ConnectionCounts::_internal_a_bytes() const {
+  return _impl_.a_bytes_;
+}
+inline uint64_t ConnectionCounts::a_bytes() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCounts.a_bytes)
+  return _internal_a_bytes();
+}
+inline void ConnectionCounts::_internal_set_a_bytes(uint64_t value) {
+  
+  _impl_.a_bytes_ = value;
+}
+inline void ConnectionCounts::set_a_bytes(uint64_t value) {
+  _internal_set_a_bytes(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCounts.a_bytes)
+}
+
+// uint64 b_bytes = 4;
+inline void ConnectionCounts::clear_b_bytes() {
+  _impl_.b_bytes_ = uint64_t{0u};
+}
+inline uint64_t ConnectionCounts::_internal_b_bytes() const {
+  return _impl_.b_bytes_;
+}
+inline uint64_t ConnectionCounts::b_bytes() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCounts.b_bytes)
+  return _internal_b_bytes();
+}
+inline void ConnectionCounts::_internal_set_b_bytes(uint64_t value) {
+  
+  _impl_.b_bytes_ = value;
+}
+inline void ConnectionCounts::set_b_bytes(uint64_t value) {
+  _internal_set_b_bytes(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCounts.b_bytes)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::Lansnoop::Connection_Protocol> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Lansnoop::Connection_Protocol>() {
+  return ::Lansnoop::Connection_Protocol_descriptor();
+}
+template <> struct is_proto_enum< ::Lansnoop::Connection_End> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Lansnoop::Connection_End>() {
+  return ::Lansnoop::Connection_End_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_connection_2eproto
@@ -0,0 +1,839 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: event.proto
+
+#include "event.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Lansnoop {
+PROTOBUF_CONSTEXPR Event::Event(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.packet_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct EventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EventDefaultTypeInternal() {}
+  union {
+    Event _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventDefaultTypeInternal _Event_default_instance_;
+}  // namespace Lansnoop
+static ::_pb::Metadata file_level_metadata_event_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_event_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_event_2eproto = nullptr;
+
+const uint32_t TableStruct_event_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Event, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Event, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Event, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Event, _impl_.packet_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Event, _impl_.type_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Lansnoop::Event)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Lansnoop::_Event_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_event_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013event.proto\022\010Lansnoop\032\rnetwork.proto\032\017"
+  "interface.proto\032\rtraffic.proto\032\017ipaddres"
+  "s.proto\032\013cloud.proto\032\020connection.proto\032\016"
+  "resolver.proto\"\310\002\n\005Event\022\021\n\ttimestamp\030\001 "
+  "\001(\006\022\016\n\006packet\030\002 \001(\004\022$\n\007network\030\003 \001(\0132\021.L"
+  "ansnoop.NetworkH\000\022(\n\tinterface\030\004 \001(\0132\023.L"
+  "ansnoop.InterfaceH\000\022$\n\007traffic\030\005 \001(\0132\021.L"
+  "ansnoop.TrafficH\000\022(\n\tipaddress\030\006 \001(\0132\023.L"
+  "ansnoop.IPAddressH\000\022 \n\005cloud\030\007 \001(\0132\017.Lan"
+  "snoop.CloudH\000\022*\n\nconnection\030\010 \001(\0132\024.Lans"
+  "noop.ConnectionH\000\022&\n\010resolver\030\t \001(\0132\022.La"
+  "nsnoop.ResolverH\000B\006\n\004typeb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_event_2eproto_deps[7] = {
+  &::descriptor_table_cloud_2eproto,
+  &::descriptor_table_connection_2eproto,
+  &::descriptor_table_interface_2eproto,
+  &::descriptor_table_ipaddress_2eproto,
+  &::descriptor_table_network_2eproto,
+  &::descriptor_table_resolver_2eproto,
+  &::descriptor_table_traffic_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_event_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_event_2eproto = {
+    false, false, 473, descriptor_table_protodef_event_2eproto,
+    "event.proto",
+    &descriptor_table_event_2eproto_once, descriptor_table_event_2eproto_deps, 7, 1,
+    schemas, file_default_instances, TableStruct_event_2eproto::offsets,
+    file_level_metadata_event_2eproto, file_level_enum_descriptors_event_2eproto,
+    file_level_service_descriptors_event_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_event_2eproto_getter() {
+  return &descriptor_table_event_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_event_2eproto(&descriptor_table_event_2eproto);
+namespace Lansnoop {
+
+// ===================================================================
+
+class Event::_Internal {
+ public:
+  static const ::Lansnoop::Network& network(const Event* msg);
+  static const ::Lansnoop::Interface& interface(const Event* msg);
+  static const ::Lansnoop::Traffic& traffic(const Event* msg);
+  static const ::Lansnoop::IPAddress& ipaddress(const Event* msg);
+  static const ::Lansnoop::Cloud& cloud(const Event* msg);
+  static const ::Lansnoop::Connection& connection(const Event* msg);
+  static const ::Lansnoop::Resolver& resolver(const Event* msg);
+};
+
+const ::Lansnoop::Network&
+Event::_Internal::network(const Event* msg) {
+  return *msg->_impl_.type_.network_;
+}
+const ::Lansnoop::Interface&
+Event::_Internal::interface(const Event* msg) {
+  return *msg->_impl_.type_.interface_;
+}
+const ::Lansnoop::Traffic&
+Event::_Internal::traffic(const Event* msg) {
+  return *msg->_impl_.type_.traffic_;
+}
+const ::Lansnoop::IPAddress&
+Event::_Internal::ipaddress(const Event* msg) {
+  return *msg->_impl_.type_.ipaddress_;
+}
+const ::Lansnoop::Cloud&
+Event::_Internal::cloud(const Event* msg) {
+  return *msg->_impl_.type_.cloud_;
+}
+const ::Lansnoop::Connection&
+Event::_Internal::connection(const Event* msg) {
+  return *msg->_impl_.type_.connection_;
+}
+const ::Lansnoop::Resolver&
+Event::_Internal::resolver(const Event* msg) {
+  return *msg->_impl_.type_.resolver_;
+}
+void Event::set_allocated_network(::Lansnoop::Network* network) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (network) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(network));
+    if (message_arena != submessage_arena) {
+      network = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, network, submessage_arena);
+    }
+    set_has_network();
+    _impl_.type_.network_ = network;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Event.network)
+}
+void Event::clear_network() {
+  if (_internal_has_network()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.network_;
+    }
+    clear_has_type();
+  }
+}
+void Event::set_allocated_interface(::Lansnoop::Interface* interface) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (interface) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(interface));
+    if (message_arena != submessage_arena) {
+      interface = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, interface, submessage_arena);
+    }
+    set_has_interface();
+    _impl_.type_.interface_ = interface;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Event.interface)
+}
+void Event::clear_interface() {
+  if (_internal_has_interface()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.interface_;
+    }
+    clear_has_type();
+  }
+}
+void Event::set_allocated_traffic(::Lansnoop::Traffic* traffic) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (traffic) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(traffic));
+    if (message_arena != submessage_arena) {
+      traffic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, traffic, submessage_arena);
+    }
+    set_has_traffic();
+    _impl_.type_.traffic_ = traffic;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Event.traffic)
+}
+void Event::clear_traffic() {
+  if (_internal_has_traffic()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.traffic_;
+    }
+    clear_has_type();
+  }
+}
+void Event::set_allocated_ipaddress(::Lansnoop::IPAddress* ipaddress) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (ipaddress) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ipaddress));
+    if (message_arena != submessage_arena) {
+      ipaddress = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ipaddress, submessage_arena);
+    }
+    set_has_ipaddress();
+    _impl_.type_.ipaddress_ = ipaddress;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Event.ipaddress)
+}
+void Event::clear_ipaddress() {
+  if (_internal_has_ipaddress()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.ipaddress_;
+    }
+    clear_has_type();
+  }
+}
+void Event::set_allocated_cloud(::Lansnoop::Cloud* cloud) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (cloud) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(cloud));
+    if (message_arena != submessage_arena) {
+      cloud = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cloud, submessage_arena);
+    }
+    set_has_cloud();
+    _impl_.type_.cloud_ = cloud;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Event.cloud)
+}
+void Event::clear_cloud() {
+  if (_internal_has_cloud()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.cloud_;
+    }
+    clear_has_type();
+  }
+}
+void Event::set_allocated_connection(::Lansnoop::Connection* connection) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (connection) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(connection));
+    if (message_arena != submessage_arena) {
+      connection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, connection, submessage_arena);
+    }
+    set_has_connection();
+    _impl_.type_.connection_ = connection;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Event.connection)
+}
+void Event::clear_connection() {
+  if (_internal_has_connection()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.connection_;
+    }
+    clear_has_type();
+  }
+}
+void Event::set_allocated_resolver(::Lansnoop::Resolver* resolver) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (resolver) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(resolver));
+    if (message_arena != submessage_arena) {
+      resolver = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, resolver, submessage_arena);
+    }
+    set_has_resolver();
+    _impl_.type_.resolver_ = resolver;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Event.resolver)
+}
+void Event::clear_resolver() {
+  if (_internal_has_resolver()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.resolver_;
+    }
+    clear_has_type();
+  }
+}
+Event::Event(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.Event)
+}
+Event::Event(const Event& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Event* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){}
+    , decltype(_impl_.packet_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.packet_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.packet_));
+  clear_has_type();
+  switch (from.type_case()) {
+    case kNetwork: {
+      _this->_internal_mutable_network()->::Lansnoop::Network::MergeFrom(
+          from._internal_network());
+      break;
+    }
+    case kInterface: {
+      _this->_internal_mutable_interface()->::Lansnoop::Interface::MergeFrom(
+          from._internal_interface());
+      break;
+    }
+    case kTraffic: {
+      _this->_internal_mutable_traffic()->::Lansnoop::Traffic::MergeFrom(
+          from._internal_traffic());
+      break;
+    }
+    case kIpaddress: {
+      _this->_internal_mutable_ipaddress()->::Lansnoop::IPAddress::MergeFrom(
+          from._internal_ipaddress());
+      break;
+    }
+    case kCloud: {
+      _this->_internal_mutable_cloud()->::Lansnoop::Cloud::MergeFrom(
+          from._internal_cloud());
+      break;
+    }
+    case kConnection: {
+      _this->_internal_mutable_connection()->::Lansnoop::Connection::MergeFrom(
+          from._internal_connection());
+      break;
+    }
+    case kResolver: {
+      _this->_internal_mutable_resolver()->::Lansnoop::Resolver::MergeFrom(
+          from._internal_resolver());
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.Event)
+}
+
+inline void Event::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.packet_){uint64_t{0u}}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_type();
+}
+
+Event::~Event() {
+  // @@protoc_insertion_point(destructor:Lansnoop.Event)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Event::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_type()) {
+    clear_type();
+  }
+}
+
+void Event::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Event::clear_type() {
+// @@protoc_insertion_point(one_of_clear_start:Lansnoop.Event)
+  switch (type_case()) {
+    case kNetwork: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.network_;
+      }
+      break;
+    }
+    case kInterface: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.interface_;
+      }
+      break;
+    }
+    case kTraffic: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.traffic_;
+      }
+      break;
+    }
+    case kIpaddress: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.ipaddress_;
+      }
+      break;
+    }
+    case kCloud: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.cloud_;
+      }
+      break;
+    }
+    case kConnection: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.connection_;
+      }
+      break;
+    }
+    case kResolver: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.resolver_;
+      }
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = TYPE_NOT_SET;
+}
+
+
+void Event::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.Event)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.packet_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.packet_));
+  clear_type();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Event::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // fixed64 timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 packet = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.packet_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Network network = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_network(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Interface interface = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_interface(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Traffic traffic = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_traffic(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.IPAddress ipaddress = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ipaddress(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Cloud cloud = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cloud(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Connection connection = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_connection(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.Resolver resolver = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_resolver(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Event::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.Event)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // fixed64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_timestamp(), target);
+  }
+
+  // uint64 packet = 2;
+  if (this->_internal_packet() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_packet(), target);
+  }
+
+  // .Lansnoop.Network network = 3;
+  if (_internal_has_network()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::network(this),
+        _Internal::network(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.Interface interface = 4;
+  if (_internal_has_interface()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::interface(this),
+        _Internal::interface(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.Traffic traffic = 5;
+  if (_internal_has_traffic()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::traffic(this),
+        _Internal::traffic(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.IPAddress ipaddress = 6;
+  if (_internal_has_ipaddress()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::ipaddress(this),
+        _Internal::ipaddress(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.Cloud cloud = 7;
+  if (_internal_has_cloud()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::cloud(this),
+        _Internal::cloud(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.Connection connection = 8;
+  if (_internal_has_connection()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::connection(this),
+        _Internal::connection(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.Resolver resolver = 9;
+  if (_internal_has_resolver()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::resolver(this),
+        _Internal::resolver(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.Event)
+  return target;
+}
+
+size_t Event::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.Event)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // fixed64 timestamp = 1;
+  if (this->_internal_timestamp() != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 packet = 2;
+  if (this->_internal_packet() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_packet());
+  }
+
+  switch (type_case()) {
+    // .Lansnoop.Network network = 3;
+    case kNetwork: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.network_);
+      break;
+    }
+    // .Lansnoop.Interface interface = 4;
+    case kInterface: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.interface_);
+      break;
+    }
+    // .Lansnoop.Traffic traffic = 5;
+    case kTraffic: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.traffic_);
+      break;
+    }
+    // .Lansnoop.IPAddress ipaddress = 6;
+    case kIpaddress: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.ipaddress_);
+      break;
+    }
+    // .Lansnoop.Cloud cloud = 7;
+    case kCloud: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.cloud_);
+      break;
+    }
+    // .Lansnoop.Connection connection = 8;
+    case kConnection: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.connection_);
+      break;
+    }
+    // .Lansnoop.Resolver resolver = 9;
+    case kResolver: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.resolver_);
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Event::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Event::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Event::GetClassData() const { return &_class_data_; }
+
+
+void Event::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Event*>(&to_msg);
+  auto& from = static_cast<const Event&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.Event)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_packet() != 0) {
+    _this->_internal_set_packet(from._internal_packet());
+  }
+  switch (from.type_case()) {
+    case kNetwork: {
+      _this->_internal_mutable_network()->::Lansnoop::Network::MergeFrom(
+          from._internal_network());
+      break;
+    }
+    case kInterface: {
+      _this->_internal_mutable_interface()->::Lansnoop::Interface::MergeFrom(
+          from._internal_interface());
+      break;
+    }
+    case kTraffic: {
+      _this->_internal_mutable_traffic()->::Lansnoop::Traffic::MergeFrom(
+          from._internal_traffic());
+      break;
+    }
+    case kIpaddress: {
+      _this->_internal_mutable_ipaddress()->::Lansnoop::IPAddress::MergeFrom(
+          from._internal_ipaddress());
+      break;
+    }
+    case kCloud: {
+      _this->_internal_mutable_cloud()->::Lansnoop::Cloud::MergeFrom(
+          from._internal_cloud());
+      break;
+    }
+    case kConnection: {
+      _this->_internal_mutable_connection()->::Lansnoop::Connection::MergeFrom(
+          from._internal_connection());
+      break;
+    }
+    case kResolver: {
+      _this->_internal_mutable_resolver()->::Lansnoop::Resolver::MergeFrom(
+          from._internal_resolver());
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Event::CopyFrom(const Event& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.Event)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Event::IsInitialized() const {
+  return true;
+}
+
+void Event::InternalSwap(Event* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Event, _impl_.packet_)
+      + sizeof(Event::_impl_.packet_)
+      - PROTOBUF_FIELD_OFFSET(Event, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Event::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_event_2eproto_getter, &descriptor_table_event_2eproto_once,
+      file_level_metadata_event_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Lansnoop::Event*
+Arena::CreateMaybeMessage< ::Lansnoop::Event >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Event >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
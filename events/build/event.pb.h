@@ -0,0 +1,925 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: event.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_event_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_event_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "network.pb.h"
+#include "interface.pb.h"
+#include "traffic.pb.h"
+#include "ipaddress.pb.h"
+#include "cloud.pb.h"
+#include "connection.pb.h"
+#include "resolver.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_event_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_event_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_event_2eproto;
+namespace Lansnoop {
+class Event;
+struct EventDefaultTypeInternal;
+extern EventDefaultTypeInternal _Event_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::Event* Arena::CreateMaybeMessage<::Lansnoop::Event>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+// ===================================================================
+
+class Event final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Event) */ {
+ public:
+  inline Event() : Event(nullptr) {}
+  ~Event() override;
+  explicit PROTOBUF_CONSTEXPR Event(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Event(const Event& from);
+  Event(Event&& from) noexcept
+    : Event() {
+    *this = ::std::move(from);
+  }
+
+  inline Event& operator=(const Event& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Event& operator=(Event&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Event& default_instance() {
+    return *internal_default_instance();
+  }
+  enum TypeCase {
+    kNetwork = 3,
+    kInterface = 4,
+    kTraffic = 5,
+    kIpaddress = 6,
+    kCloud = 7,
+    kConnection = 8,
+    kResolver = 9,
+    TYPE_NOT_SET = 0,
+  };
+
+  static inline const Event* internal_default_instance() {
+    return reinterpret_cast<const Event*>(
+               &_Event_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Event& a, Event& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Event* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Event* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Event* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Event>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Event& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Event& from) {
+    Event::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Event* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Event";
+  }
+  protected:
+  explicit Event(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimestampFieldNumber = 1,
+    kPacketFieldNumber = 2,
+    kNetworkFieldNumber = 3,
+    kInterfaceFieldNumber = 4,
+    kTrafficFieldNumber = 5,
+    kIpaddressFieldNumber = 6,
+    kCloudFieldNumber = 7,
+    kConnectionFieldNumber = 8,
+    kResolverFieldNumber = 9,
+  };
+  // fixed64 timestamp = 1;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // uint64 packet = 2;
+  void clear_packet();
+  uint64_t packet() const;
+  void set_packet(uint64_t value);
+  private:
+  uint64_t _internal_packet() const;
+  void _internal_set_packet(uint64_t value);
+  public:
+
+  // .Lansnoop.Network network = 3;
+  bool has_network() const;
+  private:
+  bool _internal_has_network() const;
+  public:
+  void clear_network();
+  const ::Lansnoop::Network& network() const;
+  PROTOBUF_NODISCARD ::Lansnoop::Network* release_network();
+  ::Lansnoop::Network* mutable_network();
+  void set_allocated_network(::Lansnoop::Network* network);
+  private:
+  const ::Lansnoop::Network& _internal_network() const;
+  ::Lansnoop::Network* _internal_mutable_network();
+  public:
+  void unsafe_arena_set_allocated_network(
+      ::Lansnoop::Network* network);
+  ::Lansnoop::Network* unsafe_arena_release_network();
+
+  // .Lansnoop.Interface interface = 4;
+  bool has_interface() const;
+  private:
+  bool _internal_has_interface() const;
+  public:
+  void clear_interface();
+  const ::Lansnoop::Interface& interface() const;
+  PROTOBUF_NODISCARD ::Lansnoop::Interface* release_interface();
+  ::Lansnoop::Interface* mutable_interface();
+  void set_allocated_interface(::Lansnoop::Interface* interface);
+  private:
+  const ::Lansnoop::Interface& _internal_interface() const;
+  ::Lansnoop::Interface* _internal_mutable_interface();
+  public:
+  void unsafe_arena_set_allocated_interface(
+      ::Lansnoop::Interface* interface);
+  ::Lansnoop::Interface* unsafe_arena_release_interface();
+
+  // .Lansnoop.Traffic traffic = 5;
+  bool has_traffic() const;
+  private:
+  bool _internal_has_traffic() const;
+  public:
+  void clear_traffic();
+  const ::Lansnoop::Traffic& traffic() const;
+  PROTOBUF_NODISCARD ::Lansnoop::Traffic* release_traffic();
+  ::Lansnoop::Traffic* mutable_traffic();
+  void set_allocated_traffic(::Lansnoop::Traffic* traffic);
+  private:
+  const ::Lansnoop::Traffic& _internal_traffic() const;
+  ::Lansnoop::Traffic* _internal_mutable_traffic();
+  public:
+  void unsafe_arena_set_allocated_traffic(
+      ::Lansnoop::Traffic* traffic);
+  ::Lansnoop::Traffic* unsafe_arena_release_traffic();
+
+  // .Lansnoop.IPAddress ipaddress = 6;
+  bool has_ipaddress() const;
+  private:
+  bool _internal_has_ipaddress() const;
+  public:
+  void clear_ipaddress();
+  const ::Lansnoop::IPAddress& ipaddress() const;
+  PROTOBUF_NODISCARD ::Lansnoop::IPAddress* release_ipaddress();
+  ::Lansnoop::IPAddress* mutable_ipaddress();
+  void set_allocated_ipaddress(::Lansnoop::IPAddress* ipaddress);
+  private:
+  const ::Lansnoop::IPAddress& _internal_ipaddress() const;
+  ::Lansnoop::IPAddress* _internal_mutable_ipaddress();
+  public:
+  void unsafe_arena_set_allocated_ipaddress(
+      ::Lansnoop::IPAddress* ipaddress);
+  ::Lansnoop::IPAddress* unsafe_arena_release_ipaddress();
+
+  // .Lansnoop.Cloud cloud = 7;
+  bool has_cloud() const;
+  private:
+  bool _internal_has_cloud() const;
+  public:
+  void clear_cloud();
+  const ::Lansnoop::Cloud& cloud() const;
+  PROTOBUF_NODISCARD ::Lansnoop::Cloud* release_cloud();
+  ::Lansnoop::Cloud* mutable_cloud();
+  void set_allocated_cloud(::Lansnoop::Cloud* cloud);
+  private:
+  const ::Lansnoop::Cloud& _internal_cloud() const;
+  ::Lansnoop::Cloud* _internal_mutable_cloud();
+  public:
+  void unsafe_arena_set_allocated_cloud(
+      ::Lansnoop::Cloud* cloud);
+  ::Lansnoop::Cloud* unsafe_arena_release_cloud();
+
+  // .Lansnoop.Connection connection = 8;
+  bool has_connection() const;
+  private:
+  bool _internal_has_connection() const;
+  public:
+  void clear_connection();
+  const ::Lansnoop::Connection& connection() const;
+  PROTOBUF_NODISCARD ::Lansnoop::Connection* release_connection();
+  ::Lansnoop::Connection* mutable_connection();
+  void set_allocated_connection(::Lansnoop::Connection* connection);
+  private:
+  const ::Lansnoop::Connection& _internal_connection() const;
+  ::Lansnoop::Connection* _internal_mutable_connection();
+  public:
+  void unsafe_arena_set_allocated_connection(
+      ::Lansnoop::Connection* connection);
+  ::Lansnoop::Connection* unsafe_arena_release_connection();
+
+  // .Lansnoop.Resolver resolver = 9;
+  bool has_resolver() const;
+  private:
+  bool _internal_has_resolver() const;
+  public:
+  void clear_resolver();
+  const ::Lansnoop::Resolver& resolver() const;
+  PROTOBUF_NODISCARD ::Lansnoop::Resolver* release_resolver();
+  ::Lansnoop::Resolver* mutable_resolver();
+  void set_allocated_resolver(::Lansnoop::Resolver* resolver);
+  private:
+  const ::Lansnoop::Resolver& _internal_resolver() const;
+  ::Lansnoop::Resolver* _internal_mutable_resolver();
+  public:
+  void unsafe_arena_set_allocated_resolver(
+      ::Lansnoop::Resolver* resolver);
+  ::Lansnoop::Resolver* unsafe_arena_release_resolver();
+
+  void clear_type();
+  TypeCase type_case() const;
+  // @@protoc_insertion_point(class_scope:Lansnoop.Event)
+ private:
+  class _Internal;
+  void set_has_network();
+  void set_has_interface();
+  void set_has_traffic();
+  void set_has_ipaddress();
+  void set_has_cloud();
+  void set_has_connection();
+  void set_has_resolver();
+
+  inline bool has_type() const;
+  inline void clear_has_type();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t timestamp_;
+    uint64_t packet_;
+    union TypeUnion {
+      constexpr TypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::Lansnoop::Network* network_;
+      ::Lansnoop::Interface* interface_;
+      ::Lansnoop::Traffic* traffic_;
+      ::Lansnoop::IPAddress* ipaddress_;
+      ::Lansnoop::Cloud* cloud_;
+      ::Lansnoop::Connection* connection_;
+      ::Lansnoop::Resolver* resolver_;
+    } type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_event_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Event
+
+// fixed64 timestamp = 1;
+inline void Event::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t Event::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t Event::timestamp() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.timestamp)
+  return _internal_timestamp();
+}
+inline void Event::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void Event::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Event.timestamp)
+}
+
+// uint64 packet = 2;
+inline void Event::clear_packet() {
+  _impl_.packet_ = uint64_t{0u};
+}
+inline uint64_t Event::_internal_packet() const {
+  return _impl_.packet_;
+}
+inline uint64_t Event::packet() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.packet)
+  return _internal_packet();
+}
+inline void Event::_internal_set_packet(uint64_t value) {
+  
+  _impl_.packet_ = value;
+}
+inline void Event::set_packet(uint64_t value) {
+  _internal_set_packet(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Event.packet)
+}
+
+// .Lansnoop.Network network = 3;
+inline bool Event::_internal_has_network() const {
+  return type_case() == kNetwork;
+}
+inline bool Event::has_network() const {
+  return _internal_has_network();
+}
+inline void Event::set_has_network() {
+  _impl_._oneof_case_[0] = kNetwork;
+}
+inline ::Lansnoop::Network* Event::release_network() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Event.network)
+  if (_internal_has_network()) {
+    clear_has_type();
+    ::Lansnoop::Network* temp = _impl_.type_.network_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.network_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Lansnoop::Network& Event::_internal_network() const {
+  return _internal_has_network()
+      ? *_impl_.type_.network_
+      : reinterpret_cast< ::Lansnoop::Network&>(::Lansnoop::_Network_default_instance_);
+}
+inline const ::Lansnoop::Network& Event::network() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.network)
+  return _internal_network();
+}
+inline ::Lansnoop::Network* Event::unsafe_arena_release_network() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Lansnoop.Event.network)
+  if (_internal_has_network()) {
+    clear_has_type();
+    ::Lansnoop::Network* temp = _impl_.type_.network_;
+    _impl_.type_.network_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::unsafe_arena_set_allocated_network(::Lansnoop::Network* network) {
+  clear_type();
+  if (network) {
+    set_has_network();
+    _impl_.type_.network_ = network;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Event.network)
+}
+inline ::Lansnoop::Network* Event::_internal_mutable_network() {
+  if (!_internal_has_network()) {
+    clear_type();
+    set_has_network();
+    _impl_.type_.network_ = CreateMaybeMessage< ::Lansnoop::Network >(GetArenaForAllocation());
+  }
+  return _impl_.type_.network_;
+}
+inline ::Lansnoop::Network* Event::mutable_network() {
+  ::Lansnoop::Network* _msg = _internal_mutable_network();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Event.network)
+  return _msg;
+}
+
+// .Lansnoop.Interface interface = 4;
+inline bool Event::_internal_has_interface() const {
+  return type_case() == kInterface;
+}
+inline bool Event::has_interface() const {
+  return _internal_has_interface();
+}
+inline void Event::set_has_interface() {
+  _impl_._oneof_case_[0] = kInterface;
+}
+inline ::Lansnoop::Interface* Event::release_interface() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Event.interface)
+  if (_internal_has_interface()) {
+    clear_has_type();
+    ::Lansnoop::Interface* temp = _impl_.type_.interface_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.interface_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Lansnoop::Interface& Event::_internal_interface() const {
+  return _internal_has_interface()
+      ? *_impl_.type_.interface_
+      : reinterpret_cast< ::Lansnoop::Interface&>(::Lansnoop::_Interface_default_instance_);
+}
+inline const ::Lansnoop::Interface& Event::interface() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.interface)
+  return _internal_interface();
+}
+inline ::Lansnoop::Interface* Event::unsafe_arena_release_interface() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Lansnoop.Event.interface)
+  if (_internal_has_interface()) {
+    clear_has_type();
+    ::Lansnoop::Interface* temp = _impl_.type_.interface_;
+    _impl_.type_.interface_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::unsafe_arena_set_allocated_interface(::Lansnoop::Interface* interface) {
+  clear_type();
+  if (interface) {
+    set_has_interface();
+    _impl_.type_.interface_ = interface;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Event.interface)
+}
+inline ::Lansnoop::Interface* Event::_internal_mutable_interface() {
+  if (!_internal_has_interface()) {
+    clear_type();
+    set_has_interface();
+    _impl_.type_.interface_ = CreateMaybeMessage< ::Lansnoop::Interface >(GetArenaForAllocation());
+  }
+  return _impl_.type_.interface_;
+}
+inline ::Lansnoop::Interface* Event::mutable_interface() {
+  ::Lansnoop::Interface* _msg = _internal_mutable_interface();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Event.interface)
+  return _msg;
+}
+
+// .Lansnoop.Traffic traffic = 5;
+inline bool Event::_internal_has_traffic() const {
+  return type_case() == kTraffic;
+}
+inline bool Event::has_traffic() const {
+  return _internal_has_traffic();
+}
+inline void Event::set_has_traffic() {
+  _impl_._oneof_case_[0] = kTraffic;
+}
+inline ::Lansnoop::Traffic* Event::release_traffic() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Event.traffic)
+  if (_internal_has_traffic()) {
+    clear_has_type();
+    ::Lansnoop::Traffic* temp = _impl_.type_.traffic_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.traffic_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Lansnoop::Traffic& Event::_internal_traffic() const {
+  return _internal_has_traffic()
+      ? *_impl_.type_.traffic_
+      : reinterpret_cast< ::Lansnoop::Traffic&>(::Lansnoop::_Traffic_default_instance_);
+}
+inline const ::Lansnoop::Traffic& Event::traffic() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.traffic)
+  return _internal_traffic();
+}
+inline ::Lansnoop::Traffic* Event::unsafe_arena_release_traffic() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Lansnoop.Event.traffic)
+  if (_internal_has_traffic()) {
+    clear_has_type();
+    ::Lansnoop::Traffic* temp = _impl_.type_.traffic_;
+    _impl_.type_.traffic_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::unsafe_arena_set_allocated_traffic(::Lansnoop::Traffic* traffic) {
+  clear_type();
+  if (traffic) {
+    set_has_traffic();
+    _impl_.type_.traffic_ = traffic;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Event.traffic)
+}
+inline ::Lansnoop::Traffic* Event::_internal_mutable_traffic() {
+  if (!_internal_has_traffic()) {
+    clear_type();
+    set_has_traffic();
+    _impl_.type_.traffic_ = CreateMaybeMessage< ::Lansnoop::Traffic >(GetArenaForAllocation());
+  }
+  return _impl_.type_.traffic_;
+}
+inline ::Lansnoop::Traffic* Event::mutable_traffic() {
+  ::Lansnoop::Traffic* _msg = _internal_mutable_traffic();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Event.traffic)
+  return _msg;
+}
+
+// .Lansnoop.IPAddress ipaddress = 6;
+inline bool Event::_internal_has_ipaddress() const {
+  return type_case() == kIpaddress;
+}
+inline bool Event::has_ipaddress() const {
+  return _internal_has_ipaddress();
+}
+inline void Event::set_has_ipaddress() {
+  _impl_._oneof_case_[0] = kIpaddress;
+}
+inline ::Lansnoop::IPAddress* Event::release_ipaddress() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Event.ipaddress)
+  if (_internal_has_ipaddress()) {
+    clear_has_type();
+    ::Lansnoop::IPAddress* temp = _impl_.type_.ipaddress_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.ipaddress_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Lansnoop::IPAddress& Event::_internal_ipaddress() const {
+  return _internal_has_ipaddress()
+      ? *_impl_.type_.ipaddress_
+      : reinterpret_cast< ::Lansnoop::IPAddress&>(::Lansnoop::_IPAddress_default_instance_);
+}
+inline const ::Lansnoop::IPAddress& Event::ipaddress() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.ipaddress)
+  return _internal_ipaddress();
+}
+inline ::Lansnoop::IPAddress* Event::unsafe_arena_release_ipaddress() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Lansnoop.Event.ipaddress)
+  if (_internal_has_ipaddress()) {
+    clear_has_type();
+    ::Lansnoop::IPAddress* temp = _impl_.type_.ipaddress_;
+    _impl_.type_.ipaddress_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::unsafe_arena_set_allocated_ipaddress(::Lansnoop::IPAddress* ipaddress) {
+  clear_type();
+  if (ipaddress) {
+    set_has_ipaddress();
+    _impl_.type_.ipaddress_ = ipaddress;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Event.ipaddress)
+}
+inline ::Lansnoop::IPAddress* Event::_internal_mutable_ipaddress() {
+  if (!_internal_has_ipaddress()) {
+    clear_type();
+    set_has_ipaddress();
+    _impl_.type_.ipaddress_ = CreateMaybeMessage< ::Lansnoop::IPAddress >(GetArenaForAllocation());
+  }
+  return _impl_.type_.ipaddress_;
+}
+inline ::Lansnoop::IPAddress* Event::mutable_ipaddress() {
+  ::Lansnoop::IPAddress* _msg = _internal_mutable_ipaddress();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Event.ipaddress)
+  return _msg;
+}
+
+// .Lansnoop.Cloud cloud = 7;
+inline bool Event::_internal_has_cloud() const {
+  return type_case() == kCloud;
+}
+inline bool Event::has_cloud() const {
+  return _internal_has_cloud();
+}
+inline void Event::set_has_cloud() {
+  _impl_._oneof_case_[0] = kCloud;
+}
+inline ::Lansnoop::Cloud* Event::release_cloud() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Event.cloud)
+  if (_internal_has_cloud()) {
+    clear_has_type();
+    ::Lansnoop::Cloud* temp = _impl_.type_.cloud_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.cloud_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Lansnoop::Cloud& Event::_internal_cloud() const {
+  return _internal_has_cloud()
+      ? *_impl_.type_.cloud_
+      : reinterpret_cast< ::Lansnoop::Cloud&>(::Lansnoop::_Cloud_default_instance_);
+}
+inline const ::Lansnoop::Cloud& Event::cloud() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.cloud)
+  return _internal_cloud();
+}
+inline ::Lansnoop::Cloud* Event::unsafe_arena_release_cloud() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Lansnoop.Event.cloud)
+  if (_internal_has_cloud()) {
+    clear_has_type();
+    ::Lansnoop::Cloud* temp = _impl_.type_.cloud_;
+    _impl_.type_.cloud_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::unsafe_arena_set_allocated_cloud(::Lansnoop::Cloud* cloud) {
+  clear_type();
+  if (cloud) {
+    set_has_cloud();
+    _impl_.type_.cloud_ = cloud;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Event.cloud)
+}
+inline ::Lansnoop::Cloud* Event::_internal_mutable_cloud() {
+  if (!_internal_has_cloud()) {
+    clear_type();
+    set_has_cloud();
+    _impl_.type_.cloud_ = CreateMaybeMessage< ::Lansnoop::Cloud >(GetArenaForAllocation());
+  }
+  return _impl_.type_.cloud_;
+}
+inline ::Lansnoop::Cloud* Event::mutable_cloud() {
+  ::Lansnoop::Cloud* _msg = _internal_mutable_cloud();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Event.cloud)
+  return _msg;
+}
+
+// .Lansnoop.Connection connection = 8;
+inline bool Event::_internal_has_connection() const {
+  return type_case() == kConnection;
+}
+inline bool Event::has_connection() const {
+  return _internal_has_connection();
+}
+inline void Event::set_has_connection() {
+  _impl_._oneof_case_[0] = kConnection;
+}
+inline ::Lansnoop::Connection* Event::release_connection() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Event.connection)
+  if (_internal_has_connection()) {
+    clear_has_type();
+    ::Lansnoop::Connection* temp = _impl_.type_.connection_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.connection_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Lansnoop::Connection& Event::_internal_connection() const {
+  return _internal_has_connection()
+      ? *_impl_.type_.connection_
+      : reinterpret_cast< ::Lansnoop::Connection&>(::Lansnoop::_Connection_default_instance_);
+}
+inline const ::Lansnoop::Connection& Event::connection() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.connection)
+  return _internal_connection();
+}
+inline ::Lansnoop::Connection* Event::unsafe_arena_release_connection() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Lansnoop.Event.connection)
+  if (_internal_has_connection()) {
+    clear_has_type();
+    ::Lansnoop::Connection* temp = _impl_.type_.connection_;
+    _impl_.type_.connection_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::unsafe_arena_set_allocated_connection(::Lansnoop::Connection* connection) {
+  clear_type();
+  if (connection) {
+    set_has_connection();
+    _impl_.type_.connection_ = connection;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Event.connection)
+}
+inline ::Lansnoop::Connection* Event::_internal_mutable_connection() {
+  if (!_internal_has_connection()) {
+    clear_type();
+    set_has_connection();
+    _impl_.type_.connection_ = CreateMaybeMessage< ::Lansnoop::Connection >(GetArenaForAllocation());
+  }
+  return _impl_.type_.connection_;
+}
+inline ::Lansnoop::Connection* Event::mutable_connection() {
+  ::Lansnoop::Connection* _msg = _internal_mutable_connection();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Event.connection)
+  return _msg;
+}
+
+// .Lansnoop.Resolver resolver = 9;
+inline bool Event::_internal_has_resolver() const {
+  return type_case() == kResolver;
+}
+inline bool Event::has_resolver() const {
+  return _internal_has_resolver();
+}
+inline void Event::set_has_resolver() {
+  _impl_._oneof_case_[0] = kResolver;
+}
+inline ::Lansnoop::Resolver* Event::release_resolver() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Event.resolver)
+  if (_internal_has_resolver()) {
+    clear_has_type();
+    ::Lansnoop::Resolver* temp = _impl_.type_.resolver_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.resolver_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Lansnoop::Resolver& Event::_internal_resolver() const {
+  return _internal_has_resolver()
+      ? *_impl_.type_.resolver_
+      : reinterpret_cast< ::Lansnoop::Resolver&>(::Lansnoop::_Resolver_default_instance_);
+}
+inline const ::Lansnoop::Resolver& Event::resolver() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Event.resolver)
+  return _internal_resolver();
+}
+inline ::Lansnoop::Resolver* Event::unsafe_arena_release_resolver() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Lansnoop.Event.resolver)
+  if (_internal_has_resolver()) {
+    clear_has_type();
+    ::Lansnoop::Resolver* temp = _impl_.type_.resolver_;
+    _impl_.type_.resolver_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Event::unsafe_arena_set_allocated_resolver(::Lansnoop::Resolver* resolver) {
+  clear_type();
+  if (resolver) {
+    set_has_resolver();
+    _impl_.type_.resolver_ = resolver;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Event.resolver)
+}
+inline ::Lansnoop::Resolver* Event::_internal_mutable_resolver() {
+  if (!_internal_has_resolver()) {
+    clear_type();
+    set_has_resolver();
+    _impl_.type_.resolver_ = CreateMaybeMessage< ::Lansnoop::Resolver >(GetArenaForAllocation());
+  }
+  return _impl_.type_.resolver_;
+}
+inline ::Lansnoop::Resolver* Event::mutable_resolver() {
+  ::Lansnoop::Resolver* _msg = _internal_mutable_resolver();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Event.resolver)
+  return _msg;
+}
+
+inline bool Event::has_type() const {
+  return type_case() != TYPE_NOT_SET;
+}
+inline void Event::clear_has_type() {
+  _impl_._oneof_case_[0] = TYPE_NOT_SET;
+}
+inline Event::TypeCase Event::type_case() const {
+  return Event::TypeCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_event_2eproto
@@ -0,0 +1,441 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: interface.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_interface_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_interface_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_interface_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_interface_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_interface_2eproto;
+namespace Lansnoop {
+class Interface;
+struct InterfaceDefaultTypeInternal;
+extern InterfaceDefaultTypeInternal _Interface_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::Interface* Arena::CreateMaybeMessage<::Lansnoop::Interface>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+// ===================================================================
+
+class Interface final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Interface) */ {
+ public:
+  inline Interface() : Interface(nullptr) {}
+  ~Interface() override;
+  explicit PROTOBUF_CONSTEXPR Interface(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Interface(const Interface& from);
+  Interface(Interface&& from) noexcept
+    : Interface() {
+    *this = ::std::move(from);
+  }
+
+  inline Interface& operator=(const Interface& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Interface& operator=(Interface&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Interface& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Interface* internal_default_instance() {
+    return reinterpret_cast<const Interface*>(
+               &_Interface_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Interface& a, Interface& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Interface* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Interface* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Interface* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Interface>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Interface& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Interface& from) {
+    Interface::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Interface* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Interface";
+  }
+  protected:
+  explicit Interface(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAddressFieldNumber = 3,
+    kMakerFieldNumber = 5,
+    kIdFieldNumber = 1,
+    kFiniFieldNumber = 2,
+    kNetworkIdFieldNumber = 4,
+  };
+  // bytes address = 3;
+  void clear_address();
+  const std::string& address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_address();
+  PROTOBUF_NODISCARD std::string* release_address();
+  void set_allocated_address(std::string* address);
+  private:
+  const std::string& _internal_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
+  std::string* _internal_mutable_address();
+  public:
+
+  // string maker = 5;
+  void clear_maker();
+  const std::string& maker() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_maker(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_maker();
+  PROTOBUF_NODISCARD std::string* release_maker();
+  void set_allocated_maker(std::string* maker);
+  private:
+  const std::string& _internal_maker() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_maker(const std::string& value);
+  std::string* _internal_mutable_maker();
+  public:
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // bool fini = 2;
+  void clear_fini();
+  bool fini() const;
+  void set_fini(bool value);
+  private:
+  bool _internal_fini() const;
+  void _internal_set_fini(bool value);
+  public:
+
+  // uint32 network_id = 4;
+  void clear_network_id();
+  uint32_t network_id() const;
+  void set_network_id(uint32_t value);
+  private:
+  uint32_t _internal_network_id() const;
+  void _internal_set_network_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.Interface)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr maker_;
+    uint32_t id_;
+    bool fini_;
+    uint32_t network_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_interface_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Interface
+
+// uint32 id = 1;
+inline void Interface::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t Interface::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Interface::id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Interface.id)
+  return _internal_id();
+}
+inline void Interface::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Interface::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Interface.id)
+}
+
+// bool fini = 2;
+inline void Interface::clear_fini() {
+  _impl_.fini_ = false;
+}
+inline bool Interface::_internal_fini() const {
+  return _impl_.fini_;
+}
+inline bool Interface::fini() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Interface.fini)
+  return _internal_fini();
+}
+inline void Interface::_internal_set_fini(bool value) {
+  
+  _impl_.fini_ = value;
+}
+inline void Interface::set_fini(bool value) {
+  _internal_set_fini(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Interface.fini)
+}
+
+// bytes address = 3;
+inline void Interface::clear_address() {
+  _impl_.address_.ClearToEmpty();
+}
+inline const std::string& Interface::address() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Interface.address)
+  return _internal_address();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Interface::set_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.address_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Lansnoop.Interface.address)
+}
+inline std::string* Interface::mutable_address() {
+  std::string* _s = _internal_mutable_address();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Interface.address)
+  return _s;
+}
+inline const std::string& Interface::_internal_address() const {
+  return _impl_.address_.Get();
+}
+inline void Interface::_internal_set_address(const std::string& value) {
+  
+  _impl_.address_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Interface::_internal_mutable_address() {
+  
+  return _impl_.address_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Interface::release_address() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Interface.address)
+  return _impl_.address_.Release();
+}
+inline void Interface::set_allocated_address(std::string* address) {
+  if (address != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Interface.address)
+}
+
+// uint32 network_id = 4;
+inline void Interface::clear_network_id() {
+  _impl_.network_id_ = 0u;
+}
+inline uint32_t Interface::_internal_network_id() const {
+  return _impl_.network_id_;
+}
+inline uint32_t Interface::network_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Interface.network_id)
+  return _internal_network_id();
+}
+inline void Interface::_internal_set_network_id(uint32_t value) {
+  
+  _impl_.network_id_ = value;
+}
+inline void Interface::set_network_id(uint32_t value) {
+  _internal_set_network_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Interface.network_id)
+}
+
+// string maker = 5;
+inline void Interface::clear_maker() {
+  _impl_.maker_.ClearToEmpty();
+}
+inline const std::string& Interface::maker() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Interface.maker)
+  return _internal_maker();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Interface::set_maker(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.maker_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Lansnoop.Interface.maker)
+}
+inline std::string* Interface::mutable_maker() {
+  std::string* _s = _internal_mutable_maker();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Interface.maker)
+  return _s;
+}
+inline const std::string& Interface::_internal_maker() const {
+  return _impl_.maker_.Get();
+}
+inline void Interface::_internal_set_maker(const std::string& value) {
+  
+  _impl_.maker_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Interface::_internal_mutable_maker() {
+  
+  return _impl_.maker_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Interface::release_maker() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Interface.maker)
+  return _impl_.maker_.Release();
+}
+inline void Interface::set_allocated_maker(std::string* maker) {
+  if (maker != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.maker_.SetAllocated(maker, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.maker_.IsDefault()) {
+    _impl_.maker_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Interface.maker)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_interface_2eproto
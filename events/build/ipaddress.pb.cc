@@ -0,0 +1,512 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ipaddress.proto
+
+#include "ipaddress.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Lansnoop {
+PROTOBUF_CONSTEXPR IPAddress::IPAddress(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ns_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.fini_)*/false
+  , /*decltype(_impl_.attached_to_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct IPAddressDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IPAddressDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IPAddressDefaultTypeInternal() {}
+  union {
+    IPAddress _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IPAddressDefaultTypeInternal _IPAddress_default_instance_;
+}  // namespace Lansnoop
+static ::_pb::Metadata file_level_metadata_ipaddress_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ipaddress_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ipaddress_2eproto = nullptr;
+
+const uint32_t TableStruct_ipaddress_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::IPAddress, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::IPAddress, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::IPAddress, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::IPAddress, _impl_.fini_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::IPAddress, _impl_.address_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::IPAddress, _impl_.ns_name_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::IPAddress, _impl_.attached_to_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Lansnoop::IPAddress)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Lansnoop::_IPAddress_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ipaddress_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017ipaddress.proto\022\010Lansnoop\"\202\001\n\tIPAddres"
+  "s\022\n\n\002id\030\001 \001(\r\022\014\n\004fini\030\002 \001(\010\022\017\n\007address\030\003"
+  " \001(\014\022\026\n\014interface_id\030\004 \001(\rH\000\022\022\n\010cloud_id"
+  "\030\005 \001(\rH\000\022\017\n\007ns_name\030\006 \001(\tB\r\n\013attached_to"
+  "b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_ipaddress_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ipaddress_2eproto = {
+    false, false, 168, descriptor_table_protodef_ipaddress_2eproto,
+    "ipaddress.proto",
+    &descriptor_table_ipaddress_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_ipaddress_2eproto::offsets,
+    file_level_metadata_ipaddress_2eproto, file_level_enum_descriptors_ipaddress_2eproto,
+    file_level_service_descriptors_ipaddress_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ipaddress_2eproto_getter() {
+  return &descriptor_table_ipaddress_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ipaddress_2eproto(&descriptor_table_ipaddress_2eproto);
+namespace Lansnoop {
+
+// ===================================================================
+
+class IPAddress::_Internal {
+ public:
+};
+
+IPAddress::IPAddress(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.IPAddress)
+}
+IPAddress::IPAddress(const IPAddress& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IPAddress* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.address_){}
+    , decltype(_impl_.ns_name_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.fini_){}
+    , decltype(_impl_.attached_to_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_address().empty()) {
+    _this->_impl_.address_.Set(from._internal_address(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ns_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ns_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ns_name().empty()) {
+    _this->_impl_.ns_name_.Set(from._internal_ns_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fini_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.fini_));
+  clear_has_attached_to();
+  switch (from.attached_to_case()) {
+    case kInterfaceId: {
+      _this->_internal_set_interface_id(from._internal_interface_id());
+      break;
+    }
+    case kCloudId: {
+      _this->_internal_set_cloud_id(from._internal_cloud_id());
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.IPAddress)
+}
+
+inline void IPAddress::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.address_){}
+    , decltype(_impl_.ns_name_){}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.fini_){false}
+    , decltype(_impl_.attached_to_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ns_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ns_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_attached_to();
+}
+
+IPAddress::~IPAddress() {
+  // @@protoc_insertion_point(destructor:Lansnoop.IPAddress)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void IPAddress::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.address_.Destroy();
+  _impl_.ns_name_.Destroy();
+  if (has_attached_to()) {
+    clear_attached_to();
+  }
+}
+
+void IPAddress::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void IPAddress::clear_attached_to() {
+// @@protoc_insertion_point(one_of_clear_start:Lansnoop.IPAddress)
+  switch (attached_to_case()) {
+    case kInterfaceId: {
+      // No need to clear
+      break;
+    }
+    case kCloudId: {
+      // No need to clear
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = ATTACHED_TO_NOT_SET;
+}
+
+
+void IPAddress::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.IPAddress)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.address_.ClearToEmpty();
+  _impl_.ns_name_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.fini_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.fini_));
+  clear_attached_to();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IPAddress::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool fini = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.fini_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes address = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 interface_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _internal_set_interface_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cloud_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _internal_set_cloud_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string ns_name = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_ns_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Lansnoop.IPAddress.ns_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IPAddress::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.IPAddress)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_fini(), target);
+  }
+
+  // bytes address = 3;
+  if (!this->_internal_address().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_address(), target);
+  }
+
+  // uint32 interface_id = 4;
+  if (_internal_has_interface_id()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_interface_id(), target);
+  }
+
+  // uint32 cloud_id = 5;
+  if (_internal_has_cloud_id()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_cloud_id(), target);
+  }
+
+  // string ns_name = 6;
+  if (!this->_internal_ns_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ns_name().data(), static_cast<int>(this->_internal_ns_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Lansnoop.IPAddress.ns_name");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_ns_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.IPAddress)
+  return target;
+}
+
+size_t IPAddress::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.IPAddress)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes address = 3;
+  if (!this->_internal_address().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_address());
+  }
+
+  // string ns_name = 6;
+  if (!this->_internal_ns_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ns_name());
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    total_size += 1 + 1;
+  }
+
+  switch (attached_to_case()) {
+    // uint32 interface_id = 4;
+    case kInterfaceId: {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_interface_id());
+      break;
+    }
+    // uint32 cloud_id = 5;
+    case kCloudId: {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cloud_id());
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IPAddress::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IPAddress::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IPAddress::GetClassData() const { return &_class_data_; }
+
+
+void IPAddress::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IPAddress*>(&to_msg);
+  auto& from = static_cast<const IPAddress&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.IPAddress)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_address().empty()) {
+    _this->_internal_set_address(from._internal_address());
+  }
+  if (!from._internal_ns_name().empty()) {
+    _this->_internal_set_ns_name(from._internal_ns_name());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_fini() != 0) {
+    _this->_internal_set_fini(from._internal_fini());
+  }
+  switch (from.attached_to_case()) {
+    case kInterfaceId: {
+      _this->_internal_set_interface_id(from._internal_interface_id());
+      break;
+    }
+    case kCloudId: {
+      _this->_internal_set_cloud_id(from._internal_cloud_id());
+      break;
+    }
+    case ATTACHED_TO_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IPAddress::CopyFrom(const IPAddress& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.IPAddress)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IPAddress::IsInitialized() const {
+  return true;
+}
+
+void IPAddress::InternalSwap(IPAddress* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.address_, lhs_arena,
+      &other->_impl_.address_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ns_name_, lhs_arena,
+      &other->_impl_.ns_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IPAddress, _impl_.fini_)
+      + sizeof(IPAddress::_impl_.fini_)
+      - PROTOBUF_FIELD_OFFSET(IPAddress, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+  swap(_impl_.attached_to_, other->_impl_.attached_to_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IPAddress::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ipaddress_2eproto_getter, &descriptor_table_ipaddress_2eproto_once,
+      file_level_metadata_ipaddress_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Lansnoop::IPAddress*
+Arena::CreateMaybeMessage< ::Lansnoop::IPAddress >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::IPAddress >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
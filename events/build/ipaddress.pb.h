@@ -0,0 +1,544 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ipaddress.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ipaddress_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ipaddress_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ipaddress_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ipaddress_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ipaddress_2eproto;
+namespace Lansnoop {
+class IPAddress;
+struct IPAddressDefaultTypeInternal;
+extern IPAddressDefaultTypeInternal _IPAddress_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::IPAddress* Arena::CreateMaybeMessage<::Lansnoop::IPAddress>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+// ===================================================================
+
+class IPAddress final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.IPAddress) */ {
+ public:
+  inline IPAddress() : IPAddress(nullptr) {}
+  ~IPAddress() override;
+  explicit PROTOBUF_CONSTEXPR IPAddress(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IPAddress(const IPAddress& from);
+  IPAddress(IPAddress&& from) noexcept
+    : IPAddress() {
+    *this = ::std::move(from);
+  }
+
+  inline IPAddress& operator=(const IPAddress& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IPAddress& operator=(IPAddress&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IPAddress& default_instance() {
+    return *internal_default_instance();
+  }
+  enum AttachedToCase {
+    kInterfaceId = 4,
+    kCloudId = 5,
+    ATTACHED_TO_NOT_SET = 0,
+  };
+
+  static inline const IPAddress* internal_default_instance() {
+    return reinterpret_cast<const IPAddress*>(
+               &_IPAddress_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(IPAddress& a, IPAddress& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IPAddress* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IPAddress* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IPAddress* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IPAddress>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IPAddress& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IPAddress& from) {
+    IPAddress::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IPAddress* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.IPAddress";
+  }
+  protected:
+  explicit IPAddress(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAddressFieldNumber = 3,
+    kNsNameFieldNumber = 6,
+    kIdFieldNumber = 1,
+    kFiniFieldNumber = 2,
+    kInterfaceIdFieldNumber = 4,
+    kCloudIdFieldNumber = 5,
+  };
+  // bytes address = 3;
+  void clear_address();
+  const std::string& address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_address();
+  PROTOBUF_NODISCARD std::string* release_address();
+  void set_allocated_address(std::string* address);
+  private:
+  const std::string& _internal_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
+  std::string* _internal_mutable_address();
+  public:
+
+  // string ns_name = 6;
+  void clear_ns_name();
+  const std::string& ns_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ns_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ns_name();
+  PROTOBUF_NODISCARD std::string* release_ns_name();
+  void set_allocated_ns_name(std::string* ns_name);
+  private:
+  const std::string& _internal_ns_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ns_name(const std::string& value);
+  std::string* _internal_mutable_ns_name();
+  public:
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // bool fini = 2;
+  void clear_fini();
+  bool fini() const;
+  void set_fini(bool value);
+  private:
+  bool _internal_fini() const;
+  void _internal_set_fini(bool value);
+  public:
+
+  // uint32 interface_id = 4;
+  bool has_interface_id() const;
+  private:
+  bool _internal_has_interface_id() const;
+  public:
+  void clear_interface_id();
+  uint32_t interface_id() const;
+  void set_interface_id(uint32_t value);
+  private:
+  uint32_t _internal_interface_id() const;
+  void _internal_set_interface_id(uint32_t value);
+  public:
+
+  // uint32 cloud_id = 5;
+  bool has_cloud_id() const;
+  private:
+  bool _internal_has_cloud_id() const;
+  public:
+  void clear_cloud_id();
+  uint32_t cloud_id() const;
+  void set_cloud_id(uint32_t value);
+  private:
+  uint32_t _internal_cloud_id() const;
+  void _internal_set_cloud_id(uint32_t value);
+  public:
+
+  void clear_attached_to();
+  AttachedToCase attached_to_case() const;
+  // @@protoc_insertion_point(class_scope:Lansnoop.IPAddress)
+ private:
+  class _Internal;
+  void set_has_interface_id();
+  void set_has_cloud_id();
+
+  inline bool has_attached_to() const;
+  inline void clear_has_attached_to();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ns_name_;
+    uint32_t id_;
+    bool fini_;
+    union AttachedToUnion {
+      constexpr AttachedToUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      uint32_t interface_id_;
+      uint32_t cloud_id_;
+    } attached_to_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ipaddress_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// IPAddress
+
+// uint32 id = 1;
+inline void IPAddress::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t IPAddress::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t IPAddress::id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.IPAddress.id)
+  return _internal_id();
+}
+inline void IPAddress::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void IPAddress::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.IPAddress.id)
+}
+
+// bool fini = 2;
+inline void IPAddress::clear_fini() {
+  _impl_.fini_ = false;
+}
+inline bool IPAddress::_internal_fini() const {
+  return _impl_.fini_;
+}
+inline bool IPAddress::fini() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.IPAddress.fini)
+  return _internal_fini();
+}
+inline void IPAddress::_internal_set_fini(bool value) {
+  
+  _impl_.fini_ = value;
+}
+inline void IPAddress::set_fini(bool value) {
+  _internal_set_fini(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.IPAddress.fini)
+}
+
+// bytes address = 3;
+inline void IPAddress::clear_address() {
+  _impl_.address_.ClearToEmpty();
+}
+inline const std::string& IPAddress::address() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.IPAddress.address)
+  return _internal_address();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IPAddress::set_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.address_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Lansnoop.IPAddress.address)
+}
+inline std::string* IPAddress::mutable_address() {
+  std::string* _s = _internal_mutable_address();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.IPAddress.address)
+  return _s;
+}
+inline const std::string& IPAddress::_internal_address() const {
+  return _impl_.address_.Get();
+}
+inline void IPAddress::_internal_set_address(const std::string& value) {
+  
+  _impl_.address_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IPAddress::_internal_mutable_address() {
+  
+  return _impl_.address_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IPAddress::release_address() {
+  // @@protoc_insertion_point(field_release:Lansnoop.IPAddress.address)
+  return _impl_.address_.Release();
+}
+inline void IPAddress::set_allocated_address(std::string* address) {
+  if (address != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.IPAddress.address)
+}
+
+// uint32 interface_id = 4;
+inline bool IPAddress::_internal_has_interface_id() const {
+  return attached_to_case() == kInterfaceId;
+}
+inline bool IPAddress::has_interface_id() const {
+  return _internal_has_interface_id();
+}
+inline void IPAddress::set_has_interface_id() {
+  _impl_._oneof_case_[0] = kInterfaceId;
+}
+inline void IPAddress::clear_interface_id() {
+  if (_internal_has_interface_id()) {
+    _impl_.attached_to_.interface_id_ = 0u;
+    clear_has_attached_to();
+  }
+}
+inline uint32_t IPAddress::_internal_interface_id() const {
+  if (_internal_has_interface_id()) {
+    return _impl_.attached_to_.interface_id_;
+  }
+  return 0u;
+}
+inline void IPAddress::_internal_set_interface_id(uint32_t value) {
+  if (!_internal_has_interface_id()) {
+    clear_attached_to();
+    set_has_interface_id();
+  }
+  _impl_.attached_to_.interface_id_ = value;
+}
+inline uint32_t IPAddress::interface_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.IPAddress.interface_id)
+  return _internal_interface_id();
+}
+inline void IPAddress::set_interface_id(uint32_t value) {
+  _internal_set_interface_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.IPAddress.interface_id)
+}
+
+// uint32 cloud_id = 5;
+inline bool IPAddress::_internal_has_cloud_id() const {
+  return attached_to_case() == kCloudId;
+}
+inline bool IPAddress::has_cloud_id() const {
+  return _internal_has_cloud_id();
+}
+inline void IPAddress::set_has_cloud_id() {
+  _impl_._oneof_case_[0] = kCloudId;
+}
+inline void IPAddress::clear_cloud_id() {
+  if (_internal_has_cloud_id()) {
+    _impl_.attached_to_.cloud_id_ = 0u;
+    clear_has_attached_to();
+  }
+}
+inline uint32_t IPAddress::_internal_cloud_id() const {
+  if (_internal_has_cloud_id()) {
+    return _impl_.attached_to_.cloud_id_;
+  }
+  return 0u;
+}
+inline void IPAddress::_internal_set_cloud_id(uint32_t value) {
+  if (!_internal_has_cloud_id()) {
+    clear_attached_to();
+    set_has_cloud_id();
+  }
+  _impl_.attached_to_.cloud_id_ = value;
+}
+inline uint32_t IPAddress::cloud_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.IPAddress.cloud_id)
+  return _internal_cloud_id();
+}
+inline void IPAddress::set_cloud_id(uint32_t value) {
+  _internal_set_cloud_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.IPAddress.cloud_id)
+}
+
+// string ns_name = 6;
+inline void IPAddress::clear_ns_name() {
+  _impl_.ns_name_.ClearToEmpty();
+}
+inline const std::string& IPAddress::ns_name() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.IPAddress.ns_name)
+  return _internal_ns_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IPAddress::set_ns_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ns_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Lansnoop.IPAddress.ns_name)
+}
+inline std::string* IPAddress::mutable_ns_name() {
+  std::string* _s = _internal_mutable_ns_name();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.IPAddress.ns_name)
+  return _s;
+}
+inline const std::string& IPAddress::_internal_ns_name() const {
+  return _impl_.ns_name_.Get();
+}
+inline void IPAddress::_internal_set_ns_name(const std::string& value) {
+  
+  _impl_.ns_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IPAddress::_internal_mutable_ns_name() {
+  
+  return _impl_.ns_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IPAddress::release_ns_name() {
+  // @@protoc_insertion_point(field_release:Lansnoop.IPAddress.ns_name)
+  return _impl_.ns_name_.Release();
+}
+inline void IPAddress::set_allocated_ns_name(std::string* ns_name) {
+  if (ns_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ns_name_.SetAllocated(ns_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ns_name_.IsDefault()) {
+    _impl_.ns_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.IPAddress.ns_name)
+}
+
+inline bool IPAddress::has_attached_to() const {
+  return attached_to_case() != ATTACHED_TO_NOT_SET;
+}
+inline void IPAddress::clear_has_attached_to() {
+  _impl_._oneof_case_[0] = ATTACHED_TO_NOT_SET;
+}
+inline IPAddress::AttachedToCase IPAddress::attached_to_case() const {
+  return IPAddress::AttachedToCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ipaddress_2eproto
@@ -0,0 +1,356 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: network.proto
+
+#include "network.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Lansnoop {
+PROTOBUF_CONSTEXPR Network::Network(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.fini_)*/false
+  , /*decltype(_impl_.merged_into_)*/0u
+  , /*decltype(_impl_.vlan_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NetworkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetworkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetworkDefaultTypeInternal() {}
+  union {
+    Network _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetworkDefaultTypeInternal _Network_default_instance_;
+}  // namespace Lansnoop
+static ::_pb::Metadata file_level_metadata_network_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_network_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_network_2eproto = nullptr;
+
+const uint32_t TableStruct_network_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Network, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Network, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Network, _impl_.fini_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Network, _impl_.merged_into_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Network, _impl_.vlan_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Lansnoop::Network)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Lansnoop::_Network_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_network_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rnetwork.proto\022\010Lansnoop\"F\n\007Network\022\n\n\002"
+  "id\030\001 \001(\r\022\014\n\004fini\030\002 \001(\010\022\023\n\013merged_into\030\003 "
+  "\001(\r\022\014\n\004vlan\030\004 \001(\rb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_network_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_network_2eproto = {
+    false, false, 105, descriptor_table_protodef_network_2eproto,
+    "network.proto",
+    &descriptor_table_network_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_network_2eproto::offsets,
+    file_level_metadata_network_2eproto, file_level_enum_descriptors_network_2eproto,
+    file_level_service_descriptors_network_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_network_2eproto_getter() {
+  return &descriptor_table_network_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_network_2eproto(&descriptor_table_network_2eproto);
+namespace Lansnoop {
+
+// ===================================================================
+
+class Network::_Internal {
+ public:
+};
+
+Network::Network(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.Network)
+}
+Network::Network(const Network& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Network* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.fini_){}
+    , decltype(_impl_.merged_into_){}
+    , decltype(_impl_.vlan_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.vlan_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.vlan_));
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.Network)
+}
+
+inline void Network::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){0u}
+    , decltype(_impl_.fini_){false}
+    , decltype(_impl_.merged_into_){0u}
+    , decltype(_impl_.vlan_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Network::~Network() {
+  // @@protoc_insertion_point(destructor:Lansnoop.Network)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Network::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Network::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Network::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.Network)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.vlan_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.vlan_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Network::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool fini = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.fini_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 merged_into = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.merged_into_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 vlan = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.vlan_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Network::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.Network)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_fini(), target);
+  }
+
+  // uint32 merged_into = 3;
+  if (this->_internal_merged_into() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_merged_into(), target);
+  }
+
+  // uint32 vlan = 4;
+  if (this->_internal_vlan() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_vlan(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.Network)
+  return target;
+}
+
+size_t Network::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.Network)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 merged_into = 3;
+  if (this->_internal_merged_into() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_merged_into());
+  }
+
+  // uint32 vlan = 4;
+  if (this->_internal_vlan() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vlan());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Network::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Network::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Network::GetClassData() const { return &_class_data_; }
+
+
+void Network::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Network*>(&to_msg);
+  auto& from = static_cast<const Network&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.Network)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_fini() != 0) {
+    _this->_internal_set_fini(from._internal_fini());
+  }
+  if (from._internal_merged_into() != 0) {
+    _this->_internal_set_merged_into(from._internal_merged_into());
+  }
+  if (from._internal_vlan() != 0) {
+    _this->_internal_set_vlan(from._internal_vlan());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Network::CopyFrom(const Network& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.Network)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Network::IsInitialized() const {
+  return true;
+}
+
+void Network::InternalSwap(Network* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Network, _impl_.vlan_)
+      + sizeof(Network::_impl_.vlan_)
+      - PROTOBUF_FIELD_OFFSET(Network, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Network::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_network_2eproto_getter, &descriptor_table_network_2eproto_once,
+      file_level_metadata_network_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Lansnoop::Network*
+Arena::CreateMaybeMessage< ::Lansnoop::Network >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Network >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
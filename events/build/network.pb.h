@@ -0,0 +1,340 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: network.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_network_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_network_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_network_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_network_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_network_2eproto;
+namespace Lansnoop {
+class Network;
+struct NetworkDefaultTypeInternal;
+extern NetworkDefaultTypeInternal _Network_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::Network* Arena::CreateMaybeMessage<::Lansnoop::Network>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+// ===================================================================
+
+class Network final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Network) */ {
+ public:
+  inline Network() : Network(nullptr) {}
+  ~Network() override;
+  explicit PROTOBUF_CONSTEXPR Network(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Network(const Network& from);
+  Network(Network&& from) noexcept
+    : Network() {
+    *this = ::std::move(from);
+  }
+
+  inline Network& operator=(const Network& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Network& operator=(Network&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Network& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Network* internal_default_instance() {
+    return reinterpret_cast<const Network*>(
+               &_Network_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Network& a, Network& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Network* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Network* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Network* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Network>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Network& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Network& from) {
+    Network::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Network* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Network";
+  }
+  protected:
+  explicit Network(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kFiniFieldNumber = 2,
+    kMergedIntoFieldNumber = 3,
+    kVlanFieldNumber = 4,
+  };
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // bool fini = 2;
+  void clear_fini();
+  bool fini() const;
+  void set_fini(bool value);
+  private:
+  bool _internal_fini() const;
+  void _internal_set_fini(bool value);
+  public:
+
+  // uint32 merged_into = 3;
+  void clear_merged_into();
+  uint32_t merged_into() const;
+  void set_merged_into(uint32_t value);
+  private:
+  uint32_t _internal_merged_into() const;
+  void _internal_set_merged_into(uint32_t value);
+  public:
+
+  // uint32 vlan = 4;
+  void clear_vlan();
+  uint32_t vlan() const;
+  void set_vlan(uint32_t value);
+  private:
+  uint32_t _internal_vlan() const;
+  void _internal_set_vlan(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.Network)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t id_;
+    bool fini_;
+    uint32_t merged_into_;
+    uint32_t vlan_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_network_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Network
+
+// uint32 id = 1;
+inline void Network::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t Network::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Network::id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Network.id)
+  return _internal_id();
+}
+inline void Network::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Network::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Network.id)
+}
+
+// bool fini = 2;
+inline void Network::clear_fini() {
+  _impl_.fini_ = false;
+}
+inline bool Network::_internal_fini() const {
+  return _impl_.fini_;
+}
+inline bool Network::fini() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Network.fini)
+  return _internal_fini();
+}
+inline void Network::_internal_set_fini(bool value) {
+  
+  _impl_.fini_ = value;
+}
+inline void Network::set_fini(bool value) {
+  _internal_set_fini(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Network.fini)
+}
+
+// uint32 merged_into = 3;
+inline void Network::clear_merged_into() {
+  _impl_.merged_into_ = 0u;
+}
+inline uint32_t Network::_internal_merged_into() const {
+  return _impl_.merged_into_;
+}
+inline uint32_t Network::merged_into() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Network.merged_into)
+  return _internal_merged_into();
+}
+inline void Network::_internal_set_merged_into(uint32_t value) {
+  
+  _impl_.merged_into_ = value;
+}
+inline void Network::set_merged_into(uint32_t value) {
+  _internal_set_merged_into(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Network.merged_into)
+}
+
+// uint32 vlan = 4;
+inline void Network::clear_vlan() {
+  _impl_.vlan_ = 0u;
+}
+inline uint32_t Network::_internal_vlan() const {
+  return _impl_.vlan_;
+}
+inline uint32_t Network::vlan() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Network.vlan)
+  return _internal_vlan();
+}
+inline void Network::_internal_set_vlan(uint32_t value) {
+  
+  _impl_.vlan_ = value;
+}
+inline void Network::set_vlan(uint32_t value) {
+  _internal_set_vlan(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Network.vlan)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_network_2eproto
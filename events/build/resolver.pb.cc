@@ -0,0 +1,429 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resolver.proto
+
+#include "resolver.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Lansnoop {
+PROTOBUF_CONSTEXPR Resolver::Resolver(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.latency_counts_)*/{}
+  , /*decltype(_impl_._latency_counts_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.fini_)*/false
+  , /*decltype(_impl_.latency_sum_usec_)*/uint64_t{0u}
+  , /*decltype(_impl_.timeouts_)*/uint64_t{0u}
+  , /*decltype(_impl_.ipaddress_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResolverDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResolverDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResolverDefaultTypeInternal() {}
+  union {
+    Resolver _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResolverDefaultTypeInternal _Resolver_default_instance_;
+}  // namespace Lansnoop
+static ::_pb::Metadata file_level_metadata_resolver_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_resolver_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_resolver_2eproto = nullptr;
+
+const uint32_t TableStruct_resolver_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Resolver, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Resolver, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Resolver, _impl_.fini_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Resolver, _impl_.ipaddress_id_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Resolver, _impl_.latency_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Resolver, _impl_.latency_sum_usec_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Resolver, _impl_.timeouts_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Lansnoop::Resolver)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Lansnoop::_Resolver_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resolver_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016resolver.proto\022\010Lansnoop\"~\n\010Resolver\022\n"
+  "\n\002id\030\001 \001(\r\022\014\n\004fini\030\002 \001(\010\022\024\n\014ipaddress_id"
+  "\030\003 \001(\r\022\026\n\016latency_counts\030\004 \003(\004\022\030\n\020latenc"
+  "y_sum_usec\030\005 \001(\004\022\020\n\010timeouts\030\006 \001(\004b\006prot"
+  "o3"
+  ;
+static ::_pbi::once_flag descriptor_table_resolver_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resolver_2eproto = {
+    false, false, 162, descriptor_table_protodef_resolver_2eproto,
+    "resolver.proto",
+    &descriptor_table_resolver_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_resolver_2eproto::offsets,
+    file_level_metadata_resolver_2eproto, file_level_enum_descriptors_resolver_2eproto,
+    file_level_service_descriptors_resolver_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resolver_2eproto_getter() {
+  return &descriptor_table_resolver_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resolver_2eproto(&descriptor_table_resolver_2eproto);
+namespace Lansnoop {
+
+// ===================================================================
+
+class Resolver::_Internal {
+ public:
+};
+
+Resolver::Resolver(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.Resolver)
+}
+Resolver::Resolver(const Resolver& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Resolver* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latency_counts_){from._impl_.latency_counts_}
+    , /*decltype(_impl_._latency_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.fini_){}
+    , decltype(_impl_.latency_sum_usec_){}
+    , decltype(_impl_.timeouts_){}
+    , decltype(_impl_.ipaddress_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ipaddress_id_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.ipaddress_id_));
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.Resolver)
+}
+
+inline void Resolver::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latency_counts_){arena}
+    , /*decltype(_impl_._latency_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.fini_){false}
+    , decltype(_impl_.latency_sum_usec_){uint64_t{0u}}
+    , decltype(_impl_.timeouts_){uint64_t{0u}}
+    , decltype(_impl_.ipaddress_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Resolver::~Resolver() {
+  // @@protoc_insertion_point(destructor:Lansnoop.Resolver)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Resolver::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.latency_counts_.~RepeatedField();
+}
+
+void Resolver::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Resolver::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.Resolver)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.latency_counts_.Clear();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ipaddress_id_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.ipaddress_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Resolver::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool fini = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.fini_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 ipaddress_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ipaddress_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 latency_counts = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_latency_counts(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_latency_counts(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_sum_usec = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.latency_sum_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 timeouts = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.timeouts_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Resolver::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.Resolver)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_fini(), target);
+  }
+
+  // uint32 ipaddress_id = 3;
+  if (this->_internal_ipaddress_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_ipaddress_id(), target);
+  }
+
+  // repeated uint64 latency_counts = 4;
+  {
+    int byte_size = _impl_._latency_counts_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          4, _internal_latency_counts(), byte_size, target);
+    }
+  }
+
+  // uint64 latency_sum_usec = 5;
+  if (this->_internal_latency_sum_usec() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_latency_sum_usec(), target);
+  }
+
+  // uint64 timeouts = 6;
+  if (this->_internal_timeouts() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_timeouts(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.Resolver)
+  return target;
+}
+
+size_t Resolver::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.Resolver)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 latency_counts = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.latency_counts_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._latency_counts_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  // bool fini = 2;
+  if (this->_internal_fini() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 latency_sum_usec = 5;
+  if (this->_internal_latency_sum_usec() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_sum_usec());
+  }
+
+  // uint64 timeouts = 6;
+  if (this->_internal_timeouts() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timeouts());
+  }
+
+  // uint32 ipaddress_id = 3;
+  if (this->_internal_ipaddress_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ipaddress_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Resolver::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Resolver::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Resolver::GetClassData() const { return &_class_data_; }
+
+
+void Resolver::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Resolver*>(&to_msg);
+  auto& from = static_cast<const Resolver&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.Resolver)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.latency_counts_.MergeFrom(from._impl_.latency_counts_);
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_fini() != 0) {
+    _this->_internal_set_fini(from._internal_fini());
+  }
+  if (from._internal_latency_sum_usec() != 0) {
+    _this->_internal_set_latency_sum_usec(from._internal_latency_sum_usec());
+  }
+  if (from._internal_timeouts() != 0) {
+    _this->_internal_set_timeouts(from._internal_timeouts());
+  }
+  if (from._internal_ipaddress_id() != 0) {
+    _this->_internal_set_ipaddress_id(from._internal_ipaddress_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Resolver::CopyFrom(const Resolver& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.Resolver)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Resolver::IsInitialized() const {
+  return true;
+}
+
+void Resolver::InternalSwap(Resolver* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.latency_counts_.InternalSwap(&other->_impl_.latency_counts_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Resolver, _impl_.ipaddress_id_)
+      + sizeof(Resolver::_impl_.ipaddress_id_)
+      - PROTOBUF_FIELD_OFFSET(Resolver, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Resolver::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resolver_2eproto_getter, &descriptor_table_resolver_2eproto_once,
+      file_level_metadata_resolver_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Lansnoop::Resolver*
+Arena::CreateMaybeMessage< ::Lansnoop::Resolver >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Resolver >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,443 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resolver.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resolver_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resolver_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resolver_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resolver_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resolver_2eproto;
+namespace Lansnoop {
+class Resolver;
+struct ResolverDefaultTypeInternal;
+extern ResolverDefaultTypeInternal _Resolver_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::Resolver* Arena::CreateMaybeMessage<::Lansnoop::Resolver>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+// ===================================================================
+
+class Resolver final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Resolver) */ {
+ public:
+  inline Resolver() : Resolver(nullptr) {}
+  ~Resolver() override;
+  explicit PROTOBUF_CONSTEXPR Resolver(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Resolver(const Resolver& from);
+  Resolver(Resolver&& from) noexcept
+    : Resolver() {
+    *this = ::std::move(from);
+  }
+
+  inline Resolver& operator=(const Resolver& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Resolver& operator=(Resolver&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Resolver& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Resolver* internal_default_instance() {
+    return reinterpret_cast<const Resolver*>(
+               &_Resolver_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Resolver& a, Resolver& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Resolver* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Resolver* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Resolver* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Resolver>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Resolver& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Resolver& from) {
+    Resolver::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Resolver* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Resolver";
+  }
+  protected:
+  explicit Resolver(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLatencyCountsFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kFiniFieldNumber = 2,
+    kLatencySumUsecFieldNumber = 5,
+    kTimeoutsFieldNumber = 6,
+    kIpaddressIdFieldNumber = 3,
+  };
+  // repeated uint64 latency_counts = 4;
+  int latency_counts_size() const;
+  private:
+  int _internal_latency_counts_size() const;
+  public:
+  void clear_latency_counts();
+  private:
+  uint64_t _internal_latency_counts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_latency_counts() const;
+  void _internal_add_latency_counts(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_latency_counts();
+  public:
+  uint64_t latency_counts(int index) const;
+  void set_latency_counts(int index, uint64_t value);
+  void add_latency_counts(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      latency_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_latency_counts();
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // bool fini = 2;
+  void clear_fini();
+  bool fini() const;
+  void set_fini(bool value);
+  private:
+  bool _internal_fini() const;
+  void _internal_set_fini(bool value);
+  public:
+
+  // uint64 latency_sum_usec = 5;
+  void clear_latency_sum_usec();
+  uint64_t latency_sum_usec() const;
+  void set_latency_sum_usec(uint64_t value);
+  private:
+  uint64_t _internal_latency_sum_usec() const;
+  void _internal_set_latency_sum_usec(uint64_t value);
+  public:
+
+  // uint64 timeouts = 6;
+  void clear_timeouts();
+  uint64_t timeouts() const;
+  void set_timeouts(uint64_t value);
+  private:
+  uint64_t _internal_timeouts() const;
+  void _internal_set_timeouts(uint64_t value);
+  public:
+
+  // uint32 ipaddress_id = 3;
+  void clear_ipaddress_id();
+  uint32_t ipaddress_id() const;
+  void set_ipaddress_id(uint32_t value);
+  private:
+  uint32_t _internal_ipaddress_id() const;
+  void _internal_set_ipaddress_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.Resolver)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > latency_counts_;
+    mutable std::atomic<int> _latency_counts_cached_byte_size_;
+    uint32_t id_;
+    bool fini_;
+    uint64_t latency_sum_usec_;
+    uint64_t timeouts_;
+    uint32_t ipaddress_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resolver_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Resolver
+
+// uint32 id = 1;
+inline void Resolver::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t Resolver::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Resolver::id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Resolver.id)
+  return _internal_id();
+}
+inline void Resolver::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Resolver::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Resolver.id)
+}
+
+// bool fini = 2;
+inline void Resolver::clear_fini() {
+  _impl_.fini_ = false;
+}
+inline bool Resolver::_internal_fini() const {
+  return _impl_.fini_;
+}
+inline bool Resolver::fini() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Resolver.fini)
+  return _internal_fini();
+}
+inline void Resolver::_internal_set_fini(bool value) {
+  
+  _impl_.fini_ = value;
+}
+inline void Resolver::set_fini(bool value) {
+  _internal_set_fini(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Resolver.fini)
+}
+
+// uint32 ipaddress_id = 3;
+inline void Resolver::clear_ipaddress_id() {
+  _impl_.ipaddress_id_ = 0u;
+}
+inline uint32_t Resolver::_internal_ipaddress_id() const {
+  return _impl_.ipaddress_id_;
+}
+inline uint32_t Resolver::ipaddress_id() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Resolver.ipaddress_id)
+  return _internal_ipaddress_id();
+}
+inline void Resolver::_internal_set_ipaddress_id(uint32_t value) {
+  
+  _impl_.ipaddress_id_ = value;
+}
+inline void Resolver::set_ipaddress_id(uint32_t value) {
+  _internal_set_ipaddress_id(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Resolver.ipaddress_id)
+}
+
+// repeated uint64 latency_counts = 4;
+inline int Resolver::_internal_latency_counts_size() const {
+  return _impl_.latency_counts_.size();
+}
+inline int Resolver::latency_counts_size() const {
+  return _internal_latency_counts_size();
+}
+inline void Resolver::clear_latency_counts() {
+  _impl_.latency_counts_.Clear();
+}
+inline uint64_t Resolver::_internal_latency_counts(int index) const {
+  return _impl_.latency_counts_.Get(index);
+}
+inline uint64_t Resolver::latency_counts(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Resolver.latency_counts)
+  return _internal_latency_counts(index);
+}
+inline void Resolver::set_latency_counts(int index, uint64_t value) {
+  _impl_.latency_counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Resolver.latency_counts)
+}
+inline void Resolver::_internal_add_latency_counts(uint64_t value) {
+  _impl_.latency_counts_.Add(value);
+}
+inline void Resolver::add_latency_counts(uint64_t value) {
+  _internal_add_latency_counts(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.Resolver.latency_counts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Resolver::_internal_latency_counts() const {
+  return _impl_.latency_counts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Resolver::latency_counts() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.Resolver.latency_counts)
+  return _internal_latency_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Resolver::_internal_mutable_latency_counts() {
+  return &_impl_.latency_counts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Resolver::mutable_latency_counts() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.Resolver.latency_counts)
+  return _internal_mutable_latency_counts();
+}
+
+// uint64 latency_sum_usec = 5;
+inline void Resolver::clear_latency_sum_usec() {
+  _impl_.latency_sum_usec_ = uint64_t{0u};
+}
+inline uint64_t Resolver::_internal_latency_sum_usec() const {
+  return _impl_.latency_sum_usec_;
+}
+inline uint64_t Resolver::latency_sum_usec() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Resolver.latency_sum_usec)
+  return _internal_latency_sum_usec();
+}
+inline void Resolver::_internal_set_latency_sum_usec(uint64_t value) {
+  
+  _impl_.latency_sum_usec_ = value;
+}
+inline void Resolver::set_latency_sum_usec(uint64_t value) {
+  _internal_set_latency_sum_usec(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Resolver.latency_sum_usec)
+}
+
+// uint64 timeouts = 6;
+inline void Resolver::clear_timeouts() {
+  _impl_.timeouts_ = uint64_t{0u};
+}
+inline uint64_t Resolver::_internal_timeouts() const {
+  return _impl_.timeouts_;
+}
+inline uint64_t Resolver::timeouts() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Resolver.timeouts)
+  return _internal_timeouts();
+}
+inline void Resolver::_internal_set_timeouts(uint64_t value) {
+  
+  _impl_.timeouts_ = value;
+}
+inline void Resolver::set_timeouts(uint64_t value) {
+  _internal_set_timeouts(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Resolver.timeouts)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resolver_2eproto
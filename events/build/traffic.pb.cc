@@ -0,0 +1,2800 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: traffic.proto
+
+#include "traffic.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Lansnoop {
+PROTOBUF_CONSTEXPR Rate::Rate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.packets_per_second_)*/0
+  , /*decltype(_impl_.bits_per_second_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RateDefaultTypeInternal() {}
+  union {
+    Rate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RateDefaultTypeInternal _Rate_default_instance_;
+PROTOBUF_CONSTEXPR TrafficDeltas::TrafficDeltas(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ids_)*/{}
+  , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.packets_)*/{}
+  , /*decltype(_impl_._packets_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bytes_)*/{}
+  , /*decltype(_impl_._bytes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.rate_ids_)*/{}
+  , /*decltype(_impl_._rate_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.packets_per_second_)*/{}
+  , /*decltype(_impl_.bits_per_second_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TrafficDeltasDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TrafficDeltasDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TrafficDeltasDefaultTypeInternal() {}
+  union {
+    TrafficDeltas _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrafficDeltasDefaultTypeInternal _TrafficDeltas_default_instance_;
+PROTOBUF_CONSTEXPR ConnectionCountArrays::ConnectionCountArrays(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ids_)*/{}
+  , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.a_packets_)*/{}
+  , /*decltype(_impl_._a_packets_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.b_packets_)*/{}
+  , /*decltype(_impl_._b_packets_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.a_bytes_)*/{}
+  , /*decltype(_impl_._a_bytes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.b_bytes_)*/{}
+  , /*decltype(_impl_._b_bytes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConnectionCountArraysDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConnectionCountArraysDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConnectionCountArraysDefaultTypeInternal() {}
+  union {
+    ConnectionCountArrays _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConnectionCountArraysDefaultTypeInternal _ConnectionCountArrays_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_InterfacePacketCountsEntry_DoNotUse::Traffic_InterfacePacketCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_InterfacePacketCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_InterfacePacketCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_InterfacePacketCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_InterfacePacketCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_InterfacePacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_InterfacePacketCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_CloudPacketCountsEntry_DoNotUse::Traffic_CloudPacketCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_CloudPacketCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_CloudPacketCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_CloudPacketCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_CloudPacketCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_CloudPacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_CloudPacketCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_IpaddressPacketCountsEntry_DoNotUse::Traffic_IpaddressPacketCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_IpaddressPacketCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_IpaddressPacketCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_IpaddressPacketCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_IpaddressPacketCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_IpaddressPacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_IpaddressPacketCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_VlanPacketCountsEntry_DoNotUse::Traffic_VlanPacketCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_VlanPacketCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_VlanPacketCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_VlanPacketCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_VlanPacketCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_VlanPacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_VlanPacketCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_ConnectionCountsEntry_DoNotUse::Traffic_ConnectionCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_ConnectionCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_ConnectionCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_ConnectionCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_ConnectionCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_ConnectionCountsEntry_DoNotUseDefaultTypeInternal _Traffic_ConnectionCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_InterfaceByteCountsEntry_DoNotUse::Traffic_InterfaceByteCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_InterfaceByteCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_InterfaceByteCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_InterfaceByteCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_InterfaceByteCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_InterfaceByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_InterfaceByteCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_CloudByteCountsEntry_DoNotUse::Traffic_CloudByteCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_CloudByteCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_CloudByteCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_CloudByteCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_CloudByteCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_CloudByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_CloudByteCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_IpaddressByteCountsEntry_DoNotUse::Traffic_IpaddressByteCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_IpaddressByteCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_IpaddressByteCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_IpaddressByteCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_IpaddressByteCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_IpaddressByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_IpaddressByteCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_VlanByteCountsEntry_DoNotUse::Traffic_VlanByteCountsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_VlanByteCountsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_VlanByteCountsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_VlanByteCountsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_VlanByteCountsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_VlanByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_VlanByteCountsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_InterfaceRatesEntry_DoNotUse::Traffic_InterfaceRatesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_InterfaceRatesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_InterfaceRatesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_InterfaceRatesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_InterfaceRatesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_InterfaceRatesEntry_DoNotUseDefaultTypeInternal _Traffic_InterfaceRatesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_CloudRatesEntry_DoNotUse::Traffic_CloudRatesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_CloudRatesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_CloudRatesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_CloudRatesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_CloudRatesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_CloudRatesEntry_DoNotUseDefaultTypeInternal _Traffic_CloudRatesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_IpaddressRatesEntry_DoNotUse::Traffic_IpaddressRatesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_IpaddressRatesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_IpaddressRatesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_IpaddressRatesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_IpaddressRatesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_IpaddressRatesEntry_DoNotUseDefaultTypeInternal _Traffic_IpaddressRatesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic_VlanRatesEntry_DoNotUse::Traffic_VlanRatesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Traffic_VlanRatesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Traffic_VlanRatesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Traffic_VlanRatesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Traffic_VlanRatesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Traffic_VlanRatesEntry_DoNotUseDefaultTypeInternal _Traffic_VlanRatesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Traffic::Traffic(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.interface_packet_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.cloud_packet_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.ipaddress_packet_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.vlan_packet_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.connection_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.interface_byte_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.cloud_byte_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.ipaddress_byte_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.vlan_byte_counts_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.interface_rates_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.cloud_rates_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.ipaddress_rates_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.vlan_rates_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.interfaces_)*/nullptr
+  , /*decltype(_impl_.clouds_)*/nullptr
+  , /*decltype(_impl_.ipaddresses_)*/nullptr
+  , /*decltype(_impl_.vlans_)*/nullptr
+  , /*decltype(_impl_.connections_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TrafficDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TrafficDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TrafficDefaultTypeInternal() {}
+  union {
+    Traffic _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrafficDefaultTypeInternal _Traffic_default_instance_;
+}  // namespace Lansnoop
+static ::_pb::Metadata file_level_metadata_traffic_2eproto[17];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_traffic_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_traffic_2eproto = nullptr;
+
+const uint32_t TableStruct_traffic_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Rate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Rate, _impl_.packets_per_second_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Rate, _impl_.bits_per_second_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::TrafficDeltas, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::TrafficDeltas, _impl_.ids_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::TrafficDeltas, _impl_.packets_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::TrafficDeltas, _impl_.bytes_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::TrafficDeltas, _impl_.rate_ids_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::TrafficDeltas, _impl_.packets_per_second_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::TrafficDeltas, _impl_.bits_per_second_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCountArrays, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCountArrays, _impl_.ids_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCountArrays, _impl_.a_packets_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCountArrays, _impl_.b_packets_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCountArrays, _impl_.a_bytes_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::ConnectionCountArrays, _impl_.b_bytes_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudRatesEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudRatesEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudRatesEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_CloudRatesEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanRatesEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanRatesEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanRatesEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic_VlanRatesEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.interface_packet_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.cloud_packet_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.ipaddress_packet_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.vlan_packet_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.connection_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.interface_byte_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.cloud_byte_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.ipaddress_byte_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.vlan_byte_counts_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.interface_rates_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.cloud_rates_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.ipaddress_rates_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.vlan_rates_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.interfaces_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.clouds_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.ipaddresses_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.vlans_),
+  PROTOBUF_FIELD_OFFSET(::Lansnoop::Traffic, _impl_.connections_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Lansnoop::Rate)},
+  { 8, -1, -1, sizeof(::Lansnoop::TrafficDeltas)},
+  { 20, -1, -1, sizeof(::Lansnoop::ConnectionCountArrays)},
+  { 31, 39, -1, sizeof(::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse)},
+  { 41, 49, -1, sizeof(::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse)},
+  { 51, 59, -1, sizeof(::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse)},
+  { 61, 69, -1, sizeof(::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse)},
+  { 71, 79, -1, sizeof(::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse)},
+  { 81, 89, -1, sizeof(::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse)},
+  { 91, 99, -1, sizeof(::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse)},
+  { 101, 109, -1, sizeof(::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse)},
+  { 111, 119, -1, sizeof(::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse)},
+  { 121, 129, -1, sizeof(::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse)},
+  { 131, 139, -1, sizeof(::Lansnoop::Traffic_CloudRatesEntry_DoNotUse)},
+  { 141, 149, -1, sizeof(::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse)},
+  { 151, 159, -1, sizeof(::Lansnoop::Traffic_VlanRatesEntry_DoNotUse)},
+  { 161, -1, -1, sizeof(::Lansnoop::Traffic)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Lansnoop::_Rate_default_instance_._instance,
+  &::Lansnoop::_TrafficDeltas_default_instance_._instance,
+  &::Lansnoop::_ConnectionCountArrays_default_instance_._instance,
+  &::Lansnoop::_Traffic_InterfacePacketCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_CloudPacketCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_IpaddressPacketCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_VlanPacketCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_ConnectionCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_InterfaceByteCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_CloudByteCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_IpaddressByteCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_VlanByteCountsEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_InterfaceRatesEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_CloudRatesEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_IpaddressRatesEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_VlanRatesEntry_DoNotUse_default_instance_._instance,
+  &::Lansnoop::_Traffic_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_traffic_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rtraffic.proto\022\010Lansnoop\032\020connection.pr"
+  "oto\";\n\004Rate\022\032\n\022packets_per_second\030\001 \001(\002\022"
+  "\027\n\017bits_per_second\030\002 \001(\002\"\203\001\n\rTrafficDelt"
+  "as\022\013\n\003ids\030\001 \003(\r\022\017\n\007packets\030\002 \003(\004\022\r\n\005byte"
+  "s\030\003 \003(\004\022\020\n\010rate_ids\030\004 \003(\r\022\032\n\022packets_per"
+  "_second\030\005 \003(\002\022\027\n\017bits_per_second\030\006 \003(\002\"l"
+  "\n\025ConnectionCountArrays\022\013\n\003ids\030\001 \003(\r\022\021\n\t"
+  "a_packets\030\002 \003(\004\022\021\n\tb_packets\030\003 \003(\004\022\017\n\007a_"
+  "bytes\030\004 \003(\004\022\017\n\007b_bytes\030\005 \003(\004\"\237\017\n\007Traffic"
+  "\022M\n\027interface_packet_counts\030\001 \003(\0132,.Lans"
+  "noop.Traffic.InterfacePacketCountsEntry\022"
+  "E\n\023cloud_packet_counts\030\002 \003(\0132(.Lansnoop."
+  "Traffic.CloudPacketCountsEntry\022M\n\027ipaddr"
+  "ess_packet_counts\030\003 \003(\0132,.Lansnoop.Traff"
+  "ic.IpaddressPacketCountsEntry\022C\n\022vlan_pa"
+  "cket_counts\030\004 \003(\0132\'.Lansnoop.Traffic.Vla"
+  "nPacketCountsEntry\022B\n\021connection_counts\030"
+  "\005 \003(\0132\'.Lansnoop.Traffic.ConnectionCount"
+  "sEntry\022I\n\025interface_byte_counts\030\006 \003(\0132*."
+  "Lansnoop.Traffic.InterfaceByteCountsEntr"
+  "y\022A\n\021cloud_byte_counts\030\007 \003(\0132&.Lansnoop."
+  "Traffic.CloudByteCountsEntry\022I\n\025ipaddres"
+  "s_byte_counts\030\010 \003(\0132*.Lansnoop.Traffic.I"
+  "paddressByteCountsEntry\022\?\n\020vlan_byte_cou"
+  "nts\030\t \003(\0132%.Lansnoop.Traffic.VlanByteCou"
+  "ntsEntry\022>\n\017interface_rates\030\n \003(\0132%.Lans"
+  "noop.Traffic.InterfaceRatesEntry\0226\n\013clou"
+  "d_rates\030\013 \003(\0132!.Lansnoop.Traffic.CloudRa"
+  "tesEntry\022>\n\017ipaddress_rates\030\014 \003(\0132%.Lans"
+  "noop.Traffic.IpaddressRatesEntry\0224\n\nvlan"
+  "_rates\030\r \003(\0132 .Lansnoop.Traffic.VlanRate"
+  "sEntry\022+\n\ninterfaces\030\016 \001(\0132\027.Lansnoop.Tr"
+  "afficDeltas\022\'\n\006clouds\030\017 \001(\0132\027.Lansnoop.T"
+  "rafficDeltas\022,\n\013ipaddresses\030\020 \001(\0132\027.Lans"
+  "noop.TrafficDeltas\022&\n\005vlans\030\021 \001(\0132\027.Lans"
+  "noop.TrafficDeltas\0224\n\013connections\030\022 \001(\0132"
+  "\037.Lansnoop.ConnectionCountArrays\032<\n\032Inte"
+  "rfacePacketCountsEntry\022\013\n\003key\030\001 \001(\r\022\r\n\005v"
+  "alue\030\002 \001(\004:\0028\001\0328\n\026CloudPacketCountsEntry"
+  "\022\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\004:\0028\001\032<\n\032Ipad"
+  "dressPacketCountsEntry\022\013\n\003key\030\001 \001(\r\022\r\n\005v"
+  "alue\030\002 \001(\004:\0028\001\0327\n\025VlanPacketCountsEntry\022"
+  "\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\004:\0028\001\032S\n\025Conne"
+  "ctionCountsEntry\022\013\n\003key\030\001 \001(\r\022)\n\005value\030\002"
+  " \001(\0132\032.Lansnoop.ConnectionCounts:\0028\001\032:\n\030"
+  "InterfaceByteCountsEntry\022\013\n\003key\030\001 \001(\r\022\r\n"
+  "\005value\030\002 \001(\004:\0028\001\0326\n\024CloudByteCountsEntry"
+  "\022\013\n\003key\030\001 \001(\r\022\r\n\005value\030\002 \001(\004:\0028\001\032:\n\030Ipad"
+  "dressByteCountsEntry\022\013\n\003key\030\001 \001(\r\022\r\n\005val"
+  "ue\030\002 \001(\004:\0028\001\0325\n\023VlanByteCountsEntry\022\013\n\003k"
+  "ey\030\001 \001(\r\022\r\n\005value\030\002 \001(\004:\0028\001\032E\n\023Interface"
+  "RatesEntry\022\013\n\003key\030\001 \001(\r\022\035\n\005value\030\002 \001(\0132\016"
+  ".Lansnoop.Rate:\0028\001\032A\n\017CloudRatesEntry\022\013\n"
+  "\003key\030\001 \001(\r\022\035\n\005value\030\002 \001(\0132\016.Lansnoop.Rat"
+  "e:\0028\001\032E\n\023IpaddressRatesEntry\022\013\n\003key\030\001 \001("
+  "\r\022\035\n\005value\030\002 \001(\0132\016.Lansnoop.Rate:\0028\001\032@\n\016"
+  "VlanRatesEntry\022\013\n\003key\030\001 \001(\r\022\035\n\005value\030\002 \001"
+  "(\0132\016.Lansnoop.Rate:\0028\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_traffic_2eproto_deps[1] = {
+  &::descriptor_table_connection_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_traffic_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_traffic_2eproto = {
+    false, false, 2310, descriptor_table_protodef_traffic_2eproto,
+    "traffic.proto",
+    &descriptor_table_traffic_2eproto_once, descriptor_table_traffic_2eproto_deps, 1, 17,
+    schemas, file_default_instances, TableStruct_traffic_2eproto::offsets,
+    file_level_metadata_traffic_2eproto, file_level_enum_descriptors_traffic_2eproto,
+    file_level_service_descriptors_traffic_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_traffic_2eproto_getter() {
+  return &descriptor_table_traffic_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_traffic_2eproto(&descriptor_table_traffic_2eproto);
+namespace Lansnoop {
+
+// ===================================================================
+
+class Rate::_Internal {
+ public:
+};
+
+Rate::Rate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.Rate)
+}
+Rate::Rate(const Rate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Rate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.packets_per_second_){}
+    , decltype(_impl_.bits_per_second_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.packets_per_second_, &from._impl_.packets_per_second_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bits_per_second_) -
+    reinterpret_cast<char*>(&_impl_.packets_per_second_)) + sizeof(_impl_.bits_per_second_));
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.Rate)
+}
+
+inline void Rate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.packets_per_second_){0}
+    , decltype(_impl_.bits_per_second_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Rate::~Rate() {
+  // @@protoc_insertion_point(destructor:Lansnoop.Rate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Rate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Rate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Rate::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.Rate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.packets_per_second_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.bits_per_second_) -
+      reinterpret_cast<char*>(&_impl_.packets_per_second_)) + sizeof(_impl_.bits_per_second_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Rate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float packets_per_second = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.packets_per_second_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float bits_per_second = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.bits_per_second_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Rate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.Rate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float packets_per_second = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_packets_per_second = this->_internal_packets_per_second();
+  uint32_t raw_packets_per_second;
+  memcpy(&raw_packets_per_second, &tmp_packets_per_second, sizeof(tmp_packets_per_second));
+  if (raw_packets_per_second != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_packets_per_second(), target);
+  }
+
+  // float bits_per_second = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_bits_per_second = this->_internal_bits_per_second();
+  uint32_t raw_bits_per_second;
+  memcpy(&raw_bits_per_second, &tmp_bits_per_second, sizeof(tmp_bits_per_second));
+  if (raw_bits_per_second != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_bits_per_second(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.Rate)
+  return target;
+}
+
+size_t Rate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.Rate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float packets_per_second = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_packets_per_second = this->_internal_packets_per_second();
+  uint32_t raw_packets_per_second;
+  memcpy(&raw_packets_per_second, &tmp_packets_per_second, sizeof(tmp_packets_per_second));
+  if (raw_packets_per_second != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float bits_per_second = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_bits_per_second = this->_internal_bits_per_second();
+  uint32_t raw_bits_per_second;
+  memcpy(&raw_bits_per_second, &tmp_bits_per_second, sizeof(tmp_bits_per_second));
+  if (raw_bits_per_second != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Rate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Rate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Rate::GetClassData() const { return &_class_data_; }
+
+
+void Rate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Rate*>(&to_msg);
+  auto& from = static_cast<const Rate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.Rate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_packets_per_second = from._internal_packets_per_second();
+  uint32_t raw_packets_per_second;
+  memcpy(&raw_packets_per_second, &tmp_packets_per_second, sizeof(tmp_packets_per_second));
+  if (raw_packets_per_second != 0) {
+    _this->_internal_set_packets_per_second(from._internal_packets_per_second());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_bits_per_second = from._internal_bits_per_second();
+  uint32_t raw_bits_per_second;
+  memcpy(&raw_bits_per_second, &tmp_bits_per_second, sizeof(tmp_bits_per_second));
+  if (raw_bits_per_second != 0) {
+    _this->_internal_set_bits_per_second(from._internal_bits_per_second());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Rate::CopyFrom(const Rate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.Rate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Rate::IsInitialized() const {
+  return true;
+}
+
+void Rate::InternalSwap(Rate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Rate, _impl_.bits_per_second_)
+      + sizeof(Rate::_impl_.bits_per_second_)
+      - PROTOBUF_FIELD_OFFSET(Rate, _impl_.packets_per_second_)>(
+          reinterpret_cast<char*>(&_impl_.packets_per_second_),
+          reinterpret_cast<char*>(&other->_impl_.packets_per_second_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Rate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[0]);
+}
+
+// ===================================================================
+
+class TrafficDeltas::_Internal {
+ public:
+};
+
+TrafficDeltas::TrafficDeltas(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.TrafficDeltas)
+}
+TrafficDeltas::TrafficDeltas(const TrafficDeltas& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TrafficDeltas* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ids_){from._impl_.ids_}
+    , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.packets_){from._impl_.packets_}
+    , /*decltype(_impl_._packets_cached_byte_size_)*/{0}
+    , decltype(_impl_.bytes_){from._impl_.bytes_}
+    , /*decltype(_impl_._bytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.rate_ids_){from._impl_.rate_ids_}
+    , /*decltype(_impl_._rate_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.packets_per_second_){from._impl_.packets_per_second_}
+    , decltype(_impl_.bits_per_second_){from._impl_.bits_per_second_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.TrafficDeltas)
+}
+
+inline void TrafficDeltas::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ids_){arena}
+    , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.packets_){arena}
+    , /*decltype(_impl_._packets_cached_byte_size_)*/{0}
+    , decltype(_impl_.bytes_){arena}
+    , /*decltype(_impl_._bytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.rate_ids_){arena}
+    , /*decltype(_impl_._rate_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.packets_per_second_){arena}
+    , decltype(_impl_.bits_per_second_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TrafficDeltas::~TrafficDeltas() {
+  // @@protoc_insertion_point(destructor:Lansnoop.TrafficDeltas)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TrafficDeltas::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ids_.~RepeatedField();
+  _impl_.packets_.~RepeatedField();
+  _impl_.bytes_.~RepeatedField();
+  _impl_.rate_ids_.~RepeatedField();
+  _impl_.packets_per_second_.~RepeatedField();
+  _impl_.bits_per_second_.~RepeatedField();
+}
+
+void TrafficDeltas::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TrafficDeltas::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.TrafficDeltas)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ids_.Clear();
+  _impl_.packets_.Clear();
+  _impl_.bytes_.Clear();
+  _impl_.rate_ids_.Clear();
+  _impl_.packets_per_second_.Clear();
+  _impl_.bits_per_second_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrafficDeltas::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 packets = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_packets(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_packets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 bytes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_bytes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_bytes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 rate_ids = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_rate_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_rate_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float packets_per_second = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_packets_per_second(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 45) {
+          _internal_add_packets_per_second(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float bits_per_second = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_bits_per_second(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 53) {
+          _internal_add_bits_per_second(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TrafficDeltas::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.TrafficDeltas)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 ids = 1;
+  {
+    int byte_size = _impl_._ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_ids(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 packets = 2;
+  {
+    int byte_size = _impl_._packets_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          2, _internal_packets(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 bytes = 3;
+  {
+    int byte_size = _impl_._bytes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          3, _internal_bytes(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 rate_ids = 4;
+  {
+    int byte_size = _impl_._rate_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_rate_ids(), byte_size, target);
+    }
+  }
+
+  // repeated float packets_per_second = 5;
+  if (this->_internal_packets_per_second_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_packets_per_second(), target);
+  }
+
+  // repeated float bits_per_second = 6;
+  if (this->_internal_bits_per_second_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_bits_per_second(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.TrafficDeltas)
+  return target;
+}
+
+size_t TrafficDeltas::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.TrafficDeltas)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 packets = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.packets_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._packets_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 bytes = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.bytes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bytes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 rate_ids = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.rate_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._rate_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float packets_per_second = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_packets_per_second_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float bits_per_second = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_bits_per_second_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TrafficDeltas::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TrafficDeltas::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrafficDeltas::GetClassData() const { return &_class_data_; }
+
+
+void TrafficDeltas::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TrafficDeltas*>(&to_msg);
+  auto& from = static_cast<const TrafficDeltas&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.TrafficDeltas)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ids_.MergeFrom(from._impl_.ids_);
+  _this->_impl_.packets_.MergeFrom(from._impl_.packets_);
+  _this->_impl_.bytes_.MergeFrom(from._impl_.bytes_);
+  _this->_impl_.rate_ids_.MergeFrom(from._impl_.rate_ids_);
+  _this->_impl_.packets_per_second_.MergeFrom(from._impl_.packets_per_second_);
+  _this->_impl_.bits_per_second_.MergeFrom(from._impl_.bits_per_second_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TrafficDeltas::CopyFrom(const TrafficDeltas& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.TrafficDeltas)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrafficDeltas::IsInitialized() const {
+  return true;
+}
+
+void TrafficDeltas::InternalSwap(TrafficDeltas* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ids_.InternalSwap(&other->_impl_.ids_);
+  _impl_.packets_.InternalSwap(&other->_impl_.packets_);
+  _impl_.bytes_.InternalSwap(&other->_impl_.bytes_);
+  _impl_.rate_ids_.InternalSwap(&other->_impl_.rate_ids_);
+  _impl_.packets_per_second_.InternalSwap(&other->_impl_.packets_per_second_);
+  _impl_.bits_per_second_.InternalSwap(&other->_impl_.bits_per_second_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrafficDeltas::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[1]);
+}
+
+// ===================================================================
+
+class ConnectionCountArrays::_Internal {
+ public:
+};
+
+ConnectionCountArrays::ConnectionCountArrays(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.ConnectionCountArrays)
+}
+ConnectionCountArrays::ConnectionCountArrays(const ConnectionCountArrays& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConnectionCountArrays* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ids_){from._impl_.ids_}
+    , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.a_packets_){from._impl_.a_packets_}
+    , /*decltype(_impl_._a_packets_cached_byte_size_)*/{0}
+    , decltype(_impl_.b_packets_){from._impl_.b_packets_}
+    , /*decltype(_impl_._b_packets_cached_byte_size_)*/{0}
+    , decltype(_impl_.a_bytes_){from._impl_.a_bytes_}
+    , /*decltype(_impl_._a_bytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.b_bytes_){from._impl_.b_bytes_}
+    , /*decltype(_impl_._b_bytes_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.ConnectionCountArrays)
+}
+
+inline void ConnectionCountArrays::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ids_){arena}
+    , /*decltype(_impl_._ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.a_packets_){arena}
+    , /*decltype(_impl_._a_packets_cached_byte_size_)*/{0}
+    , decltype(_impl_.b_packets_){arena}
+    , /*decltype(_impl_._b_packets_cached_byte_size_)*/{0}
+    , decltype(_impl_.a_bytes_){arena}
+    , /*decltype(_impl_._a_bytes_cached_byte_size_)*/{0}
+    , decltype(_impl_.b_bytes_){arena}
+    , /*decltype(_impl_._b_bytes_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ConnectionCountArrays::~ConnectionCountArrays() {
+  // @@protoc_insertion_point(destructor:Lansnoop.ConnectionCountArrays)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConnectionCountArrays::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ids_.~RepeatedField();
+  _impl_.a_packets_.~RepeatedField();
+  _impl_.b_packets_.~RepeatedField();
+  _impl_.a_bytes_.~RepeatedField();
+  _impl_.b_bytes_.~RepeatedField();
+}
+
+void ConnectionCountArrays::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConnectionCountArrays::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.ConnectionCountArrays)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ids_.Clear();
+  _impl_.a_packets_.Clear();
+  _impl_.b_packets_.Clear();
+  _impl_.a_bytes_.Clear();
+  _impl_.b_bytes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConnectionCountArrays::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 a_packets = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_a_packets(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_a_packets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 b_packets = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_b_packets(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_b_packets(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 a_bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_a_bytes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_a_bytes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 b_bytes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_b_bytes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_b_bytes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConnectionCountArrays::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.ConnectionCountArrays)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 ids = 1;
+  {
+    int byte_size = _impl_._ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_ids(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 a_packets = 2;
+  {
+    int byte_size = _impl_._a_packets_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          2, _internal_a_packets(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 b_packets = 3;
+  {
+    int byte_size = _impl_._b_packets_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          3, _internal_b_packets(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 a_bytes = 4;
+  {
+    int byte_size = _impl_._a_bytes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          4, _internal_a_bytes(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 b_bytes = 5;
+  {
+    int byte_size = _impl_._b_bytes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          5, _internal_b_bytes(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.ConnectionCountArrays)
+  return target;
+}
+
+size_t ConnectionCountArrays::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.ConnectionCountArrays)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 a_packets = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.a_packets_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._a_packets_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 b_packets = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.b_packets_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._b_packets_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 a_bytes = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.a_bytes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._a_bytes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 b_bytes = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.b_bytes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._b_bytes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConnectionCountArrays::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConnectionCountArrays::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConnectionCountArrays::GetClassData() const { return &_class_data_; }
+
+
+void ConnectionCountArrays::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConnectionCountArrays*>(&to_msg);
+  auto& from = static_cast<const ConnectionCountArrays&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.ConnectionCountArrays)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ids_.MergeFrom(from._impl_.ids_);
+  _this->_impl_.a_packets_.MergeFrom(from._impl_.a_packets_);
+  _this->_impl_.b_packets_.MergeFrom(from._impl_.b_packets_);
+  _this->_impl_.a_bytes_.MergeFrom(from._impl_.a_bytes_);
+  _this->_impl_.b_bytes_.MergeFrom(from._impl_.b_bytes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConnectionCountArrays::CopyFrom(const ConnectionCountArrays& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.ConnectionCountArrays)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConnectionCountArrays::IsInitialized() const {
+  return true;
+}
+
+void ConnectionCountArrays::InternalSwap(ConnectionCountArrays* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ids_.InternalSwap(&other->_impl_.ids_);
+  _impl_.a_packets_.InternalSwap(&other->_impl_.a_packets_);
+  _impl_.b_packets_.InternalSwap(&other->_impl_.b_packets_);
+  _impl_.a_bytes_.InternalSwap(&other->_impl_.a_bytes_);
+  _impl_.b_bytes_.InternalSwap(&other->_impl_.b_bytes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConnectionCountArrays::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[2]);
+}
+
+// ===================================================================
+
+Traffic_InterfacePacketCountsEntry_DoNotUse::Traffic_InterfacePacketCountsEntry_DoNotUse() {}
+Traffic_InterfacePacketCountsEntry_DoNotUse::Traffic_InterfacePacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_InterfacePacketCountsEntry_DoNotUse::MergeFrom(const Traffic_InterfacePacketCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_InterfacePacketCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[3]);
+}
+
+// ===================================================================
+
+Traffic_CloudPacketCountsEntry_DoNotUse::Traffic_CloudPacketCountsEntry_DoNotUse() {}
+Traffic_CloudPacketCountsEntry_DoNotUse::Traffic_CloudPacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_CloudPacketCountsEntry_DoNotUse::MergeFrom(const Traffic_CloudPacketCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_CloudPacketCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[4]);
+}
+
+// ===================================================================
+
+Traffic_IpaddressPacketCountsEntry_DoNotUse::Traffic_IpaddressPacketCountsEntry_DoNotUse() {}
+Traffic_IpaddressPacketCountsEntry_DoNotUse::Traffic_IpaddressPacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_IpaddressPacketCountsEntry_DoNotUse::MergeFrom(const Traffic_IpaddressPacketCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_IpaddressPacketCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[5]);
+}
+
+// ===================================================================
+
+Traffic_VlanPacketCountsEntry_DoNotUse::Traffic_VlanPacketCountsEntry_DoNotUse() {}
+Traffic_VlanPacketCountsEntry_DoNotUse::Traffic_VlanPacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_VlanPacketCountsEntry_DoNotUse::MergeFrom(const Traffic_VlanPacketCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_VlanPacketCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[6]);
+}
+
+// ===================================================================
+
+Traffic_ConnectionCountsEntry_DoNotUse::Traffic_ConnectionCountsEntry_DoNotUse() {}
+Traffic_ConnectionCountsEntry_DoNotUse::Traffic_ConnectionCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_ConnectionCountsEntry_DoNotUse::MergeFrom(const Traffic_ConnectionCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_ConnectionCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[7]);
+}
+
+// ===================================================================
+
+Traffic_InterfaceByteCountsEntry_DoNotUse::Traffic_InterfaceByteCountsEntry_DoNotUse() {}
+Traffic_InterfaceByteCountsEntry_DoNotUse::Traffic_InterfaceByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_InterfaceByteCountsEntry_DoNotUse::MergeFrom(const Traffic_InterfaceByteCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_InterfaceByteCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[8]);
+}
+
+// ===================================================================
+
+Traffic_CloudByteCountsEntry_DoNotUse::Traffic_CloudByteCountsEntry_DoNotUse() {}
+Traffic_CloudByteCountsEntry_DoNotUse::Traffic_CloudByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_CloudByteCountsEntry_DoNotUse::MergeFrom(const Traffic_CloudByteCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_CloudByteCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[9]);
+}
+
+// ===================================================================
+
+Traffic_IpaddressByteCountsEntry_DoNotUse::Traffic_IpaddressByteCountsEntry_DoNotUse() {}
+Traffic_IpaddressByteCountsEntry_DoNotUse::Traffic_IpaddressByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_IpaddressByteCountsEntry_DoNotUse::MergeFrom(const Traffic_IpaddressByteCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_IpaddressByteCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[10]);
+}
+
+// ===================================================================
+
+Traffic_VlanByteCountsEntry_DoNotUse::Traffic_VlanByteCountsEntry_DoNotUse() {}
+Traffic_VlanByteCountsEntry_DoNotUse::Traffic_VlanByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_VlanByteCountsEntry_DoNotUse::MergeFrom(const Traffic_VlanByteCountsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_VlanByteCountsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[11]);
+}
+
+// ===================================================================
+
+Traffic_InterfaceRatesEntry_DoNotUse::Traffic_InterfaceRatesEntry_DoNotUse() {}
+Traffic_InterfaceRatesEntry_DoNotUse::Traffic_InterfaceRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_InterfaceRatesEntry_DoNotUse::MergeFrom(const Traffic_InterfaceRatesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_InterfaceRatesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[12]);
+}
+
+// ===================================================================
+
+Traffic_CloudRatesEntry_DoNotUse::Traffic_CloudRatesEntry_DoNotUse() {}
+Traffic_CloudRatesEntry_DoNotUse::Traffic_CloudRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_CloudRatesEntry_DoNotUse::MergeFrom(const Traffic_CloudRatesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_CloudRatesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[13]);
+}
+
+// ===================================================================
+
+Traffic_IpaddressRatesEntry_DoNotUse::Traffic_IpaddressRatesEntry_DoNotUse() {}
+Traffic_IpaddressRatesEntry_DoNotUse::Traffic_IpaddressRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_IpaddressRatesEntry_DoNotUse::MergeFrom(const Traffic_IpaddressRatesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_IpaddressRatesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[14]);
+}
+
+// ===================================================================
+
+Traffic_VlanRatesEntry_DoNotUse::Traffic_VlanRatesEntry_DoNotUse() {}
+Traffic_VlanRatesEntry_DoNotUse::Traffic_VlanRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Traffic_VlanRatesEntry_DoNotUse::MergeFrom(const Traffic_VlanRatesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic_VlanRatesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[15]);
+}
+
+// ===================================================================
+
+class Traffic::_Internal {
+ public:
+  static const ::Lansnoop::TrafficDeltas& interfaces(const Traffic* msg);
+  static const ::Lansnoop::TrafficDeltas& clouds(const Traffic* msg);
+  static const ::Lansnoop::TrafficDeltas& ipaddresses(const Traffic* msg);
+  static const ::Lansnoop::TrafficDeltas& vlans(const Traffic* msg);
+  static const ::Lansnoop::ConnectionCountArrays& connections(const Traffic* msg);
+};
+
+const ::Lansnoop::TrafficDeltas&
+Traffic::_Internal::interfaces(const Traffic* msg) {
+  return *msg->_impl_.interfaces_;
+}
+const ::Lansnoop::TrafficDeltas&
+Traffic::_Internal::clouds(const Traffic* msg) {
+  return *msg->_impl_.clouds_;
+}
+const ::Lansnoop::TrafficDeltas&
+Traffic::_Internal::ipaddresses(const Traffic* msg) {
+  return *msg->_impl_.ipaddresses_;
+}
+const ::Lansnoop::TrafficDeltas&
+Traffic::_Internal::vlans(const Traffic* msg) {
+  return *msg->_impl_.vlans_;
+}
+const ::Lansnoop::ConnectionCountArrays&
+Traffic::_Internal::connections(const Traffic* msg) {
+  return *msg->_impl_.connections_;
+}
+void Traffic::clear_connection_counts() {
+  _impl_.connection_counts_.Clear();
+}
+Traffic::Traffic(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &Traffic::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:Lansnoop.Traffic)
+}
+Traffic::Traffic(const Traffic& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Traffic* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.interface_packet_counts_)*/{}
+    , /*decltype(_impl_.cloud_packet_counts_)*/{}
+    , /*decltype(_impl_.ipaddress_packet_counts_)*/{}
+    , /*decltype(_impl_.vlan_packet_counts_)*/{}
+    , /*decltype(_impl_.connection_counts_)*/{}
+    , /*decltype(_impl_.interface_byte_counts_)*/{}
+    , /*decltype(_impl_.cloud_byte_counts_)*/{}
+    , /*decltype(_impl_.ipaddress_byte_counts_)*/{}
+    , /*decltype(_impl_.vlan_byte_counts_)*/{}
+    , /*decltype(_impl_.interface_rates_)*/{}
+    , /*decltype(_impl_.cloud_rates_)*/{}
+    , /*decltype(_impl_.ipaddress_rates_)*/{}
+    , /*decltype(_impl_.vlan_rates_)*/{}
+    , decltype(_impl_.interfaces_){nullptr}
+    , decltype(_impl_.clouds_){nullptr}
+    , decltype(_impl_.ipaddresses_){nullptr}
+    , decltype(_impl_.vlans_){nullptr}
+    , decltype(_impl_.connections_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.interface_packet_counts_.MergeFrom(from._impl_.interface_packet_counts_);
+  _this->_impl_.cloud_packet_counts_.MergeFrom(from._impl_.cloud_packet_counts_);
+  _this->_impl_.ipaddress_packet_counts_.MergeFrom(from._impl_.ipaddress_packet_counts_);
+  _this->_impl_.vlan_packet_counts_.MergeFrom(from._impl_.vlan_packet_counts_);
+  _this->_impl_.connection_counts_.MergeFrom(from._impl_.connection_counts_);
+  _this->_impl_.interface_byte_counts_.MergeFrom(from._impl_.interface_byte_counts_);
+  _this->_impl_.cloud_byte_counts_.MergeFrom(from._impl_.cloud_byte_counts_);
+  _this->_impl_.ipaddress_byte_counts_.MergeFrom(from._impl_.ipaddress_byte_counts_);
+  _this->_impl_.vlan_byte_counts_.MergeFrom(from._impl_.vlan_byte_counts_);
+  _this->_impl_.interface_rates_.MergeFrom(from._impl_.interface_rates_);
+  _this->_impl_.cloud_rates_.MergeFrom(from._impl_.cloud_rates_);
+  _this->_impl_.ipaddress_rates_.MergeFrom(from._impl_.ipaddress_rates_);
+  _this->_impl_.vlan_rates_.MergeFrom(from._impl_.vlan_rates_);
+  if (from._internal_has_interfaces()) {
+    _this->_impl_.interfaces_ = new ::Lansnoop::TrafficDeltas(*from._impl_.interfaces_);
+  }
+  if (from._internal_has_clouds()) {
+    _this->_impl_.clouds_ = new ::Lansnoop::TrafficDeltas(*from._impl_.clouds_);
+  }
+  if (from._internal_has_ipaddresses()) {
+    _this->_impl_.ipaddresses_ = new ::Lansnoop::TrafficDeltas(*from._impl_.ipaddresses_);
+  }
+  if (from._internal_has_vlans()) {
+    _this->_impl_.vlans_ = new ::Lansnoop::TrafficDeltas(*from._impl_.vlans_);
+  }
+  if (from._internal_has_connections()) {
+    _this->_impl_.connections_ = new ::Lansnoop::ConnectionCountArrays(*from._impl_.connections_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Lansnoop.Traffic)
+}
+
+inline void Traffic::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.interface_packet_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.cloud_packet_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.ipaddress_packet_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.vlan_packet_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.connection_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.interface_byte_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.cloud_byte_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.ipaddress_byte_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.vlan_byte_counts_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.interface_rates_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.cloud_rates_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.ipaddress_rates_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.vlan_rates_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.interfaces_){nullptr}
+    , decltype(_impl_.clouds_){nullptr}
+    , decltype(_impl_.ipaddresses_){nullptr}
+    , decltype(_impl_.vlans_){nullptr}
+    , decltype(_impl_.connections_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Traffic::~Traffic() {
+  // @@protoc_insertion_point(destructor:Lansnoop.Traffic)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Traffic::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.interface_packet_counts_.Destruct();
+  _impl_.interface_packet_counts_.~MapField();
+  _impl_.cloud_packet_counts_.Destruct();
+  _impl_.cloud_packet_counts_.~MapField();
+  _impl_.ipaddress_packet_counts_.Destruct();
+  _impl_.ipaddress_packet_counts_.~MapField();
+  _impl_.vlan_packet_counts_.Destruct();
+  _impl_.vlan_packet_counts_.~MapField();
+  _impl_.connection_counts_.Destruct();
+  _impl_.connection_counts_.~MapField();
+  _impl_.interface_byte_counts_.Destruct();
+  _impl_.interface_byte_counts_.~MapField();
+  _impl_.cloud_byte_counts_.Destruct();
+  _impl_.cloud_byte_counts_.~MapField();
+  _impl_.ipaddress_byte_counts_.Destruct();
+  _impl_.ipaddress_byte_counts_.~MapField();
+  _impl_.vlan_byte_counts_.Destruct();
+  _impl_.vlan_byte_counts_.~MapField();
+  _impl_.interface_rates_.Destruct();
+  _impl_.interface_rates_.~MapField();
+  _impl_.cloud_rates_.Destruct();
+  _impl_.cloud_rates_.~MapField();
+  _impl_.ipaddress_rates_.Destruct();
+  _impl_.ipaddress_rates_.~MapField();
+  _impl_.vlan_rates_.Destruct();
+  _impl_.vlan_rates_.~MapField();
+  if (this != internal_default_instance()) delete _impl_.interfaces_;
+  if (this != internal_default_instance()) delete _impl_.clouds_;
+  if (this != internal_default_instance()) delete _impl_.ipaddresses_;
+  if (this != internal_default_instance()) delete _impl_.vlans_;
+  if (this != internal_default_instance()) delete _impl_.connections_;
+}
+
+void Traffic::ArenaDtor(void* object) {
+  Traffic* _this = reinterpret_cast< Traffic* >(object);
+  _this->_impl_.interface_packet_counts_.Destruct();
+  _this->_impl_.cloud_packet_counts_.Destruct();
+  _this->_impl_.ipaddress_packet_counts_.Destruct();
+  _this->_impl_.vlan_packet_counts_.Destruct();
+  _this->_impl_.connection_counts_.Destruct();
+  _this->_impl_.interface_byte_counts_.Destruct();
+  _this->_impl_.cloud_byte_counts_.Destruct();
+  _this->_impl_.ipaddress_byte_counts_.Destruct();
+  _this->_impl_.vlan_byte_counts_.Destruct();
+  _this->_impl_.interface_rates_.Destruct();
+  _this->_impl_.cloud_rates_.Destruct();
+  _this->_impl_.ipaddress_rates_.Destruct();
+  _this->_impl_.vlan_rates_.Destruct();
+}
+void Traffic::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Traffic::Clear() {
+// @@protoc_insertion_point(message_clear_start:Lansnoop.Traffic)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.interface_packet_counts_.Clear();
+  _impl_.cloud_packet_counts_.Clear();
+  _impl_.ipaddress_packet_counts_.Clear();
+  _impl_.vlan_packet_counts_.Clear();
+  _impl_.connection_counts_.Clear();
+  _impl_.interface_byte_counts_.Clear();
+  _impl_.cloud_byte_counts_.Clear();
+  _impl_.ipaddress_byte_counts_.Clear();
+  _impl_.vlan_byte_counts_.Clear();
+  _impl_.interface_rates_.Clear();
+  _impl_.cloud_rates_.Clear();
+  _impl_.ipaddress_rates_.Clear();
+  _impl_.vlan_rates_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.interfaces_ != nullptr) {
+    delete _impl_.interfaces_;
+  }
+  _impl_.interfaces_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.clouds_ != nullptr) {
+    delete _impl_.clouds_;
+  }
+  _impl_.clouds_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.ipaddresses_ != nullptr) {
+    delete _impl_.ipaddresses_;
+  }
+  _impl_.ipaddresses_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.vlans_ != nullptr) {
+    delete _impl_.vlans_;
+  }
+  _impl_.vlans_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.connections_ != nullptr) {
+    delete _impl_.connections_;
+  }
+  _impl_.connections_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Traffic::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<uint32, uint64> interface_packet_counts = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.interface_packet_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, uint64> cloud_packet_counts = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.cloud_packet_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, uint64> ipaddress_packet_counts = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.ipaddress_packet_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, uint64> vlan_packet_counts = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.vlan_packet_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, .Lansnoop.ConnectionCounts> connection_counts = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.connection_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, uint64> interface_byte_counts = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.interface_byte_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, uint64> cloud_byte_counts = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.cloud_byte_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, uint64> ipaddress_byte_counts = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.ipaddress_byte_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, uint64> vlan_byte_counts = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.vlan_byte_counts_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, .Lansnoop.Rate> interface_rates = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.interface_rates_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, .Lansnoop.Rate> cloud_rates = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.cloud_rates_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, .Lansnoop.Rate> ipaddress_rates = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.ipaddress_rates_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint32, .Lansnoop.Rate> vlan_rates = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.vlan_rates_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.TrafficDeltas interfaces = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_interfaces(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.TrafficDeltas clouds = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clouds(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.TrafficDeltas ipaddresses = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ipaddresses(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.TrafficDeltas vlans = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vlans(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Lansnoop.ConnectionCountArrays connections = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_connections(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Traffic::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Lansnoop.Traffic)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<uint32, uint64> interface_packet_counts = 1;
+  if (!this->_internal_interface_packet_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_InterfacePacketCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_interface_packet_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint64> cloud_packet_counts = 2;
+  if (!this->_internal_cloud_packet_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_CloudPacketCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_cloud_packet_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint64> ipaddress_packet_counts = 3;
+  if (!this->_internal_ipaddress_packet_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_IpaddressPacketCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_ipaddress_packet_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint64> vlan_packet_counts = 4;
+  if (!this->_internal_vlan_packet_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_VlanPacketCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_vlan_packet_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .Lansnoop.ConnectionCounts> connection_counts = 5;
+  if (!this->_internal_connection_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, ::Lansnoop::ConnectionCounts>;
+    using WireHelper = Traffic_ConnectionCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_connection_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(5, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(5, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint64> interface_byte_counts = 6;
+  if (!this->_internal_interface_byte_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_InterfaceByteCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_interface_byte_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint64> cloud_byte_counts = 7;
+  if (!this->_internal_cloud_byte_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_CloudByteCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_cloud_byte_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(7, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(7, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint64> ipaddress_byte_counts = 8;
+  if (!this->_internal_ipaddress_byte_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_IpaddressByteCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_ipaddress_byte_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(8, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(8, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, uint64> vlan_byte_counts = 9;
+  if (!this->_internal_vlan_byte_counts().empty()) {
+    using MapType = ::_pb::Map<uint32_t, uint64_t>;
+    using WireHelper = Traffic_VlanByteCountsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_vlan_byte_counts();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(9, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(9, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .Lansnoop.Rate> interface_rates = 10;
+  if (!this->_internal_interface_rates().empty()) {
+    using MapType = ::_pb::Map<uint32_t, ::Lansnoop::Rate>;
+    using WireHelper = Traffic_InterfaceRatesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_interface_rates();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(10, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(10, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .Lansnoop.Rate> cloud_rates = 11;
+  if (!this->_internal_cloud_rates().empty()) {
+    using MapType = ::_pb::Map<uint32_t, ::Lansnoop::Rate>;
+    using WireHelper = Traffic_CloudRatesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_cloud_rates();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(11, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(11, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .Lansnoop.Rate> ipaddress_rates = 12;
+  if (!this->_internal_ipaddress_rates().empty()) {
+    using MapType = ::_pb::Map<uint32_t, ::Lansnoop::Rate>;
+    using WireHelper = Traffic_IpaddressRatesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_ipaddress_rates();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(12, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(12, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // map<uint32, .Lansnoop.Rate> vlan_rates = 13;
+  if (!this->_internal_vlan_rates().empty()) {
+    using MapType = ::_pb::Map<uint32_t, ::Lansnoop::Rate>;
+    using WireHelper = Traffic_VlanRatesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_vlan_rates();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(13, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(13, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // .Lansnoop.TrafficDeltas interfaces = 14;
+  if (this->_internal_has_interfaces()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::interfaces(this),
+        _Internal::interfaces(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.TrafficDeltas clouds = 15;
+  if (this->_internal_has_clouds()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::clouds(this),
+        _Internal::clouds(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.TrafficDeltas ipaddresses = 16;
+  if (this->_internal_has_ipaddresses()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, _Internal::ipaddresses(this),
+        _Internal::ipaddresses(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.TrafficDeltas vlans = 17;
+  if (this->_internal_has_vlans()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::vlans(this),
+        _Internal::vlans(this).GetCachedSize(), target, stream);
+  }
+
+  // .Lansnoop.ConnectionCountArrays connections = 18;
+  if (this->_internal_has_connections()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::connections(this),
+        _Internal::connections(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Lansnoop.Traffic)
+  return target;
+}
+
+size_t Traffic::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Lansnoop.Traffic)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<uint32, uint64> interface_packet_counts = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_interface_packet_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_interface_packet_counts().begin();
+      it != this->_internal_interface_packet_counts().end(); ++it) {
+    total_size += Traffic_InterfacePacketCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, uint64> cloud_packet_counts = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_cloud_packet_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_cloud_packet_counts().begin();
+      it != this->_internal_cloud_packet_counts().end(); ++it) {
+    total_size += Traffic_CloudPacketCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, uint64> ipaddress_packet_counts = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_ipaddress_packet_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_ipaddress_packet_counts().begin();
+      it != this->_internal_ipaddress_packet_counts().end(); ++it) {
+    total_size += Traffic_IpaddressPacketCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, uint64> vlan_packet_counts = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_vlan_packet_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_vlan_packet_counts().begin();
+      it != this->_internal_vlan_packet_counts().end(); ++it) {
+    total_size += Traffic_VlanPacketCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, .Lansnoop.ConnectionCounts> connection_counts = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_connection_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >::const_iterator
+      it = this->_internal_connection_counts().begin();
+      it != this->_internal_connection_counts().end(); ++it) {
+    total_size += Traffic_ConnectionCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, uint64> interface_byte_counts = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_interface_byte_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_interface_byte_counts().begin();
+      it != this->_internal_interface_byte_counts().end(); ++it) {
+    total_size += Traffic_InterfaceByteCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, uint64> cloud_byte_counts = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_cloud_byte_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_cloud_byte_counts().begin();
+      it != this->_internal_cloud_byte_counts().end(); ++it) {
+    total_size += Traffic_CloudByteCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, uint64> ipaddress_byte_counts = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_ipaddress_byte_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_ipaddress_byte_counts().begin();
+      it != this->_internal_ipaddress_byte_counts().end(); ++it) {
+    total_size += Traffic_IpaddressByteCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, uint64> vlan_byte_counts = 9;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_vlan_byte_counts_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >::const_iterator
+      it = this->_internal_vlan_byte_counts().begin();
+      it != this->_internal_vlan_byte_counts().end(); ++it) {
+    total_size += Traffic_VlanByteCountsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, .Lansnoop.Rate> interface_rates = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_interface_rates_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >::const_iterator
+      it = this->_internal_interface_rates().begin();
+      it != this->_internal_interface_rates().end(); ++it) {
+    total_size += Traffic_InterfaceRatesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, .Lansnoop.Rate> cloud_rates = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_cloud_rates_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >::const_iterator
+      it = this->_internal_cloud_rates().begin();
+      it != this->_internal_cloud_rates().end(); ++it) {
+    total_size += Traffic_CloudRatesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, .Lansnoop.Rate> ipaddress_rates = 12;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_ipaddress_rates_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >::const_iterator
+      it = this->_internal_ipaddress_rates().begin();
+      it != this->_internal_ipaddress_rates().end(); ++it) {
+    total_size += Traffic_IpaddressRatesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<uint32, .Lansnoop.Rate> vlan_rates = 13;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_vlan_rates_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >::const_iterator
+      it = this->_internal_vlan_rates().begin();
+      it != this->_internal_vlan_rates().end(); ++it) {
+    total_size += Traffic_VlanRatesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // .Lansnoop.TrafficDeltas interfaces = 14;
+  if (this->_internal_has_interfaces()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.interfaces_);
+  }
+
+  // .Lansnoop.TrafficDeltas clouds = 15;
+  if (this->_internal_has_clouds()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.clouds_);
+  }
+
+  // .Lansnoop.TrafficDeltas ipaddresses = 16;
+  if (this->_internal_has_ipaddresses()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ipaddresses_);
+  }
+
+  // .Lansnoop.TrafficDeltas vlans = 17;
+  if (this->_internal_has_vlans()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.vlans_);
+  }
+
+  // .Lansnoop.ConnectionCountArrays connections = 18;
+  if (this->_internal_has_connections()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.connections_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Traffic::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Traffic::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Traffic::GetClassData() const { return &_class_data_; }
+
+
+void Traffic::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Traffic*>(&to_msg);
+  auto& from = static_cast<const Traffic&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Lansnoop.Traffic)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.interface_packet_counts_.MergeFrom(from._impl_.interface_packet_counts_);
+  _this->_impl_.cloud_packet_counts_.MergeFrom(from._impl_.cloud_packet_counts_);
+  _this->_impl_.ipaddress_packet_counts_.MergeFrom(from._impl_.ipaddress_packet_counts_);
+  _this->_impl_.vlan_packet_counts_.MergeFrom(from._impl_.vlan_packet_counts_);
+  _this->_impl_.connection_counts_.MergeFrom(from._impl_.connection_counts_);
+  _this->_impl_.interface_byte_counts_.MergeFrom(from._impl_.interface_byte_counts_);
+  _this->_impl_.cloud_byte_counts_.MergeFrom(from._impl_.cloud_byte_counts_);
+  _this->_impl_.ipaddress_byte_counts_.MergeFrom(from._impl_.ipaddress_byte_counts_);
+  _this->_impl_.vlan_byte_counts_.MergeFrom(from._impl_.vlan_byte_counts_);
+  _this->_impl_.interface_rates_.MergeFrom(from._impl_.interface_rates_);
+  _this->_impl_.cloud_rates_.MergeFrom(from._impl_.cloud_rates_);
+  _this->_impl_.ipaddress_rates_.MergeFrom(from._impl_.ipaddress_rates_);
+  _this->_impl_.vlan_rates_.MergeFrom(from._impl_.vlan_rates_);
+  if (from._internal_has_interfaces()) {
+    _this->_internal_mutable_interfaces()->::Lansnoop::TrafficDeltas::MergeFrom(
+        from._internal_interfaces());
+  }
+  if (from._internal_has_clouds()) {
+    _this->_internal_mutable_clouds()->::Lansnoop::TrafficDeltas::MergeFrom(
+        from._internal_clouds());
+  }
+  if (from._internal_has_ipaddresses()) {
+    _this->_internal_mutable_ipaddresses()->::Lansnoop::TrafficDeltas::MergeFrom(
+        from._internal_ipaddresses());
+  }
+  if (from._internal_has_vlans()) {
+    _this->_internal_mutable_vlans()->::Lansnoop::TrafficDeltas::MergeFrom(
+        from._internal_vlans());
+  }
+  if (from._internal_has_connections()) {
+    _this->_internal_mutable_connections()->::Lansnoop::ConnectionCountArrays::MergeFrom(
+        from._internal_connections());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Traffic::CopyFrom(const Traffic& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Lansnoop.Traffic)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Traffic::IsInitialized() const {
+  return true;
+}
+
+void Traffic::InternalSwap(Traffic* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.interface_packet_counts_.InternalSwap(&other->_impl_.interface_packet_counts_);
+  _impl_.cloud_packet_counts_.InternalSwap(&other->_impl_.cloud_packet_counts_);
+  _impl_.ipaddress_packet_counts_.InternalSwap(&other->_impl_.ipaddress_packet_counts_);
+  _impl_.vlan_packet_counts_.InternalSwap(&other->_impl_.vlan_packet_counts_);
+  _impl_.connection_counts_.InternalSwap(&other->_impl_.connection_counts_);
+  _impl_.interface_byte_counts_.InternalSwap(&other->_impl_.interface_byte_counts_);
+  _impl_.cloud_byte_counts_.InternalSwap(&other->_impl_.cloud_byte_counts_);
+  _impl_.ipaddress_byte_counts_.InternalSwap(&other->_impl_.ipaddress_byte_counts_);
+  _impl_.vlan_byte_counts_.InternalSwap(&other->_impl_.vlan_byte_counts_);
+  _impl_.interface_rates_.InternalSwap(&other->_impl_.interface_rates_);
+  _impl_.cloud_rates_.InternalSwap(&other->_impl_.cloud_rates_);
+  _impl_.ipaddress_rates_.InternalSwap(&other->_impl_.ipaddress_rates_);
+  _impl_.vlan_rates_.InternalSwap(&other->_impl_.vlan_rates_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Traffic, _impl_.connections_)
+      + sizeof(Traffic::_impl_.connections_)
+      - PROTOBUF_FIELD_OFFSET(Traffic, _impl_.interfaces_)>(
+          reinterpret_cast<char*>(&_impl_.interfaces_),
+          reinterpret_cast<char*>(&other->_impl_.interfaces_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Traffic::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_traffic_2eproto_getter, &descriptor_table_traffic_2eproto_once,
+      file_level_metadata_traffic_2eproto[16]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Lansnoop::Rate*
+Arena::CreateMaybeMessage< ::Lansnoop::Rate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Rate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::TrafficDeltas*
+Arena::CreateMaybeMessage< ::Lansnoop::TrafficDeltas >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::TrafficDeltas >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::ConnectionCountArrays*
+Arena::CreateMaybeMessage< ::Lansnoop::ConnectionCountArrays >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::ConnectionCountArrays >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_CloudRatesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_CloudRatesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_CloudRatesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic_VlanRatesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic_VlanRatesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic_VlanRatesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Lansnoop::Traffic*
+Arena::CreateMaybeMessage< ::Lansnoop::Traffic >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Lansnoop::Traffic >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
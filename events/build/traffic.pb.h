@@ -0,0 +1,3155 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: traffic.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_traffic_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_traffic_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "connection.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_traffic_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_traffic_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_traffic_2eproto;
+namespace Lansnoop {
+class ConnectionCountArrays;
+struct ConnectionCountArraysDefaultTypeInternal;
+extern ConnectionCountArraysDefaultTypeInternal _ConnectionCountArrays_default_instance_;
+class Rate;
+struct RateDefaultTypeInternal;
+extern RateDefaultTypeInternal _Rate_default_instance_;
+class Traffic;
+struct TrafficDefaultTypeInternal;
+extern TrafficDefaultTypeInternal _Traffic_default_instance_;
+class TrafficDeltas;
+struct TrafficDeltasDefaultTypeInternal;
+extern TrafficDeltasDefaultTypeInternal _TrafficDeltas_default_instance_;
+class Traffic_CloudByteCountsEntry_DoNotUse;
+struct Traffic_CloudByteCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_CloudByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_CloudByteCountsEntry_DoNotUse_default_instance_;
+class Traffic_CloudPacketCountsEntry_DoNotUse;
+struct Traffic_CloudPacketCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_CloudPacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_CloudPacketCountsEntry_DoNotUse_default_instance_;
+class Traffic_CloudRatesEntry_DoNotUse;
+struct Traffic_CloudRatesEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_CloudRatesEntry_DoNotUseDefaultTypeInternal _Traffic_CloudRatesEntry_DoNotUse_default_instance_;
+class Traffic_ConnectionCountsEntry_DoNotUse;
+struct Traffic_ConnectionCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_ConnectionCountsEntry_DoNotUseDefaultTypeInternal _Traffic_ConnectionCountsEntry_DoNotUse_default_instance_;
+class Traffic_InterfaceByteCountsEntry_DoNotUse;
+struct Traffic_InterfaceByteCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_InterfaceByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_InterfaceByteCountsEntry_DoNotUse_default_instance_;
+class Traffic_InterfacePacketCountsEntry_DoNotUse;
+struct Traffic_InterfacePacketCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_InterfacePacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_InterfacePacketCountsEntry_DoNotUse_default_instance_;
+class Traffic_InterfaceRatesEntry_DoNotUse;
+struct Traffic_InterfaceRatesEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_InterfaceRatesEntry_DoNotUseDefaultTypeInternal _Traffic_InterfaceRatesEntry_DoNotUse_default_instance_;
+class Traffic_IpaddressByteCountsEntry_DoNotUse;
+struct Traffic_IpaddressByteCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_IpaddressByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_IpaddressByteCountsEntry_DoNotUse_default_instance_;
+class Traffic_IpaddressPacketCountsEntry_DoNotUse;
+struct Traffic_IpaddressPacketCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_IpaddressPacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_IpaddressPacketCountsEntry_DoNotUse_default_instance_;
+class Traffic_IpaddressRatesEntry_DoNotUse;
+struct Traffic_IpaddressRatesEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_IpaddressRatesEntry_DoNotUseDefaultTypeInternal _Traffic_IpaddressRatesEntry_DoNotUse_default_instance_;
+class Traffic_VlanByteCountsEntry_DoNotUse;
+struct Traffic_VlanByteCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_VlanByteCountsEntry_DoNotUseDefaultTypeInternal _Traffic_VlanByteCountsEntry_DoNotUse_default_instance_;
+class Traffic_VlanPacketCountsEntry_DoNotUse;
+struct Traffic_VlanPacketCountsEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_VlanPacketCountsEntry_DoNotUseDefaultTypeInternal _Traffic_VlanPacketCountsEntry_DoNotUse_default_instance_;
+class Traffic_VlanRatesEntry_DoNotUse;
+struct Traffic_VlanRatesEntry_DoNotUseDefaultTypeInternal;
+extern Traffic_VlanRatesEntry_DoNotUseDefaultTypeInternal _Traffic_VlanRatesEntry_DoNotUse_default_instance_;
+}  // namespace Lansnoop
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Lansnoop::ConnectionCountArrays* Arena::CreateMaybeMessage<::Lansnoop::ConnectionCountArrays>(Arena*);
+template<> ::Lansnoop::Rate* Arena::CreateMaybeMessage<::Lansnoop::Rate>(Arena*);
+template<> ::Lansnoop::Traffic* Arena::CreateMaybeMessage<::Lansnoop::Traffic>(Arena*);
+template<> ::Lansnoop::TrafficDeltas* Arena::CreateMaybeMessage<::Lansnoop::TrafficDeltas>(Arena*);
+template<> ::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_CloudByteCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_CloudPacketCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_CloudRatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_CloudRatesEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_ConnectionCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_InterfaceByteCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_InterfacePacketCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_InterfaceRatesEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_IpaddressByteCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_IpaddressPacketCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_IpaddressRatesEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_VlanByteCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_VlanPacketCountsEntry_DoNotUse>(Arena*);
+template<> ::Lansnoop::Traffic_VlanRatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Lansnoop::Traffic_VlanRatesEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Lansnoop {
+
+// ===================================================================
+
+class Rate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Rate) */ {
+ public:
+  inline Rate() : Rate(nullptr) {}
+  ~Rate() override;
+  explicit PROTOBUF_CONSTEXPR Rate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Rate(const Rate& from);
+  Rate(Rate&& from) noexcept
+    : Rate() {
+    *this = ::std::move(from);
+  }
+
+  inline Rate& operator=(const Rate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Rate& operator=(Rate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Rate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Rate* internal_default_instance() {
+    return reinterpret_cast<const Rate*>(
+               &_Rate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Rate& a, Rate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Rate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Rate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Rate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Rate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Rate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Rate& from) {
+    Rate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Rate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Rate";
+  }
+  protected:
+  explicit Rate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPacketsPerSecondFieldNumber = 1,
+    kBitsPerSecondFieldNumber = 2,
+  };
+  // float packets_per_second = 1;
+  void clear_packets_per_second();
+  float packets_per_second() const;
+  void set_packets_per_second(float value);
+  private:
+  float _internal_packets_per_second() const;
+  void _internal_set_packets_per_second(float value);
+  public:
+
+  // float bits_per_second = 2;
+  void clear_bits_per_second();
+  float bits_per_second() const;
+  void set_bits_per_second(float value);
+  private:
+  float _internal_bits_per_second() const;
+  void _internal_set_bits_per_second(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.Rate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float packets_per_second_;
+    float bits_per_second_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_traffic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrafficDeltas final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.TrafficDeltas) */ {
+ public:
+  inline TrafficDeltas() : TrafficDeltas(nullptr) {}
+  ~TrafficDeltas() override;
+  explicit PROTOBUF_CONSTEXPR TrafficDeltas(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TrafficDeltas(const TrafficDeltas& from);
+  TrafficDeltas(TrafficDeltas&& from) noexcept
+    : TrafficDeltas() {
+    *this = ::std::move(from);
+  }
+
+  inline TrafficDeltas& operator=(const TrafficDeltas& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrafficDeltas& operator=(TrafficDeltas&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrafficDeltas& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrafficDeltas* internal_default_instance() {
+    return reinterpret_cast<const TrafficDeltas*>(
+               &_TrafficDeltas_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TrafficDeltas& a, TrafficDeltas& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrafficDeltas* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrafficDeltas* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TrafficDeltas* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrafficDeltas>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrafficDeltas& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrafficDeltas& from) {
+    TrafficDeltas::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrafficDeltas* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.TrafficDeltas";
+  }
+  protected:
+  explicit TrafficDeltas(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdsFieldNumber = 1,
+    kPacketsFieldNumber = 2,
+    kBytesFieldNumber = 3,
+    kRateIdsFieldNumber = 4,
+    kPacketsPerSecondFieldNumber = 5,
+    kBitsPerSecondFieldNumber = 6,
+  };
+  // repeated uint32 ids = 1;
+  int ids_size() const;
+  private:
+  int _internal_ids_size() const;
+  public:
+  void clear_ids();
+  private:
+  uint32_t _internal_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ids() const;
+  void _internal_add_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ids();
+  public:
+  uint32_t ids(int index) const;
+  void set_ids(int index, uint32_t value);
+  void add_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ids();
+
+  // repeated uint64 packets = 2;
+  int packets_size() const;
+  private:
+  int _internal_packets_size() const;
+  public:
+  void clear_packets();
+  private:
+  uint64_t _internal_packets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_packets() const;
+  void _internal_add_packets(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_packets();
+  public:
+  uint64_t packets(int index) const;
+  void set_packets(int index, uint64_t value);
+  void add_packets(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      packets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_packets();
+
+  // repeated uint64 bytes = 3;
+  int bytes_size() const;
+  private:
+  int _internal_bytes_size() const;
+  public:
+  void clear_bytes();
+  private:
+  uint64_t _internal_bytes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_bytes() const;
+  void _internal_add_bytes(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_bytes();
+  public:
+  uint64_t bytes(int index) const;
+  void set_bytes(int index, uint64_t value);
+  void add_bytes(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_bytes();
+
+  // repeated uint32 rate_ids = 4;
+  int rate_ids_size() const;
+  private:
+  int _internal_rate_ids_size() const;
+  public:
+  void clear_rate_ids();
+  private:
+  uint32_t _internal_rate_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_rate_ids() const;
+  void _internal_add_rate_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_rate_ids();
+  public:
+  uint32_t rate_ids(int index) const;
+  void set_rate_ids(int index, uint32_t value);
+  void add_rate_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      rate_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_rate_ids();
+
+  // repeated float packets_per_second = 5;
+  int packets_per_second_size() const;
+  private:
+  int _internal_packets_per_second_size() const;
+  public:
+  void clear_packets_per_second();
+  private:
+  float _internal_packets_per_second(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_packets_per_second() const;
+  void _internal_add_packets_per_second(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_packets_per_second();
+  public:
+  float packets_per_second(int index) const;
+  void set_packets_per_second(int index, float value);
+  void add_packets_per_second(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      packets_per_second() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_packets_per_second();
+
+  // repeated float bits_per_second = 6;
+  int bits_per_second_size() const;
+  private:
+  int _internal_bits_per_second_size() const;
+  public:
+  void clear_bits_per_second();
+  private:
+  float _internal_bits_per_second(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_bits_per_second() const;
+  void _internal_add_bits_per_second(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_bits_per_second();
+  public:
+  float bits_per_second(int index) const;
+  void set_bits_per_second(int index, float value);
+  void add_bits_per_second(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      bits_per_second() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_bits_per_second();
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.TrafficDeltas)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ids_;
+    mutable std::atomic<int> _ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > packets_;
+    mutable std::atomic<int> _packets_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > bytes_;
+    mutable std::atomic<int> _bytes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > rate_ids_;
+    mutable std::atomic<int> _rate_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > packets_per_second_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > bits_per_second_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_traffic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConnectionCountArrays final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.ConnectionCountArrays) */ {
+ public:
+  inline ConnectionCountArrays() : ConnectionCountArrays(nullptr) {}
+  ~ConnectionCountArrays() override;
+  explicit PROTOBUF_CONSTEXPR ConnectionCountArrays(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConnectionCountArrays(const ConnectionCountArrays& from);
+  ConnectionCountArrays(ConnectionCountArrays&& from) noexcept
+    : ConnectionCountArrays() {
+    *this = ::std::move(from);
+  }
+
+  inline ConnectionCountArrays& operator=(const ConnectionCountArrays& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConnectionCountArrays& operator=(ConnectionCountArrays&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectionCountArrays& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectionCountArrays* internal_default_instance() {
+    return reinterpret_cast<const ConnectionCountArrays*>(
+               &_ConnectionCountArrays_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ConnectionCountArrays& a, ConnectionCountArrays& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConnectionCountArrays* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectionCountArrays* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConnectionCountArrays* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectionCountArrays>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConnectionCountArrays& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectionCountArrays& from) {
+    ConnectionCountArrays::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConnectionCountArrays* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.ConnectionCountArrays";
+  }
+  protected:
+  explicit ConnectionCountArrays(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdsFieldNumber = 1,
+    kAPacketsFieldNumber = 2,
+    kBPacketsFieldNumber = 3,
+    kABytesFieldNumber = 4,
+    kBBytesFieldNumber = 5,
+  };
+  // repeated uint32 ids = 1;
+  int ids_size() const;
+  private:
+  int _internal_ids_size() const;
+  public:
+  void clear_ids();
+  private:
+  uint32_t _internal_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ids() const;
+  void _internal_add_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ids();
+  public:
+  uint32_t ids(int index) const;
+  void set_ids(int index, uint32_t value);
+  void add_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ids();
+
+  // repeated uint64 a_packets = 2;
+  int a_packets_size() const;
+  private:
+  int _internal_a_packets_size() const;
+  public:
+  void clear_a_packets();
+  private:
+  uint64_t _internal_a_packets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_a_packets() const;
+  void _internal_add_a_packets(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_a_packets();
+  public:
+  uint64_t a_packets(int index) const;
+  void set_a_packets(int index, uint64_t value);
+  void add_a_packets(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      a_packets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_a_packets();
+
+  // repeated uint64 b_packets = 3;
+  int b_packets_size() const;
+  private:
+  int _internal_b_packets_size() const;
+  public:
+  void clear_b_packets();
+  private:
+  uint64_t _internal_b_packets(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_b_packets() const;
+  void _internal_add_b_packets(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_b_packets();
+  public:
+  uint64_t b_packets(int index) const;
+  void set_b_packets(int index, uint64_t value);
+  void add_b_packets(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      b_packets() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_b_packets();
+
+  // repeated uint64 a_bytes = 4;
+  int a_bytes_size() const;
+  private:
+  int _internal_a_bytes_size() const;
+  public:
+  void clear_a_bytes();
+  private:
+  uint64_t _internal_a_bytes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_a_bytes() const;
+  void _internal_add_a_bytes(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_a_bytes();
+  public:
+  uint64_t a_bytes(int index) const;
+  void set_a_bytes(int index, uint64_t value);
+  void add_a_bytes(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      a_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_a_bytes();
+
+  // repeated uint64 b_bytes = 5;
+  int b_bytes_size() const;
+  private:
+  int _internal_b_bytes_size() const;
+  public:
+  void clear_b_bytes();
+  private:
+  uint64_t _internal_b_bytes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_b_bytes() const;
+  void _internal_add_b_bytes(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_b_bytes();
+  public:
+  uint64_t b_bytes(int index) const;
+  void set_b_bytes(int index, uint64_t value);
+  void add_b_bytes(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      b_bytes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_b_bytes();
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.ConnectionCountArrays)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ids_;
+    mutable std::atomic<int> _ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > a_packets_;
+    mutable std::atomic<int> _a_packets_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > b_packets_;
+    mutable std::atomic<int> _b_packets_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > a_bytes_;
+    mutable std::atomic<int> _a_bytes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > b_bytes_;
+    mutable std::atomic<int> _b_bytes_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_traffic_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Traffic_InterfacePacketCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_InterfacePacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_InterfacePacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_InterfacePacketCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_InterfacePacketCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_InterfacePacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_InterfacePacketCountsEntry_DoNotUse& other);
+  static const Traffic_InterfacePacketCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_InterfacePacketCountsEntry_DoNotUse*>(&_Traffic_InterfacePacketCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_CloudPacketCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_CloudPacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_CloudPacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_CloudPacketCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_CloudPacketCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_CloudPacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_CloudPacketCountsEntry_DoNotUse& other);
+  static const Traffic_CloudPacketCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_CloudPacketCountsEntry_DoNotUse*>(&_Traffic_CloudPacketCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_IpaddressPacketCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_IpaddressPacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_IpaddressPacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_IpaddressPacketCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_IpaddressPacketCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_IpaddressPacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_IpaddressPacketCountsEntry_DoNotUse& other);
+  static const Traffic_IpaddressPacketCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_IpaddressPacketCountsEntry_DoNotUse*>(&_Traffic_IpaddressPacketCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_VlanPacketCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_VlanPacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_VlanPacketCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_VlanPacketCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_VlanPacketCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_VlanPacketCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_VlanPacketCountsEntry_DoNotUse& other);
+  static const Traffic_VlanPacketCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_VlanPacketCountsEntry_DoNotUse*>(&_Traffic_VlanPacketCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_ConnectionCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_ConnectionCountsEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::ConnectionCounts,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_ConnectionCountsEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::ConnectionCounts,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  Traffic_ConnectionCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_ConnectionCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_ConnectionCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_ConnectionCountsEntry_DoNotUse& other);
+  static const Traffic_ConnectionCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_ConnectionCountsEntry_DoNotUse*>(&_Traffic_ConnectionCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_InterfaceByteCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_InterfaceByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_InterfaceByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_InterfaceByteCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_InterfaceByteCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_InterfaceByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_InterfaceByteCountsEntry_DoNotUse& other);
+  static const Traffic_InterfaceByteCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_InterfaceByteCountsEntry_DoNotUse*>(&_Traffic_InterfaceByteCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_CloudByteCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_CloudByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_CloudByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_CloudByteCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_CloudByteCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_CloudByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_CloudByteCountsEntry_DoNotUse& other);
+  static const Traffic_CloudByteCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_CloudByteCountsEntry_DoNotUse*>(&_Traffic_CloudByteCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_IpaddressByteCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_IpaddressByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_IpaddressByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_IpaddressByteCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_IpaddressByteCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_IpaddressByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_IpaddressByteCountsEntry_DoNotUse& other);
+  static const Traffic_IpaddressByteCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_IpaddressByteCountsEntry_DoNotUse*>(&_Traffic_IpaddressByteCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_VlanByteCountsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_VlanByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_VlanByteCountsEntry_DoNotUse, 
+    uint32_t, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  Traffic_VlanByteCountsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_VlanByteCountsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_VlanByteCountsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_VlanByteCountsEntry_DoNotUse& other);
+  static const Traffic_VlanByteCountsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_VlanByteCountsEntry_DoNotUse*>(&_Traffic_VlanByteCountsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_InterfaceRatesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_InterfaceRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_InterfaceRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  Traffic_InterfaceRatesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_InterfaceRatesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_InterfaceRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_InterfaceRatesEntry_DoNotUse& other);
+  static const Traffic_InterfaceRatesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_InterfaceRatesEntry_DoNotUse*>(&_Traffic_InterfaceRatesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_CloudRatesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_CloudRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_CloudRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  Traffic_CloudRatesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_CloudRatesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_CloudRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_CloudRatesEntry_DoNotUse& other);
+  static const Traffic_CloudRatesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_CloudRatesEntry_DoNotUse*>(&_Traffic_CloudRatesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_IpaddressRatesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_IpaddressRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_IpaddressRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  Traffic_IpaddressRatesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_IpaddressRatesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_IpaddressRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_IpaddressRatesEntry_DoNotUse& other);
+  static const Traffic_IpaddressRatesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_IpaddressRatesEntry_DoNotUse*>(&_Traffic_IpaddressRatesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic_VlanRatesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_VlanRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Traffic_VlanRatesEntry_DoNotUse, 
+    uint32_t, ::Lansnoop::Rate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  Traffic_VlanRatesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Traffic_VlanRatesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Traffic_VlanRatesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Traffic_VlanRatesEntry_DoNotUse& other);
+  static const Traffic_VlanRatesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Traffic_VlanRatesEntry_DoNotUse*>(&_Traffic_VlanRatesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_traffic_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Traffic final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Lansnoop.Traffic) */ {
+ public:
+  inline Traffic() : Traffic(nullptr) {}
+  ~Traffic() override;
+  explicit PROTOBUF_CONSTEXPR Traffic(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Traffic(const Traffic& from);
+  Traffic(Traffic&& from) noexcept
+    : Traffic() {
+    *this = ::std::move(from);
+  }
+
+  inline Traffic& operator=(const Traffic& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Traffic& operator=(Traffic&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Traffic& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Traffic* internal_default_instance() {
+    return reinterpret_cast<const Traffic*>(
+               &_Traffic_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(Traffic& a, Traffic& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Traffic* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Traffic* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Traffic* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Traffic>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Traffic& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Traffic& from) {
+    Traffic::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Traffic* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Lansnoop.Traffic";
+  }
+  protected:
+  explicit Traffic(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInterfacePacketCountsFieldNumber = 1,
+    kCloudPacketCountsFieldNumber = 2,
+    kIpaddressPacketCountsFieldNumber = 3,
+    kVlanPacketCountsFieldNumber = 4,
+    kConnectionCountsFieldNumber = 5,
+    kInterfaceByteCountsFieldNumber = 6,
+    kCloudByteCountsFieldNumber = 7,
+    kIpaddressByteCountsFieldNumber = 8,
+    kVlanByteCountsFieldNumber = 9,
+    kInterfaceRatesFieldNumber = 10,
+    kCloudRatesFieldNumber = 11,
+    kIpaddressRatesFieldNumber = 12,
+    kVlanRatesFieldNumber = 13,
+    kInterfacesFieldNumber = 14,
+    kCloudsFieldNumber = 15,
+    kIpaddressesFieldNumber = 16,
+    kVlansFieldNumber = 17,
+    kConnectionsFieldNumber = 18,
+  };
+  // map<uint32, uint64> interface_packet_counts = 1;
+  int interface_packet_counts_size() const;
+  private:
+  int _internal_interface_packet_counts_size() const;
+  public:
+  void clear_interface_packet_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_interface_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_interface_packet_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      interface_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_interface_packet_counts();
+
+  // map<uint32, uint64> cloud_packet_counts = 2;
+  int cloud_packet_counts_size() const;
+  private:
+  int _internal_cloud_packet_counts_size() const;
+  public:
+  void clear_cloud_packet_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_cloud_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_cloud_packet_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      cloud_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_cloud_packet_counts();
+
+  // map<uint32, uint64> ipaddress_packet_counts = 3;
+  int ipaddress_packet_counts_size() const;
+  private:
+  int _internal_ipaddress_packet_counts_size() const;
+  public:
+  void clear_ipaddress_packet_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_ipaddress_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_ipaddress_packet_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      ipaddress_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_ipaddress_packet_counts();
+
+  // map<uint32, uint64> vlan_packet_counts = 4;
+  int vlan_packet_counts_size() const;
+  private:
+  int _internal_vlan_packet_counts_size() const;
+  public:
+  void clear_vlan_packet_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_vlan_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_vlan_packet_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      vlan_packet_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_vlan_packet_counts();
+
+  // map<uint32, .Lansnoop.ConnectionCounts> connection_counts = 5;
+  int connection_counts_size() const;
+  private:
+  int _internal_connection_counts_size() const;
+  public:
+  void clear_connection_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >&
+      _internal_connection_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >*
+      _internal_mutable_connection_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >&
+      connection_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >*
+      mutable_connection_counts();
+
+  // map<uint32, uint64> interface_byte_counts = 6;
+  int interface_byte_counts_size() const;
+  private:
+  int _internal_interface_byte_counts_size() const;
+  public:
+  void clear_interface_byte_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_interface_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_interface_byte_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      interface_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_interface_byte_counts();
+
+  // map<uint32, uint64> cloud_byte_counts = 7;
+  int cloud_byte_counts_size() const;
+  private:
+  int _internal_cloud_byte_counts_size() const;
+  public:
+  void clear_cloud_byte_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_cloud_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_cloud_byte_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      cloud_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_cloud_byte_counts();
+
+  // map<uint32, uint64> ipaddress_byte_counts = 8;
+  int ipaddress_byte_counts_size() const;
+  private:
+  int _internal_ipaddress_byte_counts_size() const;
+  public:
+  void clear_ipaddress_byte_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_ipaddress_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_ipaddress_byte_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      ipaddress_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_ipaddress_byte_counts();
+
+  // map<uint32, uint64> vlan_byte_counts = 9;
+  int vlan_byte_counts_size() const;
+  private:
+  int _internal_vlan_byte_counts_size() const;
+  public:
+  void clear_vlan_byte_counts();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      _internal_vlan_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      _internal_mutable_vlan_byte_counts();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+      vlan_byte_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+      mutable_vlan_byte_counts();
+
+  // map<uint32, .Lansnoop.Rate> interface_rates = 10;
+  int interface_rates_size() const;
+  private:
+  int _internal_interface_rates_size() const;
+  public:
+  void clear_interface_rates();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      _internal_interface_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      _internal_mutable_interface_rates();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      interface_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      mutable_interface_rates();
+
+  // map<uint32, .Lansnoop.Rate> cloud_rates = 11;
+  int cloud_rates_size() const;
+  private:
+  int _internal_cloud_rates_size() const;
+  public:
+  void clear_cloud_rates();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      _internal_cloud_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      _internal_mutable_cloud_rates();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      cloud_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      mutable_cloud_rates();
+
+  // map<uint32, .Lansnoop.Rate> ipaddress_rates = 12;
+  int ipaddress_rates_size() const;
+  private:
+  int _internal_ipaddress_rates_size() const;
+  public:
+  void clear_ipaddress_rates();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      _internal_ipaddress_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      _internal_mutable_ipaddress_rates();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      ipaddress_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      mutable_ipaddress_rates();
+
+  // map<uint32, .Lansnoop.Rate> vlan_rates = 13;
+  int vlan_rates_size() const;
+  private:
+  int _internal_vlan_rates_size() const;
+  public:
+  void clear_vlan_rates();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      _internal_vlan_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      _internal_mutable_vlan_rates();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+      vlan_rates() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+      mutable_vlan_rates();
+
+  // .Lansnoop.TrafficDeltas interfaces = 14;
+  bool has_interfaces() const;
+  private:
+  bool _internal_has_interfaces() const;
+  public:
+  void clear_interfaces();
+  const ::Lansnoop::TrafficDeltas& interfaces() const;
+  PROTOBUF_NODISCARD ::Lansnoop::TrafficDeltas* release_interfaces();
+  ::Lansnoop::TrafficDeltas* mutable_interfaces();
+  void set_allocated_interfaces(::Lansnoop::TrafficDeltas* interfaces);
+  private:
+  const ::Lansnoop::TrafficDeltas& _internal_interfaces() const;
+  ::Lansnoop::TrafficDeltas* _internal_mutable_interfaces();
+  public:
+  void unsafe_arena_set_allocated_interfaces(
+      ::Lansnoop::TrafficDeltas* interfaces);
+  ::Lansnoop::TrafficDeltas* unsafe_arena_release_interfaces();
+
+  // .Lansnoop.TrafficDeltas clouds = 15;
+  bool has_clouds() const;
+  private:
+  bool _internal_has_clouds() const;
+  public:
+  void clear_clouds();
+  const ::Lansnoop::TrafficDeltas& clouds() const;
+  PROTOBUF_NODISCARD ::Lansnoop::TrafficDeltas* release_clouds();
+  ::Lansnoop::TrafficDeltas* mutable_clouds();
+  void set_allocated_clouds(::Lansnoop::TrafficDeltas* clouds);
+  private:
+  const ::Lansnoop::TrafficDeltas& _internal_clouds() const;
+  ::Lansnoop::TrafficDeltas* _internal_mutable_clouds();
+  public:
+  void unsafe_arena_set_allocated_clouds(
+      ::Lansnoop::TrafficDeltas* clouds);
+  ::Lansnoop::TrafficDeltas* unsafe_arena_release_clouds();
+
+  // .Lansnoop.TrafficDeltas ipaddresses = 16;
+  bool has_ipaddresses() const;
+  private:
+  bool _internal_has_ipaddresses() const;
+  public:
+  void clear_ipaddresses();
+  const ::Lansnoop::TrafficDeltas& ipaddresses() const;
+  PROTOBUF_NODISCARD ::Lansnoop::TrafficDeltas* release_ipaddresses();
+  ::Lansnoop::TrafficDeltas* mutable_ipaddresses();
+  void set_allocated_ipaddresses(::Lansnoop::TrafficDeltas* ipaddresses);
+  private:
+  const ::Lansnoop::TrafficDeltas& _internal_ipaddresses() const;
+  ::Lansnoop::TrafficDeltas* _internal_mutable_ipaddresses();
+  public:
+  void unsafe_arena_set_allocated_ipaddresses(
+      ::Lansnoop::TrafficDeltas* ipaddresses);
+  ::Lansnoop::TrafficDeltas* unsafe_arena_release_ipaddresses();
+
+  // .Lansnoop.TrafficDeltas vlans = 17;
+  bool has_vlans() const;
+  private:
+  bool _internal_has_vlans() const;
+  public:
+  void clear_vlans();
+  const ::Lansnoop::TrafficDeltas& vlans() const;
+  PROTOBUF_NODISCARD ::Lansnoop::TrafficDeltas* release_vlans();
+  ::Lansnoop::TrafficDeltas* mutable_vlans();
+  void set_allocated_vlans(::Lansnoop::TrafficDeltas* vlans);
+  private:
+  const ::Lansnoop::TrafficDeltas& _internal_vlans() const;
+  ::Lansnoop::TrafficDeltas* _internal_mutable_vlans();
+  public:
+  void unsafe_arena_set_allocated_vlans(
+      ::Lansnoop::TrafficDeltas* vlans);
+  ::Lansnoop::TrafficDeltas* unsafe_arena_release_vlans();
+
+  // .Lansnoop.ConnectionCountArrays connections = 18;
+  bool has_connections() const;
+  private:
+  bool _internal_has_connections() const;
+  public:
+  void clear_connections();
+  const ::Lansnoop::ConnectionCountArrays& connections() const;
+  PROTOBUF_NODISCARD ::Lansnoop::ConnectionCountArrays* release_connections();
+  ::Lansnoop::ConnectionCountArrays* mutable_connections();
+  void set_allocated_connections(::Lansnoop::ConnectionCountArrays* connections);
+  private:
+  const ::Lansnoop::ConnectionCountArrays& _internal_connections() const;
+  ::Lansnoop::ConnectionCountArrays* _internal_mutable_connections();
+  public:
+  void unsafe_arena_set_allocated_connections(
+      ::Lansnoop::ConnectionCountArrays* connections);
+  ::Lansnoop::ConnectionCountArrays* unsafe_arena_release_connections();
+
+  // @@protoc_insertion_point(class_scope:Lansnoop.Traffic)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_InterfacePacketCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> interface_packet_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_CloudPacketCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> cloud_packet_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_IpaddressPacketCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> ipaddress_packet_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_VlanPacketCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> vlan_packet_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_ConnectionCountsEntry_DoNotUse,
+        uint32_t, ::Lansnoop::ConnectionCounts,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> connection_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_InterfaceByteCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> interface_byte_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_CloudByteCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> cloud_byte_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_IpaddressByteCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> ipaddress_byte_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_VlanByteCountsEntry_DoNotUse,
+        uint32_t, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> vlan_byte_counts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_InterfaceRatesEntry_DoNotUse,
+        uint32_t, ::Lansnoop::Rate,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> interface_rates_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_CloudRatesEntry_DoNotUse,
+        uint32_t, ::Lansnoop::Rate,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> cloud_rates_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_IpaddressRatesEntry_DoNotUse,
+        uint32_t, ::Lansnoop::Rate,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> ipaddress_rates_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Traffic_VlanRatesEntry_DoNotUse,
+        uint32_t, ::Lansnoop::Rate,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> vlan_rates_;
+    ::Lansnoop::TrafficDeltas* interfaces_;
+    ::Lansnoop::TrafficDeltas* clouds_;
+    ::Lansnoop::TrafficDeltas* ipaddresses_;
+    ::Lansnoop::TrafficDeltas* vlans_;
+    ::Lansnoop::ConnectionCountArrays* connections_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_traffic_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Rate
+
+// float packets_per_second = 1;
+inline void Rate::clear_packets_per_second() {
+  _impl_.packets_per_second_ = 0;
+}
+inline float Rate::_internal_packets_per_second() const {
+  return _impl_.packets_per_second_;
+}
+inline float Rate::packets_per_second() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Rate.packets_per_second)
+  return _internal_packets_per_second();
+}
+inline void Rate::_internal_set_packets_per_second(float value) {
+  
+  _impl_.packets_per_second_ = value;
+}
+inline void Rate::set_packets_per_second(float value) {
+  _internal_set_packets_per_second(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Rate.packets_per_second)
+}
+
+// float bits_per_second = 2;
+inline void Rate::clear_bits_per_second() {
+  _impl_.bits_per_second_ = 0;
+}
+inline float Rate::_internal_bits_per_second() const {
+  return _impl_.bits_per_second_;
+}
+inline float Rate::bits_per_second() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Rate.bits_per_second)
+  return _internal_bits_per_second();
+}
+inline void Rate::_internal_set_bits_per_second(float value) {
+  
+  _impl_.bits_per_second_ = value;
+}
+inline void Rate::set_bits_per_second(float value) {
+  _internal_set_bits_per_second(value);
+  // @@protoc_insertion_point(field_set:Lansnoop.Rate.bits_per_second)
+}
+
+// -------------------------------------------------------------------
+
+// TrafficDeltas
+
+// repeated uint32 ids = 1;
+inline int TrafficDeltas::_internal_ids_size() const {
+  return _impl_.ids_.size();
+}
+inline int TrafficDeltas::ids_size() const {
+  return _internal_ids_size();
+}
+inline void TrafficDeltas::clear_ids() {
+  _impl_.ids_.Clear();
+}
+inline uint32_t TrafficDeltas::_internal_ids(int index) const {
+  return _impl_.ids_.Get(index);
+}
+inline uint32_t TrafficDeltas::ids(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.TrafficDeltas.ids)
+  return _internal_ids(index);
+}
+inline void TrafficDeltas::set_ids(int index, uint32_t value) {
+  _impl_.ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.TrafficDeltas.ids)
+}
+inline void TrafficDeltas::_internal_add_ids(uint32_t value) {
+  _impl_.ids_.Add(value);
+}
+inline void TrafficDeltas::add_ids(uint32_t value) {
+  _internal_add_ids(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.TrafficDeltas.ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TrafficDeltas::_internal_ids() const {
+  return _impl_.ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TrafficDeltas::ids() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.TrafficDeltas.ids)
+  return _internal_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TrafficDeltas::_internal_mutable_ids() {
+  return &_impl_.ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TrafficDeltas::mutable_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.TrafficDeltas.ids)
+  return _internal_mutable_ids();
+}
+
+// repeated uint64 packets = 2;
+inline int TrafficDeltas::_internal_packets_size() const {
+  return _impl_.packets_.size();
+}
+inline int TrafficDeltas::packets_size() const {
+  return _internal_packets_size();
+}
+inline void TrafficDeltas::clear_packets() {
+  _impl_.packets_.Clear();
+}
+inline uint64_t TrafficDeltas::_internal_packets(int index) const {
+  return _impl_.packets_.Get(index);
+}
+inline uint64_t TrafficDeltas::packets(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.TrafficDeltas.packets)
+  return _internal_packets(index);
+}
+inline void TrafficDeltas::set_packets(int index, uint64_t value) {
+  _impl_.packets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.TrafficDeltas.packets)
+}
+inline void TrafficDeltas::_internal_add_packets(uint64_t value) {
+  _impl_.packets_.Add(value);
+}
+inline void TrafficDeltas::add_packets(uint64_t value) {
+  _internal_add_packets(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.TrafficDeltas.packets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+TrafficDeltas::_internal_packets() const {
+  return _impl_.packets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+TrafficDeltas::packets() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.TrafficDeltas.packets)
+  return _internal_packets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+TrafficDeltas::_internal_mutable_packets() {
+  return &_impl_.packets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+TrafficDeltas::mutable_packets() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.TrafficDeltas.packets)
+  return _internal_mutable_packets();
+}
+
+// repeated uint64 bytes = 3;
+inline int TrafficDeltas::_internal_bytes_size() const {
+  return _impl_.bytes_.size();
+}
+inline int TrafficDeltas::bytes_size() const {
+  return _internal_bytes_size();
+}
+inline void TrafficDeltas::clear_bytes() {
+  _impl_.bytes_.Clear();
+}
+inline uint64_t TrafficDeltas::_internal_bytes(int index) const {
+  return _impl_.bytes_.Get(index);
+}
+inline uint64_t TrafficDeltas::bytes(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.TrafficDeltas.bytes)
+  return _internal_bytes(index);
+}
+inline void TrafficDeltas::set_bytes(int index, uint64_t value) {
+  _impl_.bytes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.TrafficDeltas.bytes)
+}
+inline void TrafficDeltas::_internal_add_bytes(uint64_t value) {
+  _impl_.bytes_.Add(value);
+}
+inline void TrafficDeltas::add_bytes(uint64_t value) {
+  _internal_add_bytes(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.TrafficDeltas.bytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+TrafficDeltas::_internal_bytes() const {
+  return _impl_.bytes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+TrafficDeltas::bytes() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.TrafficDeltas.bytes)
+  return _internal_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+TrafficDeltas::_internal_mutable_bytes() {
+  return &_impl_.bytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+TrafficDeltas::mutable_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.TrafficDeltas.bytes)
+  return _internal_mutable_bytes();
+}
+
+// repeated uint32 rate_ids = 4;
+inline int TrafficDeltas::_internal_rate_ids_size() const {
+  return _impl_.rate_ids_.size();
+}
+inline int TrafficDeltas::rate_ids_size() const {
+  return _internal_rate_ids_size();
+}
+inline void TrafficDeltas::clear_rate_ids() {
+  _impl_.rate_ids_.Clear();
+}
+inline uint32_t TrafficDeltas::_internal_rate_ids(int index) const {
+  return _impl_.rate_ids_.Get(index);
+}
+inline uint32_t TrafficDeltas::rate_ids(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.TrafficDeltas.rate_ids)
+  return _internal_rate_ids(index);
+}
+inline void TrafficDeltas::set_rate_ids(int index, uint32_t value) {
+  _impl_.rate_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.TrafficDeltas.rate_ids)
+}
+inline void TrafficDeltas::_internal_add_rate_ids(uint32_t value) {
+  _impl_.rate_ids_.Add(value);
+}
+inline void TrafficDeltas::add_rate_ids(uint32_t value) {
+  _internal_add_rate_ids(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.TrafficDeltas.rate_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TrafficDeltas::_internal_rate_ids() const {
+  return _impl_.rate_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TrafficDeltas::rate_ids() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.TrafficDeltas.rate_ids)
+  return _internal_rate_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TrafficDeltas::_internal_mutable_rate_ids() {
+  return &_impl_.rate_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TrafficDeltas::mutable_rate_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.TrafficDeltas.rate_ids)
+  return _internal_mutable_rate_ids();
+}
+
+// repeated float packets_per_second = 5;
+inline int TrafficDeltas::_internal_packets_per_second_size() const {
+  return _impl_.packets_per_second_.size();
+}
+inline int TrafficDeltas::packets_per_second_size() const {
+  return _internal_packets_per_second_size();
+}
+inline void TrafficDeltas::clear_packets_per_second() {
+  _impl_.packets_per_second_.Clear();
+}
+inline float TrafficDeltas::_internal_packets_per_second(int index) const {
+  return _impl_.packets_per_second_.Get(index);
+}
+inline float TrafficDeltas::packets_per_second(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.TrafficDeltas.packets_per_second)
+  return _internal_packets_per_second(index);
+}
+inline void TrafficDeltas::set_packets_per_second(int index, float value) {
+  _impl_.packets_per_second_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.TrafficDeltas.packets_per_second)
+}
+inline void TrafficDeltas::_internal_add_packets_per_second(float value) {
+  _impl_.packets_per_second_.Add(value);
+}
+inline void TrafficDeltas::add_packets_per_second(float value) {
+  _internal_add_packets_per_second(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.TrafficDeltas.packets_per_second)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TrafficDeltas::_internal_packets_per_second() const {
+  return _impl_.packets_per_second_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TrafficDeltas::packets_per_second() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.TrafficDeltas.packets_per_second)
+  return _internal_packets_per_second();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TrafficDeltas::_internal_mutable_packets_per_second() {
+  return &_impl_.packets_per_second_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TrafficDeltas::mutable_packets_per_second() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.TrafficDeltas.packets_per_second)
+  return _internal_mutable_packets_per_second();
+}
+
+// repeated float bits_per_second = 6;
+inline int TrafficDeltas::_internal_bits_per_second_size() const {
+  return _impl_.bits_per_second_.size();
+}
+inline int TrafficDeltas::bits_per_second_size() const {
+  return _internal_bits_per_second_size();
+}
+inline void TrafficDeltas::clear_bits_per_second() {
+  _impl_.bits_per_second_.Clear();
+}
+inline float TrafficDeltas::_internal_bits_per_second(int index) const {
+  return _impl_.bits_per_second_.Get(index);
+}
+inline float TrafficDeltas::bits_per_second(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.TrafficDeltas.bits_per_second)
+  return _internal_bits_per_second(index);
+}
+inline void TrafficDeltas::set_bits_per_second(int index, float value) {
+  _impl_.bits_per_second_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.TrafficDeltas.bits_per_second)
+}
+inline void TrafficDeltas::_internal_add_bits_per_second(float value) {
+  _impl_.bits_per_second_.Add(value);
+}
+inline void TrafficDeltas::add_bits_per_second(float value) {
+  _internal_add_bits_per_second(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.TrafficDeltas.bits_per_second)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TrafficDeltas::_internal_bits_per_second() const {
+  return _impl_.bits_per_second_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TrafficDeltas::bits_per_second() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.TrafficDeltas.bits_per_second)
+  return _internal_bits_per_second();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TrafficDeltas::_internal_mutable_bits_per_second() {
+  return &_impl_.bits_per_second_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TrafficDeltas::mutable_bits_per_second() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.TrafficDeltas.bits_per_second)
+  return _internal_mutable_bits_per_second();
+}
+
+// -------------------------------------------------------------------
+
+// ConnectionCountArrays
+
+// repeated uint32 ids = 1;
+inline int ConnectionCountArrays::_internal_ids_size() const {
+  return _impl_.ids_.size();
+}
+inline int ConnectionCountArrays::ids_size() const {
+  return _internal_ids_size();
+}
+inline void ConnectionCountArrays::clear_ids() {
+  _impl_.ids_.Clear();
+}
+inline uint32_t ConnectionCountArrays::_internal_ids(int index) const {
+  return _impl_.ids_.Get(index);
+}
+inline uint32_t ConnectionCountArrays::ids(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCountArrays.ids)
+  return _internal_ids(index);
+}
+inline void ConnectionCountArrays::set_ids(int index, uint32_t value) {
+  _impl_.ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCountArrays.ids)
+}
+inline void ConnectionCountArrays::_internal_add_ids(uint32_t value) {
+  _impl_.ids_.Add(value);
+}
+inline void ConnectionCountArrays::add_ids(uint32_t value) {
+  _internal_add_ids(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.ConnectionCountArrays.ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ConnectionCountArrays::_internal_ids() const {
+  return _impl_.ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ConnectionCountArrays::ids() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.ConnectionCountArrays.ids)
+  return _internal_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ConnectionCountArrays::_internal_mutable_ids() {
+  return &_impl_.ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ConnectionCountArrays::mutable_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.ConnectionCountArrays.ids)
+  return _internal_mutable_ids();
+}
+
+// repeated uint64 a_packets = 2;
+inline int ConnectionCountArrays::_internal_a_packets_size() const {
+  return _impl_.a_packets_.size();
+}
+inline int ConnectionCountArrays::a_packets_size() const {
+  return _internal_a_packets_size();
+}
+inline void ConnectionCountArrays::clear_a_packets() {
+  _impl_.a_packets_.Clear();
+}
+inline uint64_t ConnectionCountArrays::_internal_a_packets(int index) const {
+  return _impl_.a_packets_.Get(index);
+}
+inline uint64_t ConnectionCountArrays::a_packets(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCountArrays.a_packets)
+  return _internal_a_packets(index);
+}
+inline void ConnectionCountArrays::set_a_packets(int index, uint64_t value) {
+  _impl_.a_packets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCountArrays.a_packets)
+}
+inline void ConnectionCountArrays::_internal_add_a_packets(uint64_t value) {
+  _impl_.a_packets_.Add(value);
+}
+inline void ConnectionCountArrays::add_a_packets(uint64_t value) {
+  _internal_add_a_packets(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.ConnectionCountArrays.a_packets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::_internal_a_packets() const {
+  return _impl_.a_packets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::a_packets() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.ConnectionCountArrays.a_packets)
+  return _internal_a_packets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::_internal_mutable_a_packets() {
+  return &_impl_.a_packets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::mutable_a_packets() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.ConnectionCountArrays.a_packets)
+  return _internal_mutable_a_packets();
+}
+
+// repeated uint64 b_packets = 3;
+inline int ConnectionCountArrays::_internal_b_packets_size() const {
+  return _impl_.b_packets_.size();
+}
+inline int ConnectionCountArrays::b_packets_size() const {
+  return _internal_b_packets_size();
+}
+inline void ConnectionCountArrays::clear_b_packets() {
+  _impl_.b_packets_.Clear();
+}
+inline uint64_t ConnectionCountArrays::_internal_b_packets(int index) const {
+  return _impl_.b_packets_.Get(index);
+}
+inline uint64_t ConnectionCountArrays::b_packets(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCountArrays.b_packets)
+  return _internal_b_packets(index);
+}
+inline void ConnectionCountArrays::set_b_packets(int index, uint64_t value) {
+  _impl_.b_packets_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCountArrays.b_packets)
+}
+inline void ConnectionCountArrays::_internal_add_b_packets(uint64_t value) {
+  _impl_.b_packets_.Add(value);
+}
+inline void ConnectionCountArrays::add_b_packets(uint64_t value) {
+  _internal_add_b_packets(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.ConnectionCountArrays.b_packets)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::_internal_b_packets() const {
+  return _impl_.b_packets_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::b_packets() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.ConnectionCountArrays.b_packets)
+  return _internal_b_packets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::_internal_mutable_b_packets() {
+  return &_impl_.b_packets_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::mutable_b_packets() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.ConnectionCountArrays.b_packets)
+  return _internal_mutable_b_packets();
+}
+
+// repeated uint64 a_bytes = 4;
+inline int ConnectionCountArrays::_internal_a_bytes_size() const {
+  return _impl_.a_bytes_.size();
+}
+inline int ConnectionCountArrays::a_bytes_size() const {
+  return _internal_a_bytes_size();
+}
+inline void ConnectionCountArrays::clear_a_bytes() {
+  _impl_.a_bytes_.Clear();
+}
+inline uint64_t ConnectionCountArrays::_internal_a_bytes(int index) const {
+  return _impl_.a_bytes_.Get(index);
+}
+inline uint64_t ConnectionCountArrays::a_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCountArrays.a_bytes)
+  return _internal_a_bytes(index);
+}
+inline void ConnectionCountArrays::set_a_bytes(int index, uint64_t value) {
+  _impl_.a_bytes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCountArrays.a_bytes)
+}
+inline void ConnectionCountArrays::_internal_add_a_bytes(uint64_t value) {
+  _impl_.a_bytes_.Add(value);
+}
+inline void ConnectionCountArrays::add_a_bytes(uint64_t value) {
+  _internal_add_a_bytes(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.ConnectionCountArrays.a_bytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::_internal_a_bytes() const {
+  return _impl_.a_bytes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::a_bytes() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.ConnectionCountArrays.a_bytes)
+  return _internal_a_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::_internal_mutable_a_bytes() {
+  return &_impl_.a_bytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::mutable_a_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.ConnectionCountArrays.a_bytes)
+  return _internal_mutable_a_bytes();
+}
+
+// repeated uint64 b_bytes = 5;
+inline int ConnectionCountArrays::_internal_b_bytes_size() const {
+  return _impl_.b_bytes_.size();
+}
+inline int ConnectionCountArrays::b_bytes_size() const {
+  return _internal_b_bytes_size();
+}
+inline void ConnectionCountArrays::clear_b_bytes() {
+  _impl_.b_bytes_.Clear();
+}
+inline uint64_t ConnectionCountArrays::_internal_b_bytes(int index) const {
+  return _impl_.b_bytes_.Get(index);
+}
+inline uint64_t ConnectionCountArrays::b_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:Lansnoop.ConnectionCountArrays.b_bytes)
+  return _internal_b_bytes(index);
+}
+inline void ConnectionCountArrays::set_b_bytes(int index, uint64_t value) {
+  _impl_.b_bytes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Lansnoop.ConnectionCountArrays.b_bytes)
+}
+inline void ConnectionCountArrays::_internal_add_b_bytes(uint64_t value) {
+  _impl_.b_bytes_.Add(value);
+}
+inline void ConnectionCountArrays::add_b_bytes(uint64_t value) {
+  _internal_add_b_bytes(value);
+  // @@protoc_insertion_point(field_add:Lansnoop.ConnectionCountArrays.b_bytes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::_internal_b_bytes() const {
+  return _impl_.b_bytes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConnectionCountArrays::b_bytes() const {
+  // @@protoc_insertion_point(field_list:Lansnoop.ConnectionCountArrays.b_bytes)
+  return _internal_b_bytes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::_internal_mutable_b_bytes() {
+  return &_impl_.b_bytes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConnectionCountArrays::mutable_b_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:Lansnoop.ConnectionCountArrays.b_bytes)
+  return _internal_mutable_b_bytes();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// Traffic
+
+// map<uint32, uint64> interface_packet_counts = 1;
+inline int Traffic::_internal_interface_packet_counts_size() const {
+  return _impl_.interface_packet_counts_.size();
+}
+inline int Traffic::interface_packet_counts_size() const {
+  return _internal_interface_packet_counts_size();
+}
+inline void Traffic::clear_interface_packet_counts() {
+  _impl_.interface_packet_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_interface_packet_counts() const {
+  return _impl_.interface_packet_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::interface_packet_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.interface_packet_counts)
+  return _internal_interface_packet_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_interface_packet_counts() {
+  return _impl_.interface_packet_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_interface_packet_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.interface_packet_counts)
+  return _internal_mutable_interface_packet_counts();
+}
+
+// map<uint32, uint64> cloud_packet_counts = 2;
+inline int Traffic::_internal_cloud_packet_counts_size() const {
+  return _impl_.cloud_packet_counts_.size();
+}
+inline int Traffic::cloud_packet_counts_size() const {
+  return _internal_cloud_packet_counts_size();
+}
+inline void Traffic::clear_cloud_packet_counts() {
+  _impl_.cloud_packet_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_cloud_packet_counts() const {
+  return _impl_.cloud_packet_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::cloud_packet_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.cloud_packet_counts)
+  return _internal_cloud_packet_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_cloud_packet_counts() {
+  return _impl_.cloud_packet_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_cloud_packet_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.cloud_packet_counts)
+  return _internal_mutable_cloud_packet_counts();
+}
+
+// map<uint32, uint64> ipaddress_packet_counts = 3;
+inline int Traffic::_internal_ipaddress_packet_counts_size() const {
+  return _impl_.ipaddress_packet_counts_.size();
+}
+inline int Traffic::ipaddress_packet_counts_size() const {
+  return _internal_ipaddress_packet_counts_size();
+}
+inline void Traffic::clear_ipaddress_packet_counts() {
+  _impl_.ipaddress_packet_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_ipaddress_packet_counts() const {
+  return _impl_.ipaddress_packet_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::ipaddress_packet_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.ipaddress_packet_counts)
+  return _internal_ipaddress_packet_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_ipaddress_packet_counts() {
+  return _impl_.ipaddress_packet_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_ipaddress_packet_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.ipaddress_packet_counts)
+  return _internal_mutable_ipaddress_packet_counts();
+}
+
+// map<uint32, uint64> vlan_packet_counts = 4;
+inline int Traffic::_internal_vlan_packet_counts_size() const {
+  return _impl_.vlan_packet_counts_.size();
+}
+inline int Traffic::vlan_packet_counts_size() const {
+  return _internal_vlan_packet_counts_size();
+}
+inline void Traffic::clear_vlan_packet_counts() {
+  _impl_.vlan_packet_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_vlan_packet_counts() const {
+  return _impl_.vlan_packet_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::vlan_packet_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.vlan_packet_counts)
+  return _internal_vlan_packet_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_vlan_packet_counts() {
+  return _impl_.vlan_packet_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_vlan_packet_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.vlan_packet_counts)
+  return _internal_mutable_vlan_packet_counts();
+}
+
+// map<uint32, .Lansnoop.ConnectionCounts> connection_counts = 5;
+inline int Traffic::_internal_connection_counts_size() const {
+  return _impl_.connection_counts_.size();
+}
+inline int Traffic::connection_counts_size() const {
+  return _internal_connection_counts_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >&
+Traffic::_internal_connection_counts() const {
+  return _impl_.connection_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >&
+Traffic::connection_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.connection_counts)
+  return _internal_connection_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >*
+Traffic::_internal_mutable_connection_counts() {
+  return _impl_.connection_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::ConnectionCounts >*
+Traffic::mutable_connection_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.connection_counts)
+  return _internal_mutable_connection_counts();
+}
+
+// map<uint32, uint64> interface_byte_counts = 6;
+inline int Traffic::_internal_interface_byte_counts_size() const {
+  return _impl_.interface_byte_counts_.size();
+}
+inline int Traffic::interface_byte_counts_size() const {
+  return _internal_interface_byte_counts_size();
+}
+inline void Traffic::clear_interface_byte_counts() {
+  _impl_.interface_byte_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_interface_byte_counts() const {
+  return _impl_.interface_byte_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::interface_byte_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.interface_byte_counts)
+  return _internal_interface_byte_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_interface_byte_counts() {
+  return _impl_.interface_byte_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_interface_byte_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.interface_byte_counts)
+  return _internal_mutable_interface_byte_counts();
+}
+
+// map<uint32, uint64> cloud_byte_counts = 7;
+inline int Traffic::_internal_cloud_byte_counts_size() const {
+  return _impl_.cloud_byte_counts_.size();
+}
+inline int Traffic::cloud_byte_counts_size() const {
+  return _internal_cloud_byte_counts_size();
+}
+inline void Traffic::clear_cloud_byte_counts() {
+  _impl_.cloud_byte_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_cloud_byte_counts() const {
+  return _impl_.cloud_byte_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::cloud_byte_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.cloud_byte_counts)
+  return _internal_cloud_byte_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_cloud_byte_counts() {
+  return _impl_.cloud_byte_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_cloud_byte_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.cloud_byte_counts)
+  return _internal_mutable_cloud_byte_counts();
+}
+
+// map<uint32, uint64> ipaddress_byte_counts = 8;
+inline int Traffic::_internal_ipaddress_byte_counts_size() const {
+  return _impl_.ipaddress_byte_counts_.size();
+}
+inline int Traffic::ipaddress_byte_counts_size() const {
+  return _internal_ipaddress_byte_counts_size();
+}
+inline void Traffic::clear_ipaddress_byte_counts() {
+  _impl_.ipaddress_byte_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_ipaddress_byte_counts() const {
+  return _impl_.ipaddress_byte_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::ipaddress_byte_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.ipaddress_byte_counts)
+  return _internal_ipaddress_byte_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_ipaddress_byte_counts() {
+  return _impl_.ipaddress_byte_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_ipaddress_byte_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.ipaddress_byte_counts)
+  return _internal_mutable_ipaddress_byte_counts();
+}
+
+// map<uint32, uint64> vlan_byte_counts = 9;
+inline int Traffic::_internal_vlan_byte_counts_size() const {
+  return _impl_.vlan_byte_counts_.size();
+}
+inline int Traffic::vlan_byte_counts_size() const {
+  return _internal_vlan_byte_counts_size();
+}
+inline void Traffic::clear_vlan_byte_counts() {
+  _impl_.vlan_byte_counts_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::_internal_vlan_byte_counts() const {
+  return _impl_.vlan_byte_counts_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >&
+Traffic::vlan_byte_counts() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.vlan_byte_counts)
+  return _internal_vlan_byte_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::_internal_mutable_vlan_byte_counts() {
+  return _impl_.vlan_byte_counts_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, uint64_t >*
+Traffic::mutable_vlan_byte_counts() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.vlan_byte_counts)
+  return _internal_mutable_vlan_byte_counts();
+}
+
+// map<uint32, .Lansnoop.Rate> interface_rates = 10;
+inline int Traffic::_internal_interface_rates_size() const {
+  return _impl_.interface_rates_.size();
+}
+inline int Traffic::interface_rates_size() const {
+  return _internal_interface_rates_size();
+}
+inline void Traffic::clear_interface_rates() {
+  _impl_.interface_rates_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::_internal_interface_rates() const {
+  return _impl_.interface_rates_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::interface_rates() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.interface_rates)
+  return _internal_interface_rates();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::_internal_mutable_interface_rates() {
+  return _impl_.interface_rates_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::mutable_interface_rates() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.interface_rates)
+  return _internal_mutable_interface_rates();
+}
+
+// map<uint32, .Lansnoop.Rate> cloud_rates = 11;
+inline int Traffic::_internal_cloud_rates_size() const {
+  return _impl_.cloud_rates_.size();
+}
+inline int Traffic::cloud_rates_size() const {
+  return _internal_cloud_rates_size();
+}
+inline void Traffic::clear_cloud_rates() {
+  _impl_.cloud_rates_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::_internal_cloud_rates() const {
+  return _impl_.cloud_rates_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::cloud_rates() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.cloud_rates)
+  return _internal_cloud_rates();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::_internal_mutable_cloud_rates() {
+  return _impl_.cloud_rates_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::mutable_cloud_rates() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.cloud_rates)
+  return _internal_mutable_cloud_rates();
+}
+
+// map<uint32, .Lansnoop.Rate> ipaddress_rates = 12;
+inline int Traffic::_internal_ipaddress_rates_size() const {
+  return _impl_.ipaddress_rates_.size();
+}
+inline int Traffic::ipaddress_rates_size() const {
+  return _internal_ipaddress_rates_size();
+}
+inline void Traffic::clear_ipaddress_rates() {
+  _impl_.ipaddress_rates_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::_internal_ipaddress_rates() const {
+  return _impl_.ipaddress_rates_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::ipaddress_rates() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.ipaddress_rates)
+  return _internal_ipaddress_rates();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::_internal_mutable_ipaddress_rates() {
+  return _impl_.ipaddress_rates_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::mutable_ipaddress_rates() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.ipaddress_rates)
+  return _internal_mutable_ipaddress_rates();
+}
+
+// map<uint32, .Lansnoop.Rate> vlan_rates = 13;
+inline int Traffic::_internal_vlan_rates_size() const {
+  return _impl_.vlan_rates_.size();
+}
+inline int Traffic::vlan_rates_size() const {
+  return _internal_vlan_rates_size();
+}
+inline void Traffic::clear_vlan_rates() {
+  _impl_.vlan_rates_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::_internal_vlan_rates() const {
+  return _impl_.vlan_rates_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >&
+Traffic::vlan_rates() const {
+  // @@protoc_insertion_point(field_map:Lansnoop.Traffic.vlan_rates)
+  return _internal_vlan_rates();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::_internal_mutable_vlan_rates() {
+  return _impl_.vlan_rates_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint32_t, ::Lansnoop::Rate >*
+Traffic::mutable_vlan_rates() {
+  // @@protoc_insertion_point(field_mutable_map:Lansnoop.Traffic.vlan_rates)
+  return _internal_mutable_vlan_rates();
+}
+
+// .Lansnoop.TrafficDeltas interfaces = 14;
+inline bool Traffic::_internal_has_interfaces() const {
+  return this != internal_default_instance() && _impl_.interfaces_ != nullptr;
+}
+inline bool Traffic::has_interfaces() const {
+  return _internal_has_interfaces();
+}
+inline void Traffic::clear_interfaces() {
+  if (GetArenaForAllocation() == nullptr && _impl_.interfaces_ != nullptr) {
+    delete _impl_.interfaces_;
+  }
+  _impl_.interfaces_ = nullptr;
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::_internal_interfaces() const {
+  const ::Lansnoop::TrafficDeltas* p = _impl_.interfaces_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lansnoop::TrafficDeltas&>(
+      ::Lansnoop::_TrafficDeltas_default_instance_);
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::interfaces() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Traffic.interfaces)
+  return _internal_interfaces();
+}
+inline void Traffic::unsafe_arena_set_allocated_interfaces(
+    ::Lansnoop::TrafficDeltas* interfaces) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.interfaces_);
+  }
+  _impl_.interfaces_ = interfaces;
+  if (interfaces) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Traffic.interfaces)
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::release_interfaces() {
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.interfaces_;
+  _impl_.interfaces_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::unsafe_arena_release_interfaces() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Traffic.interfaces)
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.interfaces_;
+  _impl_.interfaces_ = nullptr;
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::_internal_mutable_interfaces() {
+  
+  if (_impl_.interfaces_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lansnoop::TrafficDeltas>(GetArenaForAllocation());
+    _impl_.interfaces_ = p;
+  }
+  return _impl_.interfaces_;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::mutable_interfaces() {
+  ::Lansnoop::TrafficDeltas* _msg = _internal_mutable_interfaces();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Traffic.interfaces)
+  return _msg;
+}
+inline void Traffic::set_allocated_interfaces(::Lansnoop::TrafficDeltas* interfaces) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.interfaces_;
+  }
+  if (interfaces) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(interfaces);
+    if (message_arena != submessage_arena) {
+      interfaces = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, interfaces, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.interfaces_ = interfaces;
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Traffic.interfaces)
+}
+
+// .Lansnoop.TrafficDeltas clouds = 15;
+inline bool Traffic::_internal_has_clouds() const {
+  return this != internal_default_instance() && _impl_.clouds_ != nullptr;
+}
+inline bool Traffic::has_clouds() const {
+  return _internal_has_clouds();
+}
+inline void Traffic::clear_clouds() {
+  if (GetArenaForAllocation() == nullptr && _impl_.clouds_ != nullptr) {
+    delete _impl_.clouds_;
+  }
+  _impl_.clouds_ = nullptr;
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::_internal_clouds() const {
+  const ::Lansnoop::TrafficDeltas* p = _impl_.clouds_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lansnoop::TrafficDeltas&>(
+      ::Lansnoop::_TrafficDeltas_default_instance_);
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::clouds() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Traffic.clouds)
+  return _internal_clouds();
+}
+inline void Traffic::unsafe_arena_set_allocated_clouds(
+    ::Lansnoop::TrafficDeltas* clouds) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.clouds_);
+  }
+  _impl_.clouds_ = clouds;
+  if (clouds) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Traffic.clouds)
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::release_clouds() {
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.clouds_;
+  _impl_.clouds_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::unsafe_arena_release_clouds() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Traffic.clouds)
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.clouds_;
+  _impl_.clouds_ = nullptr;
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::_internal_mutable_clouds() {
+  
+  if (_impl_.clouds_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lansnoop::TrafficDeltas>(GetArenaForAllocation());
+    _impl_.clouds_ = p;
+  }
+  return _impl_.clouds_;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::mutable_clouds() {
+  ::Lansnoop::TrafficDeltas* _msg = _internal_mutable_clouds();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Traffic.clouds)
+  return _msg;
+}
+inline void Traffic::set_allocated_clouds(::Lansnoop::TrafficDeltas* clouds) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.clouds_;
+  }
+  if (clouds) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clouds);
+    if (message_arena != submessage_arena) {
+      clouds = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clouds, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.clouds_ = clouds;
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Traffic.clouds)
+}
+
+// .Lansnoop.TrafficDeltas ipaddresses = 16;
+inline bool Traffic::_internal_has_ipaddresses() const {
+  return this != internal_default_instance() && _impl_.ipaddresses_ != nullptr;
+}
+inline bool Traffic::has_ipaddresses() const {
+  return _internal_has_ipaddresses();
+}
+inline void Traffic::clear_ipaddresses() {
+  if (GetArenaForAllocation() == nullptr && _impl_.ipaddresses_ != nullptr) {
+    delete _impl_.ipaddresses_;
+  }
+  _impl_.ipaddresses_ = nullptr;
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::_internal_ipaddresses() const {
+  const ::Lansnoop::TrafficDeltas* p = _impl_.ipaddresses_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lansnoop::TrafficDeltas&>(
+      ::Lansnoop::_TrafficDeltas_default_instance_);
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::ipaddresses() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Traffic.ipaddresses)
+  return _internal_ipaddresses();
+}
+inline void Traffic::unsafe_arena_set_allocated_ipaddresses(
+    ::Lansnoop::TrafficDeltas* ipaddresses) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ipaddresses_);
+  }
+  _impl_.ipaddresses_ = ipaddresses;
+  if (ipaddresses) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Traffic.ipaddresses)
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::release_ipaddresses() {
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.ipaddresses_;
+  _impl_.ipaddresses_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::unsafe_arena_release_ipaddresses() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Traffic.ipaddresses)
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.ipaddresses_;
+  _impl_.ipaddresses_ = nullptr;
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::_internal_mutable_ipaddresses() {
+  
+  if (_impl_.ipaddresses_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lansnoop::TrafficDeltas>(GetArenaForAllocation());
+    _impl_.ipaddresses_ = p;
+  }
+  return _impl_.ipaddresses_;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::mutable_ipaddresses() {
+  ::Lansnoop::TrafficDeltas* _msg = _internal_mutable_ipaddresses();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Traffic.ipaddresses)
+  return _msg;
+}
+inline void Traffic::set_allocated_ipaddresses(::Lansnoop::TrafficDeltas* ipaddresses) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ipaddresses_;
+  }
+  if (ipaddresses) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ipaddresses);
+    if (message_arena != submessage_arena) {
+      ipaddresses = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ipaddresses, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.ipaddresses_ = ipaddresses;
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Traffic.ipaddresses)
+}
+
+// .Lansnoop.TrafficDeltas vlans = 17;
+inline bool Traffic::_internal_has_vlans() const {
+  return this != internal_default_instance() && _impl_.vlans_ != nullptr;
+}
+inline bool Traffic::has_vlans() const {
+  return _internal_has_vlans();
+}
+inline void Traffic::clear_vlans() {
+  if (GetArenaForAllocation() == nullptr && _impl_.vlans_ != nullptr) {
+    delete _impl_.vlans_;
+  }
+  _impl_.vlans_ = nullptr;
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::_internal_vlans() const {
+  const ::Lansnoop::TrafficDeltas* p = _impl_.vlans_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lansnoop::TrafficDeltas&>(
+      ::Lansnoop::_TrafficDeltas_default_instance_);
+}
+inline const ::Lansnoop::TrafficDeltas& Traffic::vlans() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Traffic.vlans)
+  return _internal_vlans();
+}
+inline void Traffic::unsafe_arena_set_allocated_vlans(
+    ::Lansnoop::TrafficDeltas* vlans) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vlans_);
+  }
+  _impl_.vlans_ = vlans;
+  if (vlans) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Traffic.vlans)
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::release_vlans() {
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.vlans_;
+  _impl_.vlans_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::unsafe_arena_release_vlans() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Traffic.vlans)
+  
+  ::Lansnoop::TrafficDeltas* temp = _impl_.vlans_;
+  _impl_.vlans_ = nullptr;
+  return temp;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::_internal_mutable_vlans() {
+  
+  if (_impl_.vlans_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lansnoop::TrafficDeltas>(GetArenaForAllocation());
+    _impl_.vlans_ = p;
+  }
+  return _impl_.vlans_;
+}
+inline ::Lansnoop::TrafficDeltas* Traffic::mutable_vlans() {
+  ::Lansnoop::TrafficDeltas* _msg = _internal_mutable_vlans();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Traffic.vlans)
+  return _msg;
+}
+inline void Traffic::set_allocated_vlans(::Lansnoop::TrafficDeltas* vlans) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.vlans_;
+  }
+  if (vlans) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vlans);
+    if (message_arena != submessage_arena) {
+      vlans = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vlans, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.vlans_ = vlans;
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Traffic.vlans)
+}
+
+// .Lansnoop.ConnectionCountArrays connections = 18;
+inline bool Traffic::_internal_has_connections() const {
+  return this != internal_default_instance() && _impl_.connections_ != nullptr;
+}
+inline bool Traffic::has_connections() const {
+  return _internal_has_connections();
+}
+inline void Traffic::clear_connections() {
+  if (GetArenaForAllocation() == nullptr && _impl_.connections_ != nullptr) {
+    delete _impl_.connections_;
+  }
+  _impl_.connections_ = nullptr;
+}
+inline const ::Lansnoop::ConnectionCountArrays& Traffic::_internal_connections() const {
+  const ::Lansnoop::ConnectionCountArrays* p = _impl_.connections_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Lansnoop::ConnectionCountArrays&>(
+      ::Lansnoop::_ConnectionCountArrays_default_instance_);
+}
+inline const ::Lansnoop::ConnectionCountArrays& Traffic::connections() const {
+  // @@protoc_insertion_point(field_get:Lansnoop.Traffic.connections)
+  return _internal_connections();
+}
+inline void Traffic::unsafe_arena_set_allocated_connections(
+    ::Lansnoop::ConnectionCountArrays* connections) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.connections_);
+  }
+  _impl_.connections_ = connections;
+  if (connections) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Lansnoop.Traffic.connections)
+}
+inline ::Lansnoop::ConnectionCountArrays* Traffic::release_connections() {
+  
+  ::Lansnoop::ConnectionCountArrays* temp = _impl_.connections_;
+  _impl_.connections_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Lansnoop::ConnectionCountArrays* Traffic::unsafe_arena_release_connections() {
+  // @@protoc_insertion_point(field_release:Lansnoop.Traffic.connections)
+  
+  ::Lansnoop::ConnectionCountArrays* temp = _impl_.connections_;
+  _impl_.connections_ = nullptr;
+  return temp;
+}
+inline ::Lansnoop::ConnectionCountArrays* Traffic::_internal_mutable_connections() {
+  
+  if (_impl_.connections_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Lansnoop::ConnectionCountArrays>(GetArenaForAllocation());
+    _impl_.connections_ = p;
+  }
+  return _impl_.connections_;
+}
+inline ::Lansnoop::ConnectionCountArrays* Traffic::mutable_connections() {
+  ::Lansnoop::ConnectionCountArrays* _msg = _internal_mutable_connections();
+  // @@protoc_insertion_point(field_mutable:Lansnoop.Traffic.connections)
+  return _msg;
+}
+inline void Traffic::set_allocated_connections(::Lansnoop::ConnectionCountArrays* connections) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.connections_;
+  }
+  if (connections) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(connections);
+    if (message_arena != submessage_arena) {
+      connections = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, connections, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.connections_ = connections;
+  // @@protoc_insertion_point(field_set_allocated:Lansnoop.Traffic.connections)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Lansnoop
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_traffic_2eproto
@@ -15,8 +15,13 @@ std::ostream& operator<<(std::ostream& o, Disposition d)
         case Disposition::IPv4_FRAGMENT:   return o << "IPv4_FRAGMENT";
         case Disposition::IPv4_BAD:        return o << "IPv4_BAD";
         case Disposition::IPv4_PROTOCOL:   return o << "IPv4_PROTOCOL";
+        case Disposition::IPv6_FRAGMENT:   return o << "IPv6_FRAGMENT";
+        case Disposition::IPv6_BAD:        return o << "IPv6_BAD";
+        case Disposition::IPv6_PROTOCOL:   return o << "IPv6_PROTOCOL";
         case Disposition::L4_PROTOCOL:     return o << "L4_PROTOCOL";
         case Disposition::UDP:             return o << "UDP";
+        case Disposition::TCP:             return o << "TCP";
+        case Disposition::TCP_BAD:         return o << "TCP_BAD";
         case Disposition::DNS:             return o << "DNS";
         case Disposition::DNS_ERROR:       return o << "DNS_ERROR";
         case Disposition::_MAX:            return o << "_MAX";
@@ -10,11 +10,16 @@ enum class Disposition {
     ARP,
     ARP_DISINTEREST,
     ARP_ERROR,
-    IPv4_FRAGMENT, // Discarded because we don't handle fragments yet.
+    IPv4_FRAGMENT, // Held for reassembly, or abandoned.
     IPv4_BAD,
     IPv4_PROTOCOL,
+    IPv6_FRAGMENT, // Discarded because we don't handle fragments yet.
+    IPv6_BAD,
+    IPv6_PROTOCOL,
     L4_PROTOCOL,
     UDP,
+    TCP,
+    TCP_BAD,
     DNS,
     DNS_ERROR,
     _MAX,
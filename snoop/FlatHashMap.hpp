@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "OpenHashTable.hpp"
+
+
+//  An open-addressing hash map from small keys to small values.
+//
+//  An OpenHashTable whose load factor is kept at or below one half.
+//
+//  Key is an unsigned integer type of up to 128 bits, into which compound
+//  keys (MAC and IP addresses) are best packed, or else a class with
+//  operator== and a uint64_t hash() const.  Inserting may move slots,
+//  invalidating pointers and references to values.
+//
+template<class Key, class Value>
+class FlatHashMap
+{
+public:
+    FlatHashMap() : table(initial_capacity) {}
+
+    //  Returns the key's value, or nullptr if not found.
+    Value* find(const Key& key);
+    const Value* find(const Key& key) const { return const_cast<FlatHashMap*>(this)->find(key); }
+
+    //  Returns the key's value, default-constructing it if not found.
+    Value& operator[](const Key& key);
+
+    bool erase(const Key& key);
+    //  Remove every entry, keeping the capacity for reuse.
+    void clear() { this->table.clear(); }
+
+    size_t size() const { return this->table.size(); }
+
+    //  Call f(Key, Value&) for each entry, in no particular order.
+    template<class F> void for_each(F&& f);
+    template<class F> void for_each(F&& f) const;
+
+private:
+    OpenHashTable<Key, Value> table;
+
+    static constexpr size_t initial_capacity = 64;
+};
+
+
+template<class Key, class Value>
+Value* FlatHashMap<Key, Value>::find(const Key& key)
+{
+    size_t ix = this->table.slot(key);
+    return this->table.used(ix) ? &this->table.value(ix) : nullptr;
+}
+
+
+template<class Key, class Value>
+Value& FlatHashMap<Key, Value>::operator[](const Key& key)
+{
+    size_t ix = this->table.slot(key);
+    if (this->table.used(ix))
+        return this->table.value(ix);
+
+    if (2 * (this->table.size() + 1) > this->table.capacity()) {
+        this->table.grow();
+        ix = this->table.slot(key);
+    }
+    return this->table.emplace_at(ix, key);
+}
+
+
+template<class Key, class Value>
+bool FlatHashMap<Key, Value>::erase(const Key& key)
+{
+    size_t ix = this->table.slot(key);
+    if (!this->table.used(ix))
+        return false;
+    this->table.erase_at(ix);
+    return true;
+}
+
+
+template<class Key, class Value>
+template<class F> void FlatHashMap<Key, Value>::for_each(F&& f)
+{
+    for (size_t ix=0; ix<this->table.capacity(); ++ix)
+        if (this->table.used(ix))
+            f(this->table.key(ix), this->table.value(ix));
+}
+
+
+template<class Key, class Value>
+template<class F> void FlatHashMap<Key, Value>::for_each(F&& f) const
+{
+    for (size_t ix=0; ix<this->table.capacity(); ++ix)
+        if (this->table.used(ix))
+            f(this->table.key(ix), this->table.value(ix));
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "OpenHashTable.hpp"
+
+
+//  An open-addressing hash table of per-flow state with idle eviction.
+//
+//  Entries live in an OpenHashTable, which grows as needed up to
+//  :max_entries:.  Once it's full, inserting a new flow sheds an old one,
+//  chosen as the least recently seen of a small sample (an approximation
+//  of LRU that needs no list).
+//
+//  Key must provide operator== and a uint64_t hash() const.
+//  Times are nanoseconds, as given to Model::note_time().
+//
+template<class Key, class Value>
+class FlowTable
+{
+public:
+    struct Stats {
+        long idle_evictions = 0;  // Entries removed for being idle.
+        long sheds = 0;           // Entries removed to make room for new ones.
+    };
+
+    FlowTable(size_t max_entries, long idle_timeout);
+
+    //  Returns the flow's value, or nullptr if not found.
+    //  Marks the flow as seen at time :now:.
+    Value* find(const Key& key, long now);
+    //  As above, but without marking the flow as seen, so that it still
+    //  expires an idle timeout after it was last marked.
+    Value* peek(const Key& key);
+
+    //  Insert a flow known not to be in the table.
+    //  Value is constructed from :args:.  Sheds a flow if the table is full.
+    template<class... Args>
+    Value& emplace(const Key& key, long now, Args&&... args);
+
+    bool full() const { return this->table.size() >= this->max_entries; }
+    //  Remove an old flow to make room for a new one, calling
+    //  :shedding:(const Key&, Value&) before it's removed.  To be told of the
+    //  flows emplace() sheds, call this first when the table is full.
+    template<class F> void shed(F&& shedding);
+
+    void erase(const Key& key);
+
+    //  Remove flows idle for longer than the idle timeout.
+    //  Call regularly.  Each call does work proportional to the time
+    //  elapsed since the last, so the whole table is swept about twice
+    //  per idle timeout period.
+    void expire(long now) { expire(now, [](const Key&, Value&) {}); }
+    //  As above, calling :expired:(const Key&, Value&) for each flow before it's removed.
+    template<class F> void expire(long now, F&& expired);
+
+    size_t size() const { return this->table.size(); }
+    const Stats& get_stats() const { return this->stats; }
+
+private:
+    //  A flow's value, and when it was last seen.
+    struct Flow {
+        long last_seen;
+        Value value;
+
+        template<class... Args>
+        Flow(long now, Args&&... args) : last_seen(now), value(std::forward<Args>(args)...) {}
+    };
+
+    OpenHashTable<Key, Flow> table;
+    size_t max_entries;
+    size_t max_capacity;
+    long idle_timeout;
+    Stats stats;
+
+    long last_sweep = 0;
+    size_t sweep_cursor = 0;
+    size_t shed_cursor = 0;
+
+    static constexpr size_t initial_capacity = 1024;
+    static constexpr int shed_sample = 16;
+};
+
+
+template<class Key, class Value>
+FlowTable<Key, Value>::FlowTable(size_t max_entries, long idle_timeout)
+    : table(initial_capacity), max_entries(max_entries), idle_timeout(idle_timeout)
+{
+    if (max_entries < 1)
+        throw std::invalid_argument("FlowTable: max_entries must be at least 1");
+    if (idle_timeout < 1)
+        throw std::invalid_argument("FlowTable: idle_timeout must be positive");
+
+    //  Keep the load factor at or below one half.
+    this->max_capacity = initial_capacity;
+    while (this->max_capacity < 2 * max_entries)
+        this->max_capacity <<= 1;
+}
+
+
+template<class Key, class Value>
+Value* FlowTable<Key, Value>::find(const Key& key, long now)
+{
+    size_t ix = this->table.slot(key);
+    if (!this->table.used(ix))
+        return nullptr;
+    Flow& flow = this->table.value(ix);
+    flow.last_seen = now;
+    return &flow.value;
+}
+
+
+template<class Key, class Value>
+Value* FlowTable<Key, Value>::peek(const Key& key)
+{
+    size_t ix = this->table.slot(key);
+    return this->table.used(ix) ? &this->table.value(ix).value : nullptr;
+}
+
+
+template<class Key, class Value>
+template<class... Args>
+Value& FlowTable<Key, Value>::emplace(const Key& key, long now, Args&&... args)
+{
+    if (this->full())
+        shed([](const Key&, Value&) {});
+    if (2 * (this->table.size() + 1) > this->table.capacity() && this->table.capacity() < this->max_capacity) {
+        this->table.grow();
+        this->sweep_cursor &= this->table.capacity() - 1;
+        this->shed_cursor &= this->table.capacity() - 1;
+    }
+    return this->table.emplace_at(this->table.slot(key), key, now, std::forward<Args>(args)...).value;
+}
+
+
+template<class Key, class Value>
+void FlowTable<Key, Value>::erase(const Key& key)
+{
+    size_t ix = this->table.slot(key);
+    if (this->table.used(ix))
+        this->table.erase_at(ix);
+}
+
+
+template<class Key, class Value>
+template<class F> void FlowTable<Key, Value>::shed(F&& shedding)
+{
+    size_t capacity = this->table.capacity();
+    size_t victim = capacity;
+    int sampled = 0;
+    for (size_t n=0; n<capacity && sampled<shed_sample; ++n) {
+        size_t ix = this->shed_cursor;
+        this->shed_cursor = this->table.next(this->shed_cursor);
+        if (!this->table.used(ix))
+            continue;
+        ++sampled;
+        if (victim == capacity || this->table.value(ix).last_seen < this->table.value(victim).last_seen)
+            victim = ix;
+    }
+    if (victim != capacity) {
+        shedding(this->table.key(victim), this->table.value(victim).value);
+        this->table.erase_at(victim);
+        this->stats.sheds++;
+    }
+}
+
+
+template<class Key, class Value>
+template<class F> void FlowTable<Key, Value>::expire(long now, F&& expired)
+{
+    if (!this->last_sweep || now < this->last_sweep) {
+        this->last_sweep = now;
+        return;
+    }
+    //  Nothing to expire.  A table that's been idle gets one full sweep when it fills again.
+    if (!this->table.size())
+        return;
+
+    //  Visit the whole table once per half idle timeout, a little at a time.
+    //  Let time accumulate until there's at least one slot to visit.
+    size_t capacity = this->table.capacity();
+    long elapsed = now - this->last_sweep;
+    size_t visit = capacity;
+    if (elapsed < this->idle_timeout / 2)
+        visit = capacity * elapsed / (this->idle_timeout / 2);
+    if (!visit)
+        return;
+    this->last_sweep = now;
+
+    for (size_t n=0; n<visit; ++n) {
+        size_t ix = this->sweep_cursor;
+        if (this->table.used(ix) && now - this->table.value(ix).last_seen > this->idle_timeout) {
+            expired(this->table.key(ix), this->table.value(ix).value);
+            //  Erasing may shift another entry into this slot.  Look at it again next time around.
+            this->table.erase_at(ix);
+            this->stats.idle_evictions++;
+        }
+        else
+            this->sweep_cursor = this->table.next(this->sweep_cursor);
+    }
+}
@@ -87,6 +87,7 @@ void IPV4PrefixTable::load(const std::string& path, bool verbose)
     }
 
     std::sort(this->prefixes.begin(), this->prefixes.end());
+    build();
 
 #if 0
     regfree(&regex);
@@ -109,14 +110,79 @@ void IPV4PrefixTable::load(const std::string& path, bool verbose)
 }
 
 
+void IPV4PrefixTable::build()
+{
+    if (this->prefixes.size() >= tbl8_flag)
+        throw std::length_error("IPV4PrefixTable: too many prefixes");
+
+    //  Paint prefixes in order of increasing length, so that longer
+    //  prefixes overwrite the shorter prefixes they overlap.
+    std::vector<uint32_t> order(this->prefixes.size());
+    for (uint32_t i=0; i<order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return this->prefixes[a].netmask < this->prefixes[b].netmask;
+    });
+
+    this->tbl24.assign(1 << 24, 0);
+    this->tbl8.clear();
+    for (uint32_t ix : order) {
+        const Prefix& prefix = this->prefixes[ix];
+        uint32_t entry = ix + 1;
+        if (prefix.netmask <= 0xffffff00U) {
+            uint32_t first = prefix.address >> 8;
+            uint32_t count = (~prefix.netmask >> 8) + 1;
+            std::fill(&this->tbl24[first], &this->tbl24[first] + count, entry);
+        }
+        else {
+            //  Longer than /24.  Split the /24 into a tbl8 group, if not
+            //  done already, starting with whatever covered the whole /24.
+            uint32_t& entry24 = this->tbl24[prefix.address >> 8];
+            if (!(entry24 & tbl8_flag)) {
+                uint32_t group = this->tbl8.size() / 256;
+                this->tbl8.resize(this->tbl8.size() + 256, entry24);
+                entry24 = tbl8_flag | group;
+            }
+            uint32_t first = ((entry24 & ~tbl8_flag) << 8) | (prefix.address & 0xff);
+            uint32_t count = ~prefix.netmask + 1;
+            std::fill(&this->tbl8[first], &this->tbl8[first] + count, entry);
+        }
+    }
+}
+
+
+bool IPV4PrefixTable::valid(const uint32_t* tbl24, const uint32_t* tbl8, size_t tbl8_count, size_t prefix_count)
+{
+    if (tbl8_count % 256)
+        return false;
+    for (uint32_t i=0; i<(1U << 24); ++i) {
+        uint32_t entry = tbl24[i];
+        if (entry & tbl8_flag ? (entry & ~tbl8_flag) >= tbl8_count / 256 : entry > prefix_count)
+            return false;
+    }
+    for (size_t i=0; i<tbl8_count; ++i)
+        if (tbl8[i] > prefix_count)
+            return false;
+    return true;
+}
+
+
 const IPV4PrefixTable::Prefix* IPV4PrefixTable::look_up(uint32_t address) const
+{
+    if (this->tbl24.empty())
+        return nullptr;
+    return look_up(this->prefixes.data(), this->tbl24.data(), this->tbl8.data(), address);
+}
+
+
+const IPV4PrefixTable::Prefix* IPV4PrefixTable::look_up_sorted(uint32_t address) const
 {
     //  The prefix file occasionally contains overlapping entries like:
     //      223.255.240.0/22        55649
     //      223.255.240.0/24        55649
     //      223.255.241.0/24        55649
     //  This code may return the first or third prefix above as a match for 223.255.241.
-    //  TODO: Deal with this somehow.
+    //  look_up() gets this right.
 
     int l = 0; //  The start of our current search range.
     int r = this->prefixes.size(); // One past the end of our current search range.
@@ -23,11 +23,48 @@ public:
 
     void load(const std::string& path, bool verbose = false);
 
-    //  Returns the prefix and ASN of a given IP address, or nullptr if not found.
+    //  Returns the longest prefix matching a given IP address, or nullptr if not found.
     //
     const Prefix* look_up(uint32_t address) const;
     const Prefix* look_up(const IPV4Address&) const;
 
+    //  The original binary search over the sorted prefixes, kept for comparison.
+    //  Not always the longest match when prefixes overlap.
+    const Prefix* look_up_sorted(uint32_t address) const;
+
+    //  Sorted by address, then netmask.
+    const std::vector<Prefix>& get_prefixes() const { return this->prefixes; }
+
+    //  The DIR-24-8 tables, for saving.  tbl24 is empty if nothing is loaded.
+    const std::vector<uint32_t>& get_tbl24() const { return this->tbl24; }
+    const std::vector<uint32_t>& get_tbl8() const { return this->tbl8; }
+
+    //  Looks up an address in tables built by build(), wherever they're kept.
+    //  :tbl24: must have 1<<24 entries.
+    static const Prefix* look_up(const Prefix* prefixes, const uint32_t* tbl24, const uint32_t* tbl8, uint32_t address) {
+        uint32_t entry = tbl24[address >> 8];
+        if (entry & tbl8_flag)
+            entry = tbl8[((entry & ~tbl8_flag) << 8) | (address & 0xff)];
+        return entry ? &prefixes[entry - 1] : nullptr;
+    }
+
+    //  Returns whether look_up() on tables kept elsewhere stays within
+    //  :prefix_count: prefixes and :tbl8_count: tbl8 entries.
+    //  :tbl24: must have 1<<24 entries.
+    static bool valid(const uint32_t* tbl24, const uint32_t* tbl8, size_t tbl8_count, size_t prefix_count);
+
 private:
     std::vector<Prefix> prefixes;
+
+    //  A DIR-24-8 longest prefix match table, built from :prefixes: by build().
+    //  tbl24 has an entry for each /24.  An entry holds either the index+1
+    //  of the longest prefix covering the whole /24 (0 if none), or, if
+    //  tbl8_flag is set, the number of a 256 entry group in tbl8 that holds
+    //  the same for each address in the /24.  So a look up takes one memory
+    //  access, or two for prefixes longer than /24.
+    std::vector<uint32_t> tbl24;
+    std::vector<uint32_t> tbl8;
+    static constexpr uint32_t tbl8_flag = 0x80000000U;
+
+    void build();
 };
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "IPV4Reassembler.hpp"
+
+
+IPV4Reassembler::IPV4Reassembler(size_t memory, size_t max_datagrams, long timeout)
+    : timeout(timeout)
+{
+    if (max_datagrams < 1)
+        throw std::invalid_argument("IPV4Reassembler: max_datagrams must be at least 1");
+    if (memory < block_size)
+        throw std::invalid_argument("IPV4Reassembler: memory must be at least one block");
+    if (timeout < 1)
+        throw std::invalid_argument("IPV4Reassembler: timeout must be positive");
+
+    this->datagrams.resize(max_datagrams);
+    for (uint32_t ix=max_datagrams; ix>0; --ix)
+        this->free_datagrams.push_back(ix - 1);
+
+    size_t block_count = memory / block_size;
+    this->pool.resize(block_count * block_size);
+    for (uint32_t b=block_count; b>0; --b)
+        this->free_blocks.push_back(b - 1);
+
+    this->reassembled.resize(max_length);
+}
+
+
+const unsigned char* IPV4Reassembler::add(const Key& key, long now,
+                                          unsigned offset, bool more,
+                                          const unsigned char* data, unsigned length,
+                                          unsigned& datagram_length)
+{
+    uint128_t packed = pack(key);
+    uint32_t* found = this->index.find(packed);
+    uint32_t ix = found ? *found : new_datagram(packed, now);
+    Datagram& datagram = this->datagrams[ix];
+
+    //  All but the last fragment carry a multiple of 8 bytes, and none
+    //  reach past the largest datagram.  The last fixes the length, so no
+    //  fragment may reach past it, and there's only one last.
+    uint32_t end = offset + length;
+    bool bad = !length || end > max_length || (more && length % 8);
+    if (more)
+        bad = bad || (datagram.length && end > datagram.length);
+    else {
+        bad = bad || datagram.length;
+        uint32_t received_end = datagram.range_count ? datagram.ranges[datagram.range_count - 1].end : 0;
+        bad = bad || received_end > end;
+    }
+    if (bad || !add_range(datagram, offset, end)) {
+        drop(ix);
+        this->stats.rejects++;
+        return nullptr;
+    }
+    if (!store(ix, offset, data, length)) {
+        drop(ix);
+        this->stats.evictions++;
+        return nullptr;
+    }
+    if (!more)
+        datagram.length = end;
+    datagram.received += length;
+
+    //  Fragments don't overlap, so once as many bytes as the datagram's
+    //  length have arrived, they've all arrived.
+    if (!datagram.length || datagram.received != datagram.length)
+        return nullptr;
+
+    for (uint32_t b=0; b*block_size<datagram.length; ++b) {
+        unsigned n = std::min(block_size, datagram.length - b * block_size);
+        memcpy(this->reassembled.data() + b * block_size, this->pool.data() + size_t(datagram.blocks[b]) * block_size, n);
+    }
+    datagram_length = datagram.length;
+    drop(ix);
+    this->stats.reassembled++;
+    return this->reassembled.data();
+}
+
+
+void IPV4Reassembler::expire(long now)
+{
+    while (this->oldest != none && now - this->datagrams[this->oldest].first_seen > this->timeout) {
+        drop(this->oldest);
+        this->stats.timeouts++;
+    }
+}
+
+
+uint32_t IPV4Reassembler::new_datagram(uint128_t key, long now)
+{
+    if (this->free_datagrams.empty()) {
+        drop(this->oldest);
+        this->stats.evictions++;
+    }
+    uint32_t ix = this->free_datagrams.back();
+    this->free_datagrams.pop_back();
+
+    Datagram& datagram = this->datagrams[ix];
+    datagram.key = key;
+    datagram.first_seen = now;
+    datagram.length = 0;
+    datagram.received = 0;
+    datagram.range_count = 0;
+    datagram.blocks.fill(none);
+
+    datagram.older = this->newest;
+    datagram.newer = none;
+    if (this->newest != none)
+        this->datagrams[this->newest].newer = ix;
+    else
+        this->oldest = ix;
+    this->newest = ix;
+
+    this->index[key] = ix;
+    return ix;
+}
+
+
+void IPV4Reassembler::drop(uint32_t ix)
+{
+    Datagram& datagram = this->datagrams[ix];
+    for (uint32_t& block : datagram.blocks)
+        if (block != none) {
+            this->free_blocks.push_back(block);
+            block = none;
+        }
+
+    if (datagram.older != none)
+        this->datagrams[datagram.older].newer = datagram.newer;
+    else
+        this->oldest = datagram.newer;
+    if (datagram.newer != none)
+        this->datagrams[datagram.newer].older = datagram.older;
+    else
+        this->newest = datagram.older;
+
+    this->index.erase(datagram.key);
+    this->free_datagrams.push_back(ix);
+}
+
+
+bool IPV4Reassembler::add_range(Datagram& datagram, uint32_t begin, uint32_t end)
+{
+    Range* ranges = datagram.ranges.data();
+    uint32_t count = datagram.range_count;
+
+    //  The first range ending after :begin: must start at or after :end:.
+    uint32_t i = 0;
+    while (i < count && ranges[i].end <= begin)
+        ++i;
+    if (i < count && ranges[i].begin < end)
+        return false;
+
+    //  Join the neighbouring ranges where they touch.
+    bool joins_before = i > 0 && ranges[i - 1].end == begin;
+    bool joins_after = i < count && ranges[i].begin == end;
+    if (joins_before && joins_after) {
+        ranges[i - 1].end = ranges[i].end;
+        std::copy(ranges + i + 1, ranges + count, ranges + i);
+        --datagram.range_count;
+    }
+    else if (joins_before)
+        ranges[i - 1].end = end;
+    else if (joins_after)
+        ranges[i].begin = begin;
+    else {
+        if (count == max_ranges)
+            return false;
+        std::copy_backward(ranges + i, ranges + count, ranges + count + 1);
+        ranges[i] = Range { begin, end };
+        ++datagram.range_count;
+    }
+    return true;
+}
+
+
+bool IPV4Reassembler::store(uint32_t ix, unsigned offset, const unsigned char* data, unsigned length)
+{
+    Datagram& datagram = this->datagrams[ix];
+    while (length) {
+        uint32_t b = offset / block_size;
+        unsigned within = offset % block_size;
+        unsigned n = std::min(length, block_size - within);
+        if (datagram.blocks[b] == none) {
+            //  Make room by abandoning the oldest of the other datagrams.
+            while (this->free_blocks.empty()) {
+                uint32_t victim = this->oldest != ix ? this->oldest : datagram.newer;
+                if (victim == none)
+                    return false;
+                drop(victim);
+                this->stats.evictions++;
+            }
+            datagram.blocks[b] = this->free_blocks.back();
+            this->free_blocks.pop_back();
+        }
+        memcpy(this->pool.data() + size_t(datagram.blocks[b]) * block_size + within, data, n);
+        offset += n;
+        data += n;
+        length -= n;
+    }
+    return true;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FlatHashMap.hpp"
+#include "util.hpp"
+
+
+//  Reassembles fragmented IPv4 datagrams in a fixed amount of memory.
+//
+//  Fragment data is copied into blocks from a pool allocated up front,
+//  each datagram holding the blocks covering the offsets it's received.
+//  Datagrams are kept in order of their first fragment's arrival, so the
+//  oldest is at hand both to time out and to evict when the pool or the
+//  datagram slots run out.
+//
+//  Overlapping fragments, including duplicates, abandon the datagram.
+//  Overlaps are how fragments are used to sneak data past inspection,
+//  and nothing legitimate sends them.
+//
+//  Times are nanoseconds, as given to Model::note_time().
+//
+class IPV4Reassembler
+{
+public:
+    struct Stats {
+        long reassembled = 0;  // Datagrams completed.
+        long timeouts = 0;     // Datagrams abandoned for their fragments taking too long to arrive.
+        long evictions = 0;    // Datagrams abandoned to make room for others.
+        long rejects = 0;      // Datagrams abandoned for overlapping or malformed fragments.
+    };
+
+    //  Identifies the datagram a fragment belongs to.
+    struct Key {
+        uint32_t source;       // Network byte order.
+        uint32_t destination;  // Network byte order.
+        uint16_t id;
+        uint8_t protocol;
+    };
+
+    //  :memory: bytes of fragment data from at most :max_datagrams:
+    //  datagrams are held at once.  A datagram is abandoned :timeout:
+    //  after its first fragment arrives.
+    IPV4Reassembler(size_t memory, size_t max_datagrams, long timeout);
+
+    //  Add a fragment, :length: bytes of payload at byte :offset: in its
+    //  datagram.  :more: is the fragment's more fragments flag.  Returns
+    //  the reassembled payload once all its fragments have arrived, setting
+    //  :datagram_length:, else nullptr.  The payload is valid until the
+    //  next call.
+    const unsigned char* add(const Key& key, long now,
+                             unsigned offset, bool more,
+                             const unsigned char* data, unsigned length,
+                             unsigned& datagram_length);
+
+    //  Abandon datagrams older than the timeout.  Call regularly.
+    void expire(long now);
+
+    //  Number of datagrams awaiting fragments.
+    size_t size() const { return this->index.size(); }
+    const Stats& get_stats() const { return this->stats; }
+
+    static constexpr unsigned block_size = 1024;
+
+private:
+    static constexpr uint32_t none = UINT32_MAX;
+    static constexpr unsigned max_length = 65535;  // Largest IPv4 payload offset + length.
+    static constexpr unsigned max_blocks = (max_length + block_size) / block_size;
+    static constexpr unsigned max_ranges = 16;
+
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    struct Datagram {
+        uint128_t key;
+        long first_seen;
+        uint32_t older;     // Neighbours in arrival order, or none.
+        uint32_t newer;
+        uint32_t length;    // Payload length, once the last fragment is in.  0 until then.
+        uint32_t received;  // Payload bytes received.
+        //  Byte ranges received, sorted and coalesced.
+        uint32_t range_count;
+        std::array<Range, max_ranges> ranges;
+        //  Pool block holding each block_size bytes of the payload, or none.
+        std::array<uint32_t, max_blocks> blocks;
+    };
+
+    std::vector<Datagram> datagrams;
+    std::vector<uint32_t> free_datagrams;
+    FlatHashMap<uint128_t, uint32_t> index;
+    uint32_t oldest = none;
+    uint32_t newest = none;
+
+    std::vector<unsigned char> pool;
+    std::vector<uint32_t> free_blocks;
+
+    std::vector<unsigned char> reassembled;
+
+    long timeout;
+    Stats stats;
+
+    static uint128_t pack(const Key& key) {
+        return uint128_t(key.source) | uint128_t(key.destination) << 32
+             | uint128_t(key.id) << 64 | uint128_t(key.protocol) << 80;
+    }
+
+    //  Returns the index of a new datagram, evicting the oldest if need be.
+    uint32_t new_datagram(uint128_t key, long now);
+    //  Free a datagram's blocks and slot.
+    void drop(uint32_t ix);
+    //  Record a range of bytes received.  Returns false if it overlaps
+    //  those already received, or there are too many gaps between them.
+    static bool add_range(Datagram&, uint32_t begin, uint32_t end);
+    //  Copy fragment data into :ix:'s blocks.  Returns false if the pool
+    //  ran out even after evicting every other datagram.
+    bool store(uint32_t ix, unsigned offset, const unsigned char* data, unsigned length);
+};
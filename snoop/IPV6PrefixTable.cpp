@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <ctype.h>
+
+#include "IPV6PrefixTable.hpp"
+
+
+void IPV6PrefixTable::load(const std::string& path, bool verbose)
+{
+    std::ifstream in(path);
+    if (!in)
+        throw std::invalid_argument("unable to open IPv6 prefix file");
+
+    int count = 0;
+    char line[1024];
+    while (in.getline(line, sizeof(line), '\n')) {
+        ++count;
+        char* slash = strchr(line, '/');
+        if (!slash)
+            throw std::invalid_argument("parse error");
+        *slash = '\0';
+        IPV6Address address_bytes;
+        if (inet_pton(AF_INET6, line, address_bytes.data()) != 1)
+            throw std::invalid_argument("failed parsing IPv6 address");
+        uint128_t address = to_host(address_bytes);
+
+        char* ptr = slash + 1;
+        if (!isdigit(*ptr))
+            throw std::invalid_argument("parse error");
+        uint32_t length = 0;
+        while (isdigit(*ptr))
+            length = length * 10 + *ptr++ - '0';
+        if (length > 128 || *ptr++ != '\t')
+            throw std::invalid_argument("parse error");
+        uint128_t host_mask = length == 128 ? 0 : ~uint128_t(0) >> length;
+        if (address & host_mask)
+            throw std::invalid_argument("parse error");
+
+        if (!isdigit(*ptr))
+            throw std::invalid_argument("parse error");
+        uint32_t asn = std::stoul(ptr);
+        if (asn == 0U || asn == 65535U) // Reserved ASNs.
+            throw std::invalid_argument("parse error");
+
+        this->prefixes.push_back(Prefix { address, length, asn });
+    }
+
+    std::sort(this->prefixes.begin(), this->prefixes.end());
+    build();
+
+    if (verbose)
+        std::cerr << count << " IPv6 prefixes loaded from " << path << std::endl;
+}
+
+
+void IPV6PrefixTable::build()
+{
+    //  Sorted by address then length, prefixes nest: any prefix inside
+    //  another follows it.  Walk them with a stack of the prefixes
+    //  containing the current one, starting a range wherever one begins
+    //  or ends.
+    this->starts.assign(1, 0);
+    this->entries.assign(1, 0);
+    auto start = [this](uint128_t address, uint32_t entry) {
+        if (this->starts.back() == address)
+            this->entries.back() = entry;
+        else if (this->entries.back() != entry) {
+            this->starts.push_back(address);
+            this->entries.push_back(entry);
+        }
+    };
+    struct Open {
+        uint128_t last;  //  The prefix's last address.
+        uint32_t entry;
+    };
+    std::vector<Open> open;
+    auto close = [&]() {
+        uint128_t last = open.back().last;
+        open.pop_back();
+        if (last != ~uint128_t(0))
+            start(last + 1, open.empty() ? 0 : open.back().entry);
+    };
+
+    for (uint32_t ix=0; ix<this->prefixes.size(); ++ix) {
+        const Prefix& prefix = this->prefixes[ix];
+        while (!open.empty() && open.back().last < prefix.address)
+            close();
+        uint128_t host_mask = prefix.length == 128 ? 0 : ~uint128_t(0) >> prefix.length;
+        start(prefix.address, ix + 1);
+        open.push_back(Open { prefix.address | host_mask, ix + 1 });
+    }
+    while (!open.empty())
+        close();
+
+    this->tbl16.resize((1 << 16) + 1);
+    uint32_t range = 0;
+    for (uint32_t t=0; t<(1 << 16); ++t) {
+        uint128_t first = uint128_t(t) << 112;
+        while (range + 1 < this->starts.size() && this->starts[range + 1] <= first)
+            ++range;
+        this->tbl16[t] = range;
+    }
+    this->tbl16[1 << 16] = this->starts.size() - 1;
+}
+
+
+const IPV6PrefixTable::Prefix* IPV6PrefixTable::look_up(const Prefix* prefixes, const uint32_t* tbl16,
+                                                        const uint128_t* starts, const uint32_t* entries,
+                                                        uint128_t address)
+{
+    uint32_t t = address >> 112;
+    const uint128_t* first = starts + tbl16[t];
+    const uint128_t* last = starts + tbl16[t + 1] + 1;
+    uint32_t range = std::upper_bound(first, last, address) - starts - 1;
+    uint32_t entry = entries[range];
+    return entry ? &prefixes[entry - 1] : nullptr;
+}
+
+
+bool IPV6PrefixTable::valid(const uint32_t* tbl16, const uint128_t* starts, const uint32_t* entries,
+                            size_t range_count, size_t prefix_count)
+{
+    //  The binary search needs the ranges in order, and each tbl16 range
+    //  to start at or before the addresses it's the first range for.
+    if (range_count == 0 || starts[0] != 0)
+        return false;
+    for (size_t i=0; i<range_count; ++i)
+        if ((i && starts[i] <= starts[i - 1]) || entries[i] > prefix_count)
+            return false;
+    for (uint32_t t=0; t<=(1U << 16); ++t)
+        if (tbl16[t] >= range_count || (t && tbl16[t] < tbl16[t - 1])
+            || (t < (1U << 16) && starts[tbl16[t]] > uint128_t(t) << 112))
+            return false;
+    return true;
+}
+
+
+const IPV6PrefixTable::Prefix* IPV6PrefixTable::look_up(uint128_t address) const
+{
+    if (this->tbl16.empty())
+        return nullptr;
+    return look_up(this->prefixes.data(), this->tbl16.data(), this->starts.data(), this->entries.data(), address);
+}
+
+
+const IPV6PrefixTable::Prefix* IPV6PrefixTable::look_up(const IPV6Address& address) const
+{
+    return look_up(to_host(address));
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "util.hpp"
+
+
+class IPV6PrefixTable {
+public:
+    struct Prefix {
+        uint128_t address; // Host byte order.
+        uint32_t length;   // In bits.
+        uint32_t asn;
+
+        bool operator <(const Prefix& rhs) const {
+            if (address == rhs.address)
+                return length < rhs.length;
+            return address < rhs.address;
+        }
+    };
+
+    //  Load prefixes from a file of lines like "2001:200::/32	2500".
+    void load(const std::string& path, bool verbose = false);
+
+    //  Returns the longest prefix matching a given IP address, or nullptr if not found.
+    //
+    const Prefix* look_up(uint128_t address) const;
+    const Prefix* look_up(const IPV6Address&) const;
+
+    //  Sorted by address, then length.
+    const std::vector<Prefix>& get_prefixes() const { return this->prefixes; }
+
+    //  The range tables, for saving.  tbl16 is empty if nothing is loaded.
+    const std::vector<uint32_t>& get_tbl16() const { return this->tbl16; }
+    const std::vector<uint128_t>& get_starts() const { return this->starts; }
+    const std::vector<uint32_t>& get_entries() const { return this->entries; }
+
+    //  Looks up an address in tables built by build(), wherever they're kept.
+    //  :tbl16: must have (1<<16)+1 entries.
+    static const Prefix* look_up(const Prefix* prefixes, const uint32_t* tbl16,
+                                 const uint128_t* starts, const uint32_t* entries,
+                                 uint128_t address);
+
+    //  Returns whether look_up() on tables kept elsewhere stays within
+    //  :prefix_count: prefixes and :range_count: starts and entries.
+    //  :tbl16: must have (1<<16)+1 entries.
+    static bool valid(const uint32_t* tbl16, const uint128_t* starts, const uint32_t* entries,
+                      size_t range_count, size_t prefix_count);
+
+    //  Host byte order, for look_up().
+    static uint128_t to_host(const IPV6Address& address) {
+        uint128_t a = 0;
+        for (unsigned char c : address)
+            a = (a << 8) | c;
+        return a;
+    }
+
+private:
+    std::vector<Prefix> prefixes;
+
+    //  IPv6 prefixes are too long for a DIR-24-8 table, and there are far
+    //  fewer of them.  Instead build() flattens the nested prefixes into
+    //  disjoint ranges of addresses: range i starts at starts[i] and ends
+    //  where the next begins, and entries[i] is the index+1 of the longest
+    //  prefix covering it (0 if none).  A look up is a binary search for
+    //  the last range starting at or before the address.  tbl16[t] is the
+    //  range holding the first address with top 16 bits t, so the search
+    //  need only cover ranges tbl16[t] to tbl16[t+1].
+    std::vector<uint32_t> tbl16;
+    std::vector<uint128_t> starts;
+    std::vector<uint32_t> entries;
+
+    void build();
+};
@@ -1,35 +1,68 @@
+#include <algorithm>
+#include <cmath>
 #include <ostream>
-#include <fstream>
 #include <iomanip>
 #include <stdexcept>
 #include "Model.hpp"
 #include "event.pb.h"
-#include "EventSerialization.hpp"
 
 #include "/home/abarton/debug.hpp"
 
 
 void Model::note_time(long t)
 {
-    this->now = t;
+    //  Shards may deliver packets slightly out of order.  Don't let time run backwards.
+    if (t > this->now)
+        this->now = t;
+
+    if (this->reference_changed.load(std::memory_order_acquire))
+        adopt_reference();
+    if (this->refreshing)
+        refresh_reference();
+
     const long millisecond = 1000000L;
+    //  Rates are updated less often than they're reported, as each update
+    //  touches every entity that's had traffic in the last several seconds.
+    if (!this->last_rate_update)
+        this->last_rate_update = this->now;
+    else if (this->now >= this->last_rate_update + rate_interval) {
+        update_rates();
+        this->last_rate_update = this->now;
+    }
     if (this->now >= this->last_traffic_update + 10*millisecond) {
-        if (this->recent_interface_traffic.size()) {
+        if (this->dirty_interfaces.size() || this->dirty_clouds.size() || this->dirty_ip_addresses.size()
+            || this->dirty_vlans.size() || this->dirty_connections.size())
             emit_traffic_update();
-            this->recent_interface_traffic.clear();
-            this->recent_cloud_traffic.clear();
-            this->recent_ipaddress_traffic.clear();
-        }
         this->last_traffic_update = this->now + 10*millisecond;
     }
+    //  Latency histograms only mean much over many responses.
+    if (this->now >= this->last_resolver_update + 1000*millisecond) {
+        emit_resolver_updates();
+        this->last_resolver_update = this->now;
+    }
+    this->events.poll();
+}
+
+
+void Model::flush()
+{
+    emit_resolver_updates();
+    this->events.flush();
+}
+
+
+void Model::note_packet()
+{
+    ++this->packet_count;
 }
 
 
 void Model::note_l2_packet_traffic(const MacAddress& source_address,
-                                   const MacAddress& destination_address)
+                                   const MacAddress& destination_address,
+                                   unsigned long bytes, uint16_t vlan, unsigned packets)
 {
-    auto source_i = this->interfaces_by_address.find(source_address);
-    auto destination_i = this->interfaces_by_address.find(destination_address);
+    uint32_t source_ix = this->find_interface(source_address, vlan);
+    uint32_t destination_ix = this->find_interface(destination_address, vlan);
     bool is_multicast = destination_address[0] & 0x01;
 
     //  TODO: Filter out 00:00:00:00:00:00 and ff:ff:ff:ff:ff:ff.
@@ -41,137 +74,177 @@ void Model::note_l2_packet_traffic(const MacAddress& source_address,
     if (is_multicast) {
         //  In a multicast broadcast, only the source interface is "real".
         //
-        if (source_i == this->interfaces_by_address.end()) {
-            long network_id;
-            if (this->assume_one_lan) {
-                //  Assume all interfaces are on the same network.
-                if (this->networks.size())
-                    network_id = this->networks.begin()->first;
-                else
-                    network_id = this->new_network();
-            }
-            else
-                network_id = this->new_network();
-            source_i = this->new_interface(source_address, network_id);
-        }
+        if (source_ix == no_index)
+            source_ix = this->new_interface(source_address, vlan, this->network_for_new_interface(vlan));
     }
     else {
-        //  Both interfaces are known to us.
+        //  Both interfaces are known to us.  Both are in :vlan:, so their
+        //  networks are too.
         //
-        if (source_i != this->interfaces_by_address.end() && destination_i != this->interfaces_by_address.end()) {
-            if (source_i->second.network_id != destination_i->second.network_id)
-                this->merge_networks(source_i->second.network_id, destination_i->second.network_id);
+        if (source_ix != no_index && destination_ix != no_index) {
+            long source_network_id = this->network_of(this->interfaces[source_ix]);
+            long destination_network_id = this->network_of(this->interfaces[destination_ix]);
+            if (source_network_id != destination_network_id)
+                this->merge_networks(source_network_id, destination_network_id);
         }
         //  Both interfaces are new to us.
-        else if (source_i == this->interfaces_by_address.end() && destination_i == this->interfaces_by_address.end()) {
-            long network_id;
-            if (this->assume_one_lan) {
-                //  Assume all interfaces are on the same network.
-                if (this->networks.size())
-                    network_id = this->networks.begin()->first;
-                else
-                    network_id = this->new_network();
-            }
-            else
-                network_id = this->new_network();
-            source_i = this->new_interface(source_address, network_id);
-            destination_i = this->new_interface(destination_address, network_id);
+        else if (source_ix == no_index && destination_ix == no_index) {
+            long network_id = this->network_for_new_interface(vlan);
+            source_ix = this->new_interface(source_address, vlan, network_id);
+            destination_ix = this->new_interface(destination_address, vlan, network_id);
         }
         //  Only the source interface is new.
-        else if (source_i == this->interfaces_by_address.end()) {
-            source_i = this->new_interface(source_address, destination_i->second.network_id);
+        else if (source_ix == no_index) {
+            source_ix = this->new_interface(source_address, vlan, this->network_of(this->interfaces[destination_ix]));
         }
         //  Only the destination interface is new.
         else {
-            destination_i = this->new_interface(destination_address, source_i->second.network_id);
+            destination_ix = this->new_interface(destination_address, vlan, this->network_of(this->interfaces[source_ix]));
         }
     }
 
     //  Update packet counters.
     //
-    if (source_i != this->interfaces_by_address.end()) {
-        this->recent_interface_traffic.insert(source_i->second.address);
-        source_i->second.packet_count++;
-    }
-    if (destination_i != this->interfaces_by_address.end()) {
-        this->recent_interface_traffic.insert(destination_i->second.address);
-        destination_i->second.packet_count++;
-    }
+    if (source_ix != no_index)
+        count_packets(this->interfaces[source_ix], source_ix, packets, bytes, this->dirty_interfaces, this->rated_interfaces);
+    if (destination_ix != no_index)
+        count_packets(this->interfaces[destination_ix], destination_ix, packets, bytes, this->dirty_interfaces, this->rated_interfaces);
+    if (vlan)
+        count_packets(this->vlans[vlan], vlan, packets, bytes, this->dirty_vlans, this->rated_vlans);
 }
 
 
-void Model::note_ip_through_interface(const IPV4Address& ip, const MacAddress& mac)
+void Model::note_ip_through_interface(const IPV4Address& ip, const MacAddress& mac, unsigned long bytes, uint16_t vlan,
+                                      unsigned packets)
 {
     if (mac[0] & 0x01)
         return;  // Multicast address.
 
-    IPAddressInfo* ipaddressinfo;
-    auto ip_it = ip_addresses.find(ip);
-    if (ip_it != this->ip_addresses.end()) {
-        //  We already know about this IP address.
-        //  TODO: check that this IP address is still in the right place?
-        ipaddressinfo = &ip_it->second;
-    }
-    else {
-        //  Create a new IPAddr instance and assign it to the interface's attached Cloud.
-        auto interface_it = this->interfaces_by_address.find(mac);
-        if (interface_it == this->interfaces_by_address.end())
-            throw std::invalid_argument("note_ip_through_interface(): mac address not found");
-        const Interface& interface = interface_it->second;
+    const uint32_t* ip_ix = this->find_ip_address(ip, vlan);
+    //  TODO: check that a known IP address is still in the right place?
+    count_ip_packets(ip_ix ? this->ip_addresses[*ip_ix] : new_ip_address(ip, mac, vlan), packets, bytes);
+}
 
-        if (!this->cloud_ids_by_interface_addresses.count(mac))
-            this->new_cloud(interface);
-        long cloud_id = this->cloud_ids_by_interface_addresses.at(mac);
-        Cloud& cloud = this->clouds.at(cloud_id);
 
-        ipaddressinfo = &this->new_ip_address(ip, cloud);
-    }
+void Model::note_ip_through_interface(const IPV6Address& ip, const MacAddress& mac, unsigned long bytes, uint16_t vlan,
+                                      unsigned packets)
+{
+    if (mac[0] & 0x01)
+        return;  // Multicast address.
+
+    const uint32_t* ip_ix = this->find_ip_address(ip, vlan);
+    count_ip_packets(ip_ix ? this->ip_addresses[*ip_ix] : new_ip_address(ip, mac, vlan), packets, bytes);
+}
 
-    //  Increment packet counts.
-    //
-    ++ipaddressinfo->packet_count;
-    this->recent_ipaddress_traffic.insert(ipaddressinfo->address);
 
-    long cloud_id = ipaddressinfo->cloud_id;
+void Model::count_ip_packets(IPAddressInfo& ipaddressinfo, unsigned packets, unsigned long bytes)
+{
+    count_packets(ipaddressinfo, this->index_by_id[ipaddressinfo.id], packets, bytes, this->dirty_ip_addresses, this->rated_ip_addresses);
+
+    long cloud_id = ipaddressinfo.cloud_id;
     while (cloud_id) {
-        Cloud& cloud = this->clouds.at(cloud_id);
-        ++cloud.packet_count;
-        this->recent_cloud_traffic.insert(cloud.id);
+        uint32_t ix = this->index_by_id[cloud_id];
+        Cloud& cloud = this->clouds[ix];
+        count_packets(cloud, ix, packets, bytes, this->dirty_clouds, this->rated_clouds);
         cloud_id = cloud.cloud_id;
     }
 }
 
 
+void Model::update_rates()
+{
+    double seconds = (this->now - this->last_rate_update) / 1e9;
+    double decay = std::exp(-(this->now - this->last_rate_update) / rate_time_constant);
+    update_rates(this->interfaces, this->rated_interfaces, this->dirty_interfaces, seconds, decay);
+    update_rates(this->clouds, this->rated_clouds, this->dirty_clouds, seconds, decay);
+    update_rates(this->ip_addresses, this->rated_ip_addresses, this->dirty_ip_addresses, seconds, decay);
+    update_rates(this->vlans, this->rated_vlans, this->dirty_vlans, seconds, decay);
+}
+
+
+template<class Entity>
+void Model::update_rates(std::vector<Entity>& entities, std::vector<uint32_t>& rated,
+                         std::vector<uint32_t>& dirty, double seconds, double decay)
+{
+    size_t kept = 0;
+    for (uint32_t ix : rated) {
+        Entity& entity = entities[ix];
+        Rate& rate = entity.rate;
+        //  The rates over the interval, folded into the averages.
+        double packets = (entity.packet_count - rate.packet_count) / seconds;
+        double bits = 8.0 * (entity.byte_count - rate.byte_count) / seconds;
+        rate.packet_count = entity.packet_count;
+        rate.byte_count = entity.byte_count;
+        rate.packets_per_second = decay * rate.packets_per_second + (1 - decay) * packets;
+        rate.bits_per_second = decay * rate.bits_per_second + (1 - decay) * bits;
+
+        if (!packets && rate.packets_per_second < min_packet_rate) {
+            rate.packets_per_second = 0;
+            rate.bits_per_second = 0;
+            rate.active = false;
+        }
+        else
+            rated[kept++] = ix;
+
+        auto moved = [](float value, float reported) {
+            return std::abs(value - reported) > rate_report_change * reported;
+        };
+        if (moved(rate.packets_per_second, rate.reported_packets_per_second)
+            || moved(rate.bits_per_second, rate.reported_bits_per_second)) {
+            rate.changed = true;
+            mark_dirty(entity, ix, dirty);
+        }
+    }
+    rated.resize(kept);
+}
+
+
 //  Assign an IP address to an interface.
 //
-void Model::note_arp(const MacAddress& mac_address, const IPV4Address& ip_address)
+void Model::note_arp(const MacAddress& mac_address, const IPV4Address& ip_address, uint16_t vlan)
 {
-    auto interface_i = this->interfaces_by_address.find(mac_address);
-    if (interface_i == this->interfaces_by_address.end())
+    uint32_t interface_ix = this->find_interface(mac_address, vlan);
+    if (interface_ix == no_index)
         return;  // We *should* find this.
-    const Interface& interface = interface_i->second;
+    const Interface& interface = this->interfaces[interface_ix];
 
-    auto ip_address_i = this->ip_addresses.find(ip_address);
-    if (ip_address_i == this->ip_addresses.end()) {
+    const uint32_t* ip_address_ix = this->find_ip_address(ip_address, vlan);
+    if (!ip_address_ix) {
         //  Create a new IPAddressInfo instance.
-        this->new_ip_address(ip_address, interface.id);
+        this->new_ip_address(ip_address, interface);
     }
     else {
         //  Update an existing IPAdressInfo to assign it to a (new) interface.
-        ip_address_i->second.interface_id = interface.id;
-        ip_address_i->second.cloud_id = 0;
-        emit(ip_address_i->second);
+        IPAddressInfo& addrinfo = this->ip_addresses[*ip_address_ix];
+        addrinfo.interface_id = interface.id;
+        addrinfo.cloud_id = 0;
+        emit(addrinfo);
     }
 }
 
 
-void Model::note_name(const IPV4Address& address, const std::string& name, NameType type)
+void Model::note_name(const IPV4Address& address, std::string_view name, NameType type, uint16_t vlan)
 {
-    this->ipv4_address_names[address].insert(NameEntry { name, type });
+    add_name(this->ipv4_address_names[pack(address)], this->find_ip_address(address, vlan), name, type);
+}
+
+
+void Model::note_name(const IPV6Address& address, std::string_view name, NameType type, uint16_t vlan)
+{
+    add_name(this->ipv6_address_names[pack(address)], this->find_ip_address(address, vlan), name, type);
+}
+
 
-    auto it = this->ip_addresses.find(address);
-    if (it != this->ip_addresses.end()) {
-        IPAddressInfo& addrinfo = it->second;
+void Model::add_name(NameSet& names, const uint32_t* ix, std::string_view name, NameType type)
+{
+    //  Names are mostly seen again and again.  Only copy new ones.
+    NameEntryLess::Key key(name, type);
+    auto it = names.lower_bound(key);
+    if (it == names.end() || NameEntryLess()(key, *it))
+        names.emplace_hint(it, NameEntry { std::string(name), type });
+
+    if (ix) {
+        IPAddressInfo& addrinfo = this->ip_addresses[*ix];
         if (addrinfo.ns_name != name) {
             addrinfo.ns_name = name;
             emit(addrinfo);
@@ -180,22 +253,148 @@ void Model::note_name(const IPV4Address& address, const std::string& name, NameT
 }
 
 
+Model::Resolver* Model::find_resolver(const IPAddress& address, uint16_t vlan)
+{
+    //  The resolver's packets have already been noted, so its address
+    //  is normally known.
+    const uint32_t* ip_ix = this->find_ip_address(address, vlan);
+    if (!ip_ix)
+        return nullptr;
+    uint32_t* ix = this->resolvers_by_ip_address.find(*ip_ix);
+    if (ix)
+        return &this->resolvers[*ix];
+
+    uint32_t index = this->resolvers.size();
+    this->resolvers.push_back(Resolver { this->new_id(index), this->ip_addresses[*ip_ix].id });
+    this->resolvers_by_ip_address[*ip_ix] = index;
+    return &this->resolvers.back();
+}
+
+
+void Model::note_dns_response(const IPAddress& address, long latency, uint16_t vlan)
+{
+    Resolver* resolver = find_resolver(address, vlan);
+    if (!resolver)
+        return;
+
+    unsigned long ms = latency / 1000000L;
+    int bucket = 0;
+    while (ms && bucket < Resolver::latency_buckets - 1) {
+        ms >>= 1;
+        ++bucket;
+    }
+    ++resolver->latency_counts[bucket];
+    resolver->latency_sum_usec += latency / 1000;
+    if (!resolver->dirty) {
+        resolver->dirty = true;
+        this->dirty_resolvers.push_back(resolver - this->resolvers.data());
+    }
+}
+
+
+void Model::note_dns_timeout(const IPAddress& address, uint16_t vlan)
+{
+    Resolver* resolver = find_resolver(address, vlan);
+    if (!resolver)
+        return;
+
+    ++resolver->timeouts;
+    if (!resolver->dirty) {
+        resolver->dirty = true;
+        this->dirty_resolvers.push_back(resolver - this->resolvers.data());
+    }
+}
+
+
+uint32_t Model::open_connection(ConnectionProtocol protocol,
+                                const IPAddress& a, uint16_t a_port,
+                                const IPAddress& b, uint16_t b_port, uint16_t vlan)
+{
+    uint32_t ix;
+    if (this->free_connections.size()) {
+        ix = this->free_connections.back();
+        this->free_connections.pop_back();
+    }
+    else {
+        ix = this->connections.size();
+        this->connections.emplace_back();
+    }
+    const uint32_t* a_ix = find_ip_address(a, vlan);
+    const uint32_t* b_ix = find_ip_address(b, vlan);
+    Connection& connection = this->connections[ix];
+    connection.id = this->next_connection_id++;
+    connection.ip_address_a_id = a_ix ? this->ip_addresses[*a_ix].id : 0;
+    connection.ip_address_b_id = b_ix ? this->ip_addresses[*b_ix].id : 0;
+    connection.packet_counts = {};
+    connection.byte_counts = {};
+    connection.a_port = a_port;
+    connection.b_port = b_port;
+    connection.protocol = protocol;
+    connection.end = ConnectionEnd::NOT_ENDED;
+    connection.established = false;
+    connection.dirty = false;
+    emit(connection);
+    return ix;
+}
+
+
+void Model::note_connection_packet(uint32_t ix, int from_b, unsigned long bytes, unsigned packets)
+{
+    Connection& connection = this->connections[ix];
+    connection.packet_counts[from_b] += packets;
+    connection.byte_counts[from_b] += bytes;
+    if (!connection.dirty) {
+        connection.dirty = true;
+        this->dirty_connections.push_back(ix);
+    }
+}
+
+
+void Model::close_connection(uint32_t ix, ConnectionEnd end, bool established)
+{
+    Connection& connection = this->connections[ix];
+    connection.end = end;
+    connection.established = established;
+    //  The fini event carries the final counts.
+    connection.dirty = false;
+    emit(connection, true);
+    connection.id = 0;
+    this->free_connections.push_back(ix);
+}
+
+
 void Model::report(std::ostream& o) const
 {
-    for (const auto& entry : this->networks) {
-        const Network& network = entry.second;
-        o << "Network " << network.id << "\n";
-        for (long interface_id : network.interfaces) {
-            const MacAddress& address = this->interfaces_by_id.find(interface_id)->second;
-            const Interface& interface = this->interfaces_by_address.find(address)->second;
-            o << "    Interface " << interface.id << "\n";
-            o << "        address:    " << interface.address << "\n";
-            o << "        network ID: " << interface.network_id << "\n";
-            o << "        maker:      " << interface.maker << "\n";
+    //  Group interfaces by network.
+    std::map<long, std::vector<const Interface*>> network_interfaces;
+    for (const Network& network : this->networks)
+        if (network.parent_id == network.id)
+            network_interfaces[network.id];
+    for (const Interface& interface : this->interfaces) {
+        long network_id = interface.network_id;
+        while (this->networks[this->index_by_id[network_id]].parent_id != network_id)
+            network_id = this->networks[this->index_by_id[network_id]].parent_id;
+        network_interfaces[network_id].push_back(&interface);
+    }
+    for (const auto& [network_id, interfaces] : network_interfaces) {
+        o << "Network " << network_id;
+        if (this->networks[this->index_by_id[network_id]].vlan)
+            o << " VLAN " << this->networks[this->index_by_id[network_id]].vlan;
+        o << "\n";
+        for (const Interface* interface : interfaces) {
+            o << "    Interface " << interface->id << "\n";
+            o << "        address:    " << interface->address << "\n";
+            o << "        network ID: " << network_id << "\n";
+            o << "        maker:      " << interface->maker << "\n";
         }
     }
-    for (const auto& entry : this->ip_addresses) {
-        const IPAddressInfo& ip_address = entry.second;
+    std::vector<const IPAddressInfo*> sorted_ip_addresses;
+    for (const IPAddressInfo& ip_address : this->ip_addresses)
+        sorted_ip_addresses.push_back(&ip_address);
+    std::sort(sorted_ip_addresses.begin(), sorted_ip_addresses.end(),
+              [](const IPAddressInfo* a, const IPAddressInfo* b) { return a->address < b->address; });
+    for (const IPAddressInfo* entry : sorted_ip_addresses) {
+        const IPAddressInfo& ip_address = *entry;
         o << "IPAddressInfo " << ip_address.id << "\n";
         o << "    address:      " << ip_address.address << "\n";
         if (ip_address.interface_id)
@@ -213,8 +412,8 @@ void Model::report(std::ostream& o) const
             o << "    asn:          " << "\n";
         o << "    as_name:      " << ip_address.as_name << "\n";
     }
-    for (const auto& [id, cloud] : this->clouds) {
-        o << "Cloud: " << id << "\n";
+    for (const Cloud& cloud : this->clouds) {
+        o << "Cloud: " << cloud.id << "\n";
         o << "    description:  " << cloud.description << "\n";
         o << "    interface_id: " << cloud.interface_id << "\n";
         o << "    cloud_id:     " << cloud.cloud_id << "\n";
@@ -225,173 +424,226 @@ void Model::report(std::ostream& o) const
 
     }
     o << "\nName Service Name Table\n";
-    for (const auto& [address, nameset] : this->ipv4_address_names) {
+    std::vector<std::pair<IPAddress, const NameSet*>> sorted_names;
+    this->ipv4_address_names.for_each([&](uint32_t key, const NameSet& nameset) {
+        IPV4Address address;
+        memcpy(address.data(), &key, address.size());
+        sorted_names.emplace_back(address, &nameset);
+    });
+    this->ipv6_address_names.for_each([&](uint128_t key, const NameSet& nameset) {
+        IPV6Address address;
+        memcpy(address.data(), &key, address.size());
+        sorted_names.emplace_back(address, &nameset);
+    });
+    std::sort(sorted_names.begin(), sorted_names.end());
+    for (const auto& [address, nameset] : sorted_names) {
         o << "    " << address << ":";
-        for (const NameEntry& ne : nameset)
+        for (const NameEntry& ne : *nameset)
             o << " " << ne.name;
         o << "\n";
     }
 }
 
 
-void Model::load_oui(const std::string& path, bool verbose)
+void Model::set_reference(std::shared_ptr<const ReferenceDB> reference)
 {
-    //  This seems to be an ISO-4180 formatted file.
+    std::atomic_store(&this->next_reference, std::move(reference));
+    this->reference_changed.store(true, std::memory_order_release);
+}
 
-    std::ifstream in(path);
-    if (!in.good())
-        throw std::invalid_argument("unable to open OUI CSV file");
 
-    int count = 0;
-    char line[1024];
-    while (in.getline(line, sizeof(line), '\n')) {
-        if (!count++)
-            continue; // Skip column header line.
-        char* ptr = line;
+std::shared_ptr<const ReferenceDB> Model::take_retired_reference()
+{
+    return std::atomic_exchange(&this->retired_reference, std::shared_ptr<const ReferenceDB>());
+}
 
-        //  Discard first column.
-        while (*ptr && *ptr != ',')
-            ptr++;
-        if (*ptr != ',')
-            throw std::invalid_argument("OUI parse error, missing first comma");
-        ptr++;
 
-        //  Second column should contain a 6-digit hex OUI value.
-        int oui = 0;
-        for (int i=0; i<6; ++i) {
-            int digit = tolower(*ptr++);
-            if (digit >= 'a')
-                digit = digit - 'a' + 10;
-            else
-                digit -= '0';
-            oui = (oui << 4) + digit;
-        }
-        if (*ptr++ != ',')
-            throw std::invalid_argument("OUI parse error, expected second comma");
-
-        //  Third column is organization name.
-        bool quoted = (*ptr == '"');
-        if (quoted)
-            ++ptr;
-        char* name_start = ptr;
-        if (quoted) {
-            //  A "" inside the field is a single quote, and not a field delimiter.
-            while (*ptr) {
-                if (ptr[0] == '"' && ptr[1] == '"')
-                    ptr += 2;
-                else if (*ptr == '"')
-                    break;
-                else
-                    ++ptr;
-            }
-            if (*ptr != '"')
-                throw std::invalid_argument("OUI parse error, third column, unmatched quote");
-        }
-        else {
-            while (*ptr && *ptr != ',')
-                ++ptr;
-            if (*ptr != ',')
-                throw std::invalid_argument("OUI parse error, expected third comma");
+void Model::adopt_reference()
+{
+    //  The last tables retired haven't been taken yet.  Freeing them here
+    //  would stall the packet path, so keep the current tables until then.
+    //  reference_changed stays set, so this is tried again next time.
+    if (std::atomic_load(&this->retired_reference))
+        return;
+
+    this->reference_changed.store(false, std::memory_order_relaxed);
+    std::shared_ptr<const ReferenceDB> next = std::atomic_exchange(&this->next_reference, std::shared_ptr<const ReferenceDB>());
+    if (!next)
+        return;
+
+    //  Hand the old tables back rather than freeing them here.
+    this->reference.swap(next);
+    std::atomic_store(&this->retired_reference, std::move(next));
+
+    this->refreshing = true;
+    this->refresh_interfaces_index = 0;
+    this->refresh_ip_addresses_index = 0;
+}
+
+
+void Model::refresh_reference()
+{
+    uint32_t budget = refresh_batch;
+    while (budget && this->refresh_interfaces_index < this->interfaces.size()) {
+        --budget;
+        Interface& interface = this->interfaces[this->refresh_interfaces_index++];
+        if (annotate(interface))
+            emit(interface);
+    }
+    while (budget && this->refresh_ip_addresses_index < this->ip_addresses.size()) {
+        --budget;
+        IPAddressInfo& ip_address_info = this->ip_addresses[this->refresh_ip_addresses_index++];
+        if (!annotate(ip_address_info))
+            continue;
+        //  Move addresses outside the LAN to their new ASN's subcloud.
+        if (ip_address_info.cloud_id) {
+            const Cloud& cloud = this->cloud(ip_address_info.cloud_id);
+            long parent_id = cloud.cloud_id ? cloud.cloud_id : cloud.id;
+            ip_address_info.cloud_id = as_cloud_id(parent_id, ip_address_info);
         }
+        emit(ip_address_info);
+    }
+    if (budget)
+        this->refreshing = false;
+}
+
 
-        std::string org_name(name_start, ptr);
+bool Model::annotate(Interface& interface)
+{
+    const MacAddress& address = interface.address;
+    uint32_t oui = (uint32_t(address[0]) << 16) | (uint32_t(address[1]) << 8) | uint32_t(address[2]);
+    const char* maker = this->reference->maker(oui);
+    if (!maker)
+        maker = "";
+    if (interface.maker == maker)
+        return false;
+    interface.maker = maker;
+    return true;
+}
 
-        //  Discard the remaining columns.
 
-        this->ouis[oui] = org_name;
+bool Model::annotate(IPAddressInfo& ip_address_info)
+{
+    unsigned long asn = 0;
+    const char* as_name = "";
+    if (ip_address_info.address.is_ipv6()) {
+        const ReferenceDB::Prefix6* prefix = this->reference->look_up(ip_address_info.address.ipv6());
+        if (prefix)
+            asn = prefix->asn;
     }
-    if (verbose)
-        std::cerr << count << " OUIs loaded from " << path << std::endl;
+    else {
+        const ReferenceDB::Prefix* prefix = this->reference->look_up(ip_address_info.address.ipv4());
+        if (prefix)
+            asn = prefix->asn;
+    }
+    if (asn) {
+        as_name = this->reference->as_name(asn);
+        if (!as_name)
+            as_name = "";
+    }
+    if (ip_address_info.asn == asn && ip_address_info.as_name == as_name)
+        return false;
+    ip_address_info.asn = asn;
+    ip_address_info.as_name = as_name;
+    return true;
 }
 
 
-void Model::load_prefixes(const std::string& path, bool verbose)
+long Model::new_id(uint32_t index)
 {
-    this->prefixes.load(path, verbose);
+    this->index_by_id.push_back(index);
+    return this->next_id++;
 }
 
 
-void Model::load_asns(const std::string& path, bool verbose)
+uint32_t Model::find_interface(const MacAddress& address, uint16_t vlan) const
 {
-    std::ifstream in(path);
-    if (!in.good())
-        throw std::invalid_argument("unable to open ASN file");
+    const uint32_t* ix = this->interfaces_by_address.find(interface_key(address, vlan));
+    return ix ? *ix : no_index;
+}
 
-    int count = 0;
-    char line[1024];
-    while (in.getline(line, sizeof(line), '\n')) {
-        ++count;
-        char* ptr = line;
 
-        //  Read past leading whitespace.
-        while (*ptr == ' ')
-            ++ptr;
+//  Create a new network.
+long Model::new_network(uint16_t vlan)
+{
+    uint32_t ix = this->networks.size();
+    Network& network = this->networks.emplace_back();
+    network.id = this->new_id(ix);
+    network.parent_id = network.id;
+    network.vlan = vlan;
+    emit(network);
+    return network.id;
+}
 
-        uint32_t asn = 0;
-        while (*ptr && isdigit(*ptr))
-            asn = asn * 10 + *ptr++ - '0';
 
-        //  Whitespace.
-        while (*ptr == ' ')
-            ++ptr;
+long Model::network_for_new_interface(uint16_t vlan)
+{
+    if (!this->assume_one_lan)
+        return this->new_network(vlan);
+
+    //  Assume all interfaces in a VLAN are on the same network.
+    long* network_id = this->lan_network_ids.find(vlan);
+    if (network_id)
+        return this->find_network(*network_id);
+    long id = this->new_network(vlan);
+    this->lan_network_ids[vlan] = id;
+    return id;
+}
+
 
-        this->asns[asn] = ptr;
+long Model::find_network(long id)
+{
+    //  Path halving: point each network passed at its grandparent,
+    //  so later finds take fewer steps.
+    for (;;) {
+        Network& network = this->network(id);
+        if (network.parent_id == id)
+            return id;
+        network.parent_id = this->network(network.parent_id).parent_id;
+        id = network.parent_id;
     }
-    if (verbose)
-        std::cerr << count << " ASNs loaded from " << path << std::endl;
 }
 
 
-//  Create a new network.
-long Model::new_network()
+long Model::network_of(Interface& interface)
 {
-    long id = this->next_id++;
-    Network& network = this->networks[id];  //  Implicit insert.
-    network.id = id;
-    emit(network);
-    return network.id;
+    interface.network_id = this->find_network(interface.network_id);
+    return interface.network_id;
 }
 
 
 //  Create a new interface.
 //  Assign it to the provided network.
-std::map<MacAddress, Model::Interface>::iterator Model::new_interface(const MacAddress& address, long network_id)
+uint32_t Model::new_interface(const MacAddress& address, uint16_t vlan, long network_id)
 {
-    int oui = (int(address[0]) << 16) | (int(address[1]) << 8) | int(address[2]);
-    auto ouis_i = this->ouis.find(oui);
-
-    Interface interface;
+    uint32_t ix = this->interfaces.size();
+    Interface& interface = this->interfaces.emplace_back();
     interface.address = address;
-    interface.id = this->next_id++;
+    interface.vlan = vlan;
+    interface.id = this->new_id(ix);
     interface.network_id = network_id;
-    if (ouis_i != this->ouis.end())
-        interface.maker = ouis_i->second;
-    this->interfaces_by_address[address] = interface;
-    this->interfaces_by_id[interface.id] = address;
-    this->networks[network_id].interfaces.insert(interface.id);
+    annotate(interface);
+    this->interfaces_by_address[interface_key(address, vlan)] = ix;
+    this->network(network_id).size++;
 
     emit(interface);
 
-    return this->interfaces_by_address.find(interface.address);
+    return ix;
 }
 
 
-Model::IPAddressInfo& Model::new_ip_address(const IPV4Address& address, long interface_id)
+Model::IPAddressInfo& Model::new_ip_address(const IPV4Address& address, const Interface& interface)
 {
-    if (this->ip_addresses.count(address))
+    if (find_ip_address(address, interface.vlan))
         throw std::invalid_argument("new_ip_address(): address already exists");
-    IPAddressInfo& ip_address_info = this->ip_addresses[address];;
-    ip_address_info.id = this->next_id++;
+    uint32_t ix = this->ip_addresses.size();
+    IPAddressInfo& ip_address_info = this->ip_addresses.emplace_back();
+    ip_address_info.id = this->new_id(ix);
+    this->ip_addresses_by_address[ip_address_key(address, interface.vlan)] = ix;
     ip_address_info.address = address;
-    ip_address_info.interface_id = interface_id;  // Initially not assigned to any interface.
+    ip_address_info.interface_id = interface.id;
 
-    const IPV4PrefixTable::Prefix* prefix = this->prefixes.look_up(address);
-    if (prefix) {
-        ip_address_info.asn = prefix->asn;
-        auto it = this->asns.find(ip_address_info.asn);
-        if (it != this->asns.end())
-            ip_address_info.as_name = it->second;
-    }
+    annotate(ip_address_info);
 
     emit(ip_address_info);
 
@@ -399,54 +651,75 @@ Model::IPAddressInfo& Model::new_ip_address(const IPV4Address& address, long int
 }
 
 
-Model::IPAddressInfo& Model::new_ip_address(const IPV4Address& address, Cloud& cloud)
+Model::IPAddressInfo& Model::new_ip_address(const IPAddress& address, const MacAddress& mac, uint16_t vlan)
+{
+    //  Create a new IPAddr instance and assign it to the interface's attached Cloud.
+    uint32_t interface_ix = this->find_interface(mac, vlan);
+    if (interface_ix == no_index)
+        throw std::invalid_argument("note_ip_through_interface(): mac address not found");
+    const Interface& interface = this->interfaces[interface_ix];
+
+    if (!this->cloud_ids_by_interface_addresses.find(interface_key(mac, vlan)))
+        this->new_cloud(interface);
+    long cloud_id = *this->cloud_ids_by_interface_addresses.find(interface_key(mac, vlan));
+    Cloud& cloud = this->cloud(cloud_id);
+
+    return this->new_ip_address(address, vlan, cloud);
+}
+
+
+Model::IPAddressInfo& Model::new_ip_address(const IPAddress& address, uint16_t vlan, Cloud& cloud)
 {
-    if (this->ip_addresses.count(address))
+    if (find_ip_address(address, vlan))
         throw std::invalid_argument("new_ip_address(): address already exists");
-    IPAddressInfo& ip_address_info = this->ip_addresses[address];;
-    ip_address_info.id = this->next_id++;
+    uint32_t ix = this->ip_addresses.size();
+    IPAddressInfo& ip_address_info = this->ip_addresses.emplace_back();
+    ip_address_info.id = this->new_id(ix);
+    this->ip_addresses_by_address[ip_address_key(address, vlan)] = ix;
     ip_address_info.address = address;
     ip_address_info.interface_id = 0;
     ip_address_info.cloud_id = cloud.id;
     
     //  Do we have a name server name for this IP address?
-    auto ns_it = this->ipv4_address_names.find(address);
-    if (ns_it != this->ipv4_address_names.end())
-        ip_address_info.ns_name = ns_it->second.begin()->name;
+    const NameSet* names = address.is_ipv6() ? this->ipv6_address_names.find(pack(address.ipv6()))
+                                             : this->ipv4_address_names.find(pack(address.ipv4()));
+    if (names)
+        ip_address_info.ns_name = names->begin()->name;
 
     //  Do we have an ASN for this IP address?
-    const IPV4PrefixTable::Prefix* prefix = this->prefixes.look_up(address);
-    if (prefix) {
-        ip_address_info.asn = prefix->asn;
-        auto it = this->asns.find(ip_address_info.asn);
-        if (it != this->asns.end())
-            ip_address_info.as_name = it->second;
-    }
+    annotate(ip_address_info);
+    ip_address_info.cloud_id = as_cloud_id(cloud.id, ip_address_info);
+
+    emit(ip_address_info);
+
+    return ip_address_info;
+}
+
 
+const uint32_t* Model::find_ip_address(const IPAddress& address, uint16_t vlan) const
+{
+    return this->ip_addresses_by_address.find(ip_address_key(address, vlan));
+}
+
+
+long Model::as_cloud_id(long cloud_id, const IPAddressInfo& ip_address_info)
+{
     //  If this address has a known ASN owner, attach this address
     //  to a subcloud named after the ASN.
     //
-    if (ip_address_info.as_name.size()) {
-        std::string description = std::string("AS") + std::to_string(ip_address_info.asn) + " " + ip_address_info.as_name;
-
-        //  Find an existing subcloud.
-        for (long child_id : cloud.child_cloud_ids) {
-            Cloud& child_cloud = this->clouds.at(child_id);
-            if (child_cloud.description == description) {
-                ip_address_info.cloud_id = child_cloud.id;
-                break;
-            }
-        }
-        //  Else make a new subcloud.
-        if (ip_address_info.cloud_id == cloud.id) {
-            Cloud& subcloud = new_cloud(cloud, description);
-            ip_address_info.cloud_id = subcloud.id;
-        }
-    }
+    if (ip_address_info.as_name.empty())
+        return cloud_id;
 
-    emit(ip_address_info);
+    std::string description = std::string("AS") + std::to_string(ip_address_info.asn) + " " + ip_address_info.as_name;
 
-    return ip_address_info;
+    //  Find an existing subcloud.
+    for (long child_id : this->cloud(cloud_id).child_cloud_ids) {
+        Cloud& child_cloud = this->cloud(child_id);
+        if (child_cloud.description == description)
+            return child_cloud.id;
+    }
+    //  Else make a new subcloud.
+    return new_cloud(this->cloud(cloud_id), description).id;
 }
 
 
@@ -455,9 +728,10 @@ Model::IPAddressInfo& Model::new_ip_address(const IPV4Address& address, Cloud& c
 //
 Model::Cloud& Model::new_cloud(const Interface& interface, const std::string& description)
 {
-    long id = this->next_id++;
-    Cloud& cloud = this->clouds[id];
-    this->cloud_ids_by_interface_addresses[interface.address] = id;
+    uint32_t ix = this->clouds.size();
+    Cloud& cloud = this->clouds.emplace_back();
+    long id = this->new_id(ix);
+    this->cloud_ids_by_interface_addresses[interface_key(interface.address, interface.vlan)] = id;
     cloud.id = id;
     cloud.description = description;
     cloud.interface_id = interface.id;
@@ -473,13 +747,15 @@ Model::Cloud& Model::new_cloud(const Interface& interface, const std::string& de
 //
 Model::Cloud& Model::new_cloud(Cloud& parent, const std::string& description)
 {
-    long id = this->next_id++;
-    Cloud& cloud = this->clouds[id];
+    long parent_id = parent.id;
+    uint32_t ix = this->clouds.size();
+    Cloud& cloud = this->clouds.emplace_back();
+    long id = this->new_id(ix);
     cloud.id = id;
     cloud.description = description;
     cloud.interface_id = 0;
-    cloud.cloud_id = parent.id;
-    parent.child_cloud_ids.insert(id);
+    cloud.cloud_id = parent_id;
+    this->cloud(parent_id).child_cloud_ids.insert(id);
 
     emit(cloud);
 
@@ -487,23 +763,20 @@ Model::Cloud& Model::new_cloud(Cloud& parent, const std::string& description)
 }
 
 
-//  Reassign all interfaces connected on network B to network A.
-//  Delete network B.
+//  Fold the network with fewer interfaces into the other.
+//  Its interfaces aren't touched, and aren't re-emitted.  Rather, the
+//  merged network's fini event says where its interfaces have gone.
 void Model::merge_networks(long a_id, long b_id)
 {
-    for (long interface_id : this->networks[b_id].interfaces) {
-        MacAddress address = this->interfaces_by_id[interface_id];
-        Interface& interface = this->interfaces_by_address[address];
-        interface.network_id = a_id;
-        this->networks[a_id].interfaces.insert(interface.id);
-        emit(interface);
-    }
-
-    Network& b_network = this->networks[b_id];
-    b_network.interfaces.clear();
-    emit(b_network, true);
-
-    this->networks.erase(b_id);
+    Network* a = &this->network(a_id);
+    Network* b = &this->network(b_id);
+    if (b->size > a->size)
+        std::swap(a, b);
+
+    b->parent_id = a->id;
+    a->size += b->size;
+    b->size = 0;
+    emit(*b, true);
 }
 
 
@@ -514,8 +787,10 @@ void Model::emit(const Network& network, bool fini)
     event.set_packet(this->packet_count);
     event.mutable_network()->set_id(network.id);
     event.mutable_network()->set_fini(fini);
-    std::cout << event;
-    std::cout << std::flush;
+    event.mutable_network()->set_vlan(network.vlan);
+    if (network.parent_id != network.id)
+        event.mutable_network()->set_merged_into(network.parent_id);
+    this->events.write(event);
 }
 
 
@@ -526,11 +801,10 @@ void Model::emit(const Interface& interface, bool fini)
     event.set_packet(this->packet_count);
     event.mutable_interface()->set_id(interface.id);
     event.mutable_interface()->set_fini(fini);
-    event.mutable_interface()->set_network_id(interface.network_id);
+    event.mutable_interface()->set_network_id(this->find_network(interface.network_id));
     event.mutable_interface()->set_address(std::string(interface.address.begin(), interface.address.end()));
     event.mutable_interface()->set_maker(interface.maker);
-    std::cout << event;
-    std::cout << std::flush;
+    this->events.write(event);
 }
 
 
@@ -541,14 +815,14 @@ void Model::emit(const IPAddressInfo& ipaddress, bool fini)
     event.set_packet(this->packet_count);
     event.mutable_ipaddress()->set_id(ipaddress.id);
     event.mutable_ipaddress()->set_fini(fini);
-    event.mutable_ipaddress()->set_address(std::string(ipaddress.address.begin(), ipaddress.address.end()));
+    const char* address = reinterpret_cast<const char*>(ipaddress.address.data());
+    event.mutable_ipaddress()->set_address(std::string(address, address + ipaddress.address.size()));
     if (ipaddress.interface_id)
         event.mutable_ipaddress()->set_interface_id(ipaddress.interface_id);
     else
         event.mutable_ipaddress()->set_cloud_id(ipaddress.cloud_id);
     event.mutable_ipaddress()->set_ns_name(ipaddress.ns_name);
-    std::cout << event;
-    std::cout << std::flush;
+    this->events.write(event);
 }
 
 
@@ -557,22 +831,201 @@ void Model::emit_traffic_update()
     Lansnoop::Event event;
     event.set_timestamp(this->now);
     event.set_packet(this->packet_count);
+    if (this->use_traffic_maps)
+        fill_traffic_maps(*event.mutable_traffic());
+    else
+        fill_traffic_deltas(*event.mutable_traffic());
+    this->dirty_interfaces.clear();
+    this->dirty_clouds.clear();
+    this->dirty_ip_addresses.clear();
+    this->dirty_vlans.clear();
+    this->dirty_connections.clear();
+
+    this->events.write(event);
+}
+
 
-    for (const MacAddress& mac_address : this->recent_interface_traffic) {
-        const Interface& interface = this->interfaces_by_address.at(mac_address);
-        (*event.mutable_traffic()->mutable_interface_packet_counts())[interface.id] = interface.packet_count;
+//  Note that an entity's counts and rates have been reported.
+template<class Entity>
+static void reported(Entity& entity)
+{
+    entity.reported_packet_count = entity.packet_count;
+    entity.reported_byte_count = entity.byte_count;
+    if (entity.rate.changed) {
+        entity.rate.reported_packets_per_second = entity.rate.packets_per_second;
+        entity.rate.reported_bits_per_second = entity.rate.bits_per_second;
+        entity.rate.changed = false;
+    }
+    entity.dirty = false;
+}
+
+
+void Model::fill_traffic_maps(Lansnoop::Traffic& traffic)
+{
+    //  Report each dirty entity's counts, and rates if they've been
+    //  updated, and clear it for next time.
+    auto fill = [](auto& entity, uint32_t id, auto& packet_counts, auto& byte_counts, auto& rates) {
+        packet_counts[id] = entity.packet_count;
+        byte_counts[id] = entity.byte_count;
+        if (entity.rate.changed) {
+            Lansnoop::Rate& rate = rates[id];
+            rate.set_packets_per_second(entity.rate.packets_per_second);
+            rate.set_bits_per_second(entity.rate.bits_per_second);
+        }
+        reported(entity);
+    };
+    for (uint32_t ix : this->dirty_interfaces) {
+        Interface& interface = this->interfaces[ix];
+        fill(interface, interface.id, *traffic.mutable_interface_packet_counts(),
+             *traffic.mutable_interface_byte_counts(), *traffic.mutable_interface_rates());
+    }
+    for (uint32_t ix : this->dirty_clouds) {
+        Cloud& cloud = this->clouds[ix];
+        fill(cloud, cloud.id, *traffic.mutable_cloud_packet_counts(),
+             *traffic.mutable_cloud_byte_counts(), *traffic.mutable_cloud_rates());
+    }
+    for (uint32_t ix : this->dirty_ip_addresses) {
+        IPAddressInfo& ipaddressinfo = this->ip_addresses[ix];
+        fill(ipaddressinfo, ipaddressinfo.id, *traffic.mutable_ipaddress_packet_counts(),
+             *traffic.mutable_ipaddress_byte_counts(), *traffic.mutable_ipaddress_rates());
+    }
+    auto& connection_counts = *traffic.mutable_connection_counts();
+    for (uint32_t ix : this->dirty_connections) {
+        Connection& connection = this->connections[ix];
+        if (!connection.dirty)
+            continue;  //  Closed since, or listed already.
+        Lansnoop::ConnectionCounts& counts = connection_counts[connection.id];
+        counts.set_a_packets(connection.packet_counts[0]);
+        counts.set_b_packets(connection.packet_counts[1]);
+        counts.set_a_bytes(connection.byte_counts[0]);
+        counts.set_b_bytes(connection.byte_counts[1]);
+        connection.dirty = false;
+    }
+    for (uint32_t vlan : this->dirty_vlans)
+        fill(this->vlans[vlan], vlan, *traffic.mutable_vlan_packet_counts(),
+             *traffic.mutable_vlan_byte_counts(), *traffic.mutable_vlan_rates());
+}
+
+
+//  Fill :deltas: from the :dirty: indexes into :entities:, and clear them
+//  for next time.  :id:(index) is an entity's ID.  Sorts :dirty: by ID.
+template<class Entity, class ID>
+static void fill_deltas(Lansnoop::TrafficDeltas& deltas, std::vector<Entity>& entities,
+                        std::vector<uint32_t>& dirty, ID id)
+{
+    std::sort(dirty.begin(), dirty.end(), [&id](uint32_t a, uint32_t b) { return id(a) < id(b); });
+    deltas.mutable_ids()->Reserve(dirty.size());
+    deltas.mutable_packets()->Reserve(dirty.size());
+    deltas.mutable_bytes()->Reserve(dirty.size());
+
+    uint32_t previous_id = 0, previous_rate_id = 0;
+    for (uint32_t ix : dirty) {
+        Entity& entity = entities[ix];
+        uint32_t entity_id = id(ix);
+        //  Listed for a rate change alone, maybe.
+        if (entity.packet_count != entity.reported_packet_count) {
+            deltas.add_ids(entity_id - previous_id);
+            deltas.add_packets(entity.packet_count - entity.reported_packet_count);
+            deltas.add_bytes(entity.byte_count - entity.reported_byte_count);
+            previous_id = entity_id;
+        }
+        if (entity.rate.changed) {
+            deltas.add_rate_ids(entity_id - previous_rate_id);
+            deltas.add_packets_per_second(entity.rate.packets_per_second);
+            deltas.add_bits_per_second(entity.rate.bits_per_second);
+            previous_rate_id = entity_id;
+        }
+        reported(entity);
     }
-    for (long id : this->recent_cloud_traffic) {
-        const Cloud& cloud = this->clouds.at(id);
-        (*event.mutable_traffic()->mutable_cloud_packet_counts())[id] = cloud.packet_count;
+}
+
+
+void Model::fill_traffic_deltas(Lansnoop::Traffic& traffic)
+{
+    fill_deltas(*traffic.mutable_interfaces(), this->interfaces, this->dirty_interfaces,
+                [this](uint32_t ix) { return this->interfaces[ix].id; });
+    fill_deltas(*traffic.mutable_clouds(), this->clouds, this->dirty_clouds,
+                [this](uint32_t ix) { return this->clouds[ix].id; });
+    fill_deltas(*traffic.mutable_ipaddresses(), this->ip_addresses, this->dirty_ip_addresses,
+                [this](uint32_t ix) { return this->ip_addresses[ix].id; });
+    if (this->dirty_vlans.size())
+        fill_deltas(*traffic.mutable_vlans(), this->vlans, this->dirty_vlans,
+                    [](uint32_t vlan) { return vlan; });
+
+    //  Connection slots are reused, so their order isn't their IDs'.
+    std::vector<uint32_t>& dirty = this->dirty_connections;
+    std::sort(dirty.begin(), dirty.end(), [this](uint32_t a, uint32_t b) {
+        return this->connections[a].id < this->connections[b].id;
+    });
+    uint32_t previous_id = 0;
+    for (uint32_t ix : dirty) {
+        Connection& connection = this->connections[ix];
+        if (!connection.dirty)
+            continue;  //  Closed since, or listed already.
+        Lansnoop::ConnectionCountArrays& counts = *traffic.mutable_connections();
+        counts.add_ids(connection.id - previous_id);
+        counts.add_a_packets(connection.packet_counts[0]);
+        counts.add_b_packets(connection.packet_counts[1]);
+        counts.add_a_bytes(connection.byte_counts[0]);
+        counts.add_b_bytes(connection.byte_counts[1]);
+        previous_id = connection.id;
+        connection.dirty = false;
     }
-    for (const IPV4Address& ip : this->recent_ipaddress_traffic) {
-        const IPAddressInfo& ipaddressinfo = this->ip_addresses.at(ip);
-        (*event.mutable_traffic()->mutable_ipaddress_packet_counts())[ipaddressinfo.id] = ipaddressinfo.packet_count;
+}
+
+
+void Model::emit_resolver_updates()
+{
+    for (uint32_t ix : this->dirty_resolvers) {
+        Resolver& resolver = this->resolvers[ix];
+        emit(resolver);
+        resolver.dirty = false;
     }
+    this->dirty_resolvers.clear();
+}
 
-    std::cout << event;
-    std::cout << std::flush;
+
+void Model::emit(const Resolver& resolver, bool fini)
+{
+    Lansnoop::Event event;
+    event.set_timestamp(this->now);
+    event.set_packet(this->packet_count);
+    event.mutable_resolver()->set_id(resolver.id);
+    event.mutable_resolver()->set_fini(fini);
+    event.mutable_resolver()->set_ipaddress_id(resolver.ip_address_id);
+    for (long count : resolver.latency_counts)
+        event.mutable_resolver()->add_latency_counts(count);
+    event.mutable_resolver()->set_latency_sum_usec(resolver.latency_sum_usec);
+    event.mutable_resolver()->set_timeouts(resolver.timeouts);
+    this->events.write(event);
+}
+
+
+void Model::emit(const Connection& connection, bool fini)
+{
+    static_assert(int(ConnectionProtocol::DNS) == Lansnoop::Connection::DNS, "ConnectionProtocol should match Connection.Protocol");
+    static_assert(int(ConnectionEnd::SHED) == Lansnoop::Connection::SHED, "ConnectionEnd should match Connection.End");
+
+    Lansnoop::Event event;
+    event.set_timestamp(this->now);
+    event.set_packet(this->packet_count);
+    Lansnoop::Connection& c = *event.mutable_connection();
+    c.set_id(connection.id);
+    c.set_fini(fini);
+    c.set_ipaddress_a_id(connection.ip_address_a_id);
+    c.set_ipaddress_b_id(connection.ip_address_b_id);
+    c.set_protocol(Lansnoop::Connection::Protocol(connection.protocol));
+    c.set_port_a(connection.a_port);
+    c.set_port_b(connection.b_port);
+    if (fini) {
+        c.set_established(connection.established);
+        c.set_end(Lansnoop::Connection::End(connection.end));
+        c.mutable_counts()->set_a_packets(connection.packet_counts[0]);
+        c.mutable_counts()->set_b_packets(connection.packet_counts[1]);
+        c.mutable_counts()->set_a_bytes(connection.byte_counts[0]);
+        c.mutable_counts()->set_b_bytes(connection.byte_counts[1]);
+    }
+    this->events.write(event);
 }
 
 
@@ -588,6 +1041,5 @@ void Model::emit(const Cloud& cloud, bool fini)
         event.mutable_cloud()->set_interface_id(cloud.interface_id);
     else
         event.mutable_cloud()->set_cloud_id(cloud.cloud_id);
-    std::cout << event;
-    std::cout << std::flush;
+    this->events.write(event);
 }
@@ -1,38 +1,77 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <ostream>
 
-#include "IPV4PrefixTable.hpp"
+#include "EventWriter.hpp"
+#include "FlatHashMap.hpp"
+#include "ReferenceDB.hpp"
 #include "util.hpp"
 
 
 
 class Model {
 public:
+    //  Networks form a disjoint-set forest.  Merging a network into another
+    //  just makes it a child, so merges take near-constant time however
+    //  many interfaces are involved.  An interface's network is the root
+    //  of the tree its network_id is in.
     struct Network {
         long id;
-        std::set<long> interfaces;
+        long parent_id;  //  Equal to id iff this network hasn't been merged into another.
+        long size = 0;   //  Number of interfaces, if not merged.
+        uint16_t vlan = 0;  //  802.1Q VLAN ID of its interfaces, 0 if untagged.
+    };
+
+    //  An entity's traffic rates, exponentially weighted moving averages
+    //  brought up to date from its counts every rate_interval.
+    struct Rate {
+        float packets_per_second = 0;
+        float bits_per_second = 0;
+        long packet_count = 0;  //  The entity's counts as of the last update.
+        long byte_count = 0;
+        float reported_packets_per_second = 0;  //  As last reported.
+        float reported_bits_per_second = 0;
+        bool active = false;    //  Listed for updates, until it decays away after the entity goes quiet.
+        bool changed = false;   //  Changed enough to report since the last traffic update.
     };
 
     struct Interface {
         long id;
         MacAddress address;  // MAC address
-        long network_id; //  All interfaces belong to exactly one network.
+        uint16_t vlan = 0;   // VLAN it was seen in.  The same MAC address in another VLAN is another interface.
+        long network_id; //  All interfaces belong to exactly one network.  Possibly since merged; see find_network().
         std::string maker;
         long packet_count = 0; // Number of Ethernet frames addressed to or from this interface.
+        long byte_count = 0;   // Their bytes.
+        long reported_packet_count = 0;  // Counts as of the last traffic update.
+        long reported_byte_count = 0;
+        Rate rate;
+        bool dirty = false;    // Counts or rates changed since the last traffic update.
     };
 
     struct IPAddressInfo {
         long id;
-        IPV4Address address;
+        IPAddress address;  //  IPv4 or IPv6.
         long interface_id;  //  Iff not 0, this IP address is attached to this interface.
         long cloud_id;      //  Iff not 0, this IP address is attached to this cloud.
         long packet_count = 0; // Number of packets addressed to or from this IP address.
+        long byte_count = 0;   // Bytes of the frames carrying them.
+        long reported_packet_count = 0;  // Counts as of the last traffic update.
+        long reported_byte_count = 0;
+        Rate rate;
+        bool dirty = false;    // Counts or rates changed since the last traffic update.
         std::string ns_name; // Name service name assigned to this address.
-        unsigned long asn;  // If known, 0 otherwise.  (ASN 0 is reserved.)
+        unsigned long asn = 0;  // If known, 0 otherwise.  (ASN 0 is reserved.)
         std::string as_name; // 
     };
 
@@ -43,114 +82,386 @@ public:
         long cloud_id;      //  Iff not 0, this IP cloud is attached to this parent cloud.
         std::set<long> child_cloud_ids; // Clouds inside this cloud.
         long packet_count = 0; // Number of packets addressed to or from IP addresses in this cloud.
+        long byte_count = 0;   // Bytes of the frames carrying them.
+        long reported_packet_count = 0;  // Counts as of the last traffic update.
+        long reported_byte_count = 0;
+        Rate rate;
+        bool dirty = false;    // Counts or rates changed since the last traffic update.
     };
 
-    void note_time(long t);
-    void note_packet_count(long c) { this->packet_count = c; }
+    //  A DNS resolver, and how quickly it answers queries.
+    struct Resolver {
+        long id;
+        long ip_address_id;
+        //  Responses by latency: under 1ms, then [2^(i-1), 2^i) ms, then slower.
+        static constexpr int latency_buckets = 16;
+        std::array<long, latency_buckets> latency_counts {};
+        long latency_sum_usec = 0;
+        long timeouts = 0;   // Queries never answered.
+        bool dirty = false;  // Changed since the last resolver update.
+    };
 
-    //  Note one Ethernet packet traversing between two interfaces.
-    void note_l2_packet_traffic(const MacAddress& source_address,
-                                const MacAddress& destination_address);
+    //  The note_*() methods must be called from one thread at a time.  To
+    //  feed one Model from several threads, give each its own Shard.
+    class Shard;
 
-    //  Note an IP address being routed through an ethernet interface.
-    void note_ip_through_interface(const IPV4Address& ip, const MacAddress& mac);
+    void note_time(long t);
+    void note_packet();
 
-    void note_arp(const MacAddress& mac_address, const IPV4Address& ip_address);
+    //  Note an Ethernet packet traversing between two interfaces, in a
+    //  frame :bytes: long on the wire and tagged with VLAN ID :vlan:, 0 if
+    //  untagged, or :packets: such frames, :bytes: long in all.
+    //  Interfaces and networks are kept per VLAN, and networks in
+    //  different VLANs are never merged.
+    void note_l2_packet_traffic(const MacAddress& source_address,
+                                const MacAddress& destination_address,
+                                unsigned long bytes, uint16_t vlan = 0, unsigned packets = 1);
+
+    //  Note an IP address being routed through an ethernet interface, in a
+    //  frame :bytes: long on the wire, or :packets: frames :bytes: long in
+    //  all, counted against the address and its clouds.  IP addresses are
+    //  kept per VLAN, like interfaces: the same address in two VLANs is
+    //  two hosts.
+    void note_ip_through_interface(const IPV4Address& ip, const MacAddress& mac, unsigned long bytes,
+                                   uint16_t vlan = 0, unsigned packets = 1);
+    void note_ip_through_interface(const IPV6Address& ip, const MacAddress& mac, unsigned long bytes,
+                                   uint16_t vlan = 0, unsigned packets = 1);
+
+    //  Note an ARP reply in VLAN :vlan: assigning an IP address to an interface.
+    void note_arp(const MacAddress& mac_address, const IPV4Address& ip_address, uint16_t vlan = 0);
 
     enum class NameType {
         DNS,
     };
-    //  Note a name assigned to an IP address.
-    void note_name(const IPV4Address& address, const std::string& name, NameType type);
+    //  Note a name assigned to an IP address, by a DNS response seen in VLAN
+    //  :vlan:.  The name is remembered for the address in every VLAN, but
+    //  only given to one already known in :vlan:.
+    void note_name(const IPV4Address& address, std::string_view name, NameType type, uint16_t vlan = 0);
+    void note_name(const IPV6Address& address, std::string_view name, NameType type, uint16_t vlan = 0);
+
+    enum class ConnectionProtocol : uint8_t {
+        UDP,
+        TCP,
+        DNS,
+    };
+    enum class ConnectionEnd : uint8_t {
+        NOT_ENDED,
+        CLOSED,  //  Both ends closed it.
+        RESET,
+        IDLE,    //  Forgotten after no packets for the idle timeout.
+        SHED,    //  Forgotten to make room for new connections.
+    };
+    //  Note a new connection between two IP addresses in VLAN :vlan:, :a:
+    //  being the end that opened it.  Returns a handle for the calls below,
+    //  good until the connection is closed.
+    uint32_t open_connection(ConnectionProtocol protocol,
+                             const IPAddress& a, uint16_t a_port,
+                             const IPAddress& b, uint16_t b_port, uint16_t vlan = 0);
+    //  Note a packet carrying :bytes: of payload, from a if :from_b: is 0,
+    //  else from b, or :packets: packets carrying :bytes: in all.
+    void note_connection_packet(uint32_t connection, int from_b, unsigned long bytes, unsigned packets = 1);
+    //  Note a connection's end.  :established: if it was seen opening, or carrying data.
+    void close_connection(uint32_t connection, ConnectionEnd end, bool established);
+
+    //  Note a response from the DNS resolver at :resolver: in VLAN :vlan:,
+    //  :latency: nanoseconds after the query.
+    void note_dns_response(const IPAddress& resolver, long latency, uint16_t vlan = 0);
+    //  Note a query to a DNS resolver that was never answered.
+    void note_dns_timeout(const IPAddress& resolver, uint16_t vlan = 0);
 
     //  Generate a topology report.
     void report(std::ostream&) const;
 
-    //  Load the OUI table from a CSV file.
-    //  Obtain from http://standards-oui.ieee.org/oui/oui.csv
-    void load_oui(const std::string& path, bool verbose = false);
+    //  Replace the OUI, prefix and ASN tables.  May be called from any thread,
+    //  while packets are being noted.  The packet path switches to the new
+    //  tables at its next note_time(), once the tables it last switched away
+    //  from have been taken, then re-annotates the interfaces and IP
+    //  addresses it already knows a batch at a time, emitting updates for
+    //  those that changed.
+    void set_reference(std::shared_ptr<const ReferenceDB> reference);
 
-    void load_prefixes(const std::string& path, bool verbose = false);
-    void load_asns(const std::string& path, bool verbose = false);
+    //  Returns the tables the packet path has switched away from, if any,
+    //  so that they can be freed on another thread.
+    std::shared_ptr<const ReferenceDB> take_retired_reference();
 
     void one_lan(bool b) { assume_one_lan = b; }
 
+    //  Events are written to stdout in batches, at most this many microseconds
+    //  after they happen.  0 writes each event immediately.
+    void flush_usec(long usec) { events.set_flush_usec(usec); }
+
+    //  Send Traffic counts as maps of whole counts, rather than the
+    //  compact arrays of increases.
+    void traffic_maps(bool b) { use_traffic_maps = b; }
+
+    //  Write out any events still buffered.
+    void flush();
+
 private:
 
     long now = 0; //  Nanoseconds since the epoch.
     long packet_count = 0;
 
     bool assume_one_lan { false };
+    bool use_traffic_maps { false };
+
+    //  Held by a Shard while it applies its batch.
+    std::mutex mutex;
+
+    EventWriter events { 1 };  // stdout
 
     //  Unique ID generator.
     //  First ID is 1 because, in some cases, 0 means "none".
     long next_id = 1;
 
-    //  Maps network ID's to network instances.
-    std::map<long, Network> networks;
-
-    //  Maps an interface's MAC address to its Interface instance.
-    std::map<MacAddress, Interface> interfaces_by_address;
-
-    //  Set of objects that have had packet traffic since the last traffic update.
-    std::set<MacAddress> recent_interface_traffic;
-    std::set<long> recent_cloud_traffic;
-    std::set<IPV4Address> recent_ipaddress_traffic;
-    //  TODO: maybe make these just maps id->count and save a lookup on emit?
+    //  Networks, interfaces, IP addresses and clouds are kept in dense vectors, one
+    //  per type, and never removed.  IDs are shared by all types, so
+    //  index_by_id maps each ID to its entity's index in its type's vector.
+    //  Creating an entity may move the others of its type, invalidating
+    //  references to them.
+    std::vector<Network> networks;
+    std::vector<Interface> interfaces;
+    std::vector<IPAddressInfo> ip_addresses;
+    std::vector<Cloud> clouds;
+    std::vector<Resolver> resolvers;
+    std::vector<uint32_t> index_by_id { 0 };  // ID 0 is never used.
+
+    Network& network(long id) { return this->networks[this->index_by_id[id]]; }
+    Interface& interface(long id) { return this->interfaces[this->index_by_id[id]]; }
+    IPAddressInfo& ip_address(long id) { return this->ip_addresses[this->index_by_id[id]]; }
+    Cloud& cloud(long id) { return this->clouds[this->index_by_id[id]]; }
+
+    //  Interfaces are keyed by MAC address and VLAN ID, packed together.
+    static uint64_t interface_key(const MacAddress& address, uint16_t vlan) {
+        return pack(address) | uint64_t(vlan) << 48;
+    }
+
+    //  Maps an interface key to its index in :interfaces:.
+    FlatHashMap<uint64_t, uint32_t> interfaces_by_address;
+
+    //  IP addresses are keyed by address and VLAN ID.
+    struct IPAddressKey {
+        uint128_t address;  //  Network byte order, zero padded for IPv4.
+        uint16_t vlan;
+        bool ipv6;
+
+        bool operator ==(const IPAddressKey& rhs) const {
+            return address == rhs.address && vlan == rhs.vlan && ipv6 == rhs.ipv6;
+        }
+        uint64_t hash() const {
+            uint64_t h = uint64_t(address) ^ uint64_t(address >> 64) * 0x9e3779b97f4a7c15ULL;
+            h ^= ((uint64_t(vlan) << 1) | ipv6) * 0xc2b2ae3d27d4eb4fULL;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return h;
+        }
+    };
+    static IPAddressKey ip_address_key(const IPAddress& address, uint16_t vlan) {
+        IPAddressKey key { 0, vlan, address.is_ipv6() };
+        memcpy(&key.address, address.data(), address.size());
+        return key;
+    }
+
+    //  Maps an IP address key to its index in :ip_addresses:.
+    FlatHashMap<IPAddressKey, uint32_t> ip_addresses_by_address;
+
+    //  Returns the index in :ip_addresses: of an IP address in VLAN :vlan:,
+    //  or nullptr if not known.
+    const uint32_t* find_ip_address(const IPAddress&, uint16_t vlan) const;
+
+    //  Maps a resolver's index in :ip_addresses: to its index in :resolvers:.
+    FlatHashMap<uint32_t, uint32_t> resolvers_by_ip_address;
+
+    //  Maps interface keys to IDs of clouds attached to the interface.
+    FlatHashMap<uint64_t, long> cloud_ids_by_interface_addresses;
+
+    //  With assume_one_lan, maps each VLAN ID to its one network's ID.
+    FlatHashMap<uint32_t, long> lan_network_ids;
+
+    //  Packets seen in each VLAN.  Untagged frames aren't counted.
+    struct VLAN {
+        long packet_count = 0;
+        long byte_count = 0;
+        long reported_packet_count = 0;  // Counts as of the last traffic update.
+        long reported_byte_count = 0;
+        Rate rate;
+        bool dirty = false;  // Counts or rates changed since the last traffic update.
+    };
+    std::vector<VLAN> vlans = std::vector<VLAN>(4096);  //  Indexed by VLAN ID.
+    std::vector<uint32_t> dirty_vlans;
+
+    //  Indexes of entities that have had packet traffic since the last
+    //  traffic update.  An entity is listed once, when it's marked dirty.
+    std::vector<uint32_t> dirty_interfaces;
+    std::vector<uint32_t> dirty_clouds;
+    std::vector<uint32_t> dirty_ip_addresses;
     long last_traffic_update = 0;
 
-    //  Maps an interface's ID to its address.
-    std::map<long, MacAddress> interfaces_by_id;
-
-    //  Maps IP addresses to an IPAddressInfos.
-    std::map<IPV4Address, IPAddressInfo> ip_addresses;
-
-    //  Maps a cloud's ID to its cloud.
-    std::map<long, Cloud> clouds;
-
-    //  Maps Interface addresses to Cloud IDs of clouds attached to the interface.
-    std::map<MacAddress, long> cloud_ids_by_interface_addresses;
-
-    //  Map OUIs to organization names.
-    std::map<int, std::string> ouis;
-
-    //  Network prefix and ASN table.
-    IPV4PrefixTable prefixes;
-
-    //  //  Maps ASNs to owner names.
-    //  Maps ASNs to owner names.
-    std::map<uint32_t, std::string> asns;
+    //  Indexes of entities, and VLAN IDs, whose rates are being updated.
+    //  An entity is listed from its first packet until its rates decay
+    //  below min_packet_rate, so quiet entities cost nothing.
+    std::vector<uint32_t> rated_interfaces;
+    std::vector<uint32_t> rated_clouds;
+    std::vector<uint32_t> rated_ip_addresses;
+    std::vector<uint32_t> rated_vlans;
+    long last_rate_update = 0;
+    static constexpr long rate_interval = 100 * 1000000L;  //  Nanoseconds.
+    static constexpr double rate_time_constant = 1e9;     //  Nanoseconds.
+    static constexpr double min_packet_rate = 0.05;       //  Per second.
+    //  Rates are reported when they've moved by more than this fraction
+    //  since they were last reported, so steady ones aren't sent over and over.
+    static constexpr double rate_report_change = 0.25;
+
+    //  Indexes of resolvers changed since the last resolver update.
+    std::vector<uint32_t> dirty_resolvers;
+    long last_resolver_update = 0;
+
+    //  Connections, in slots reused once they're closed.  There may be
+    //  millions over time, so unlike the entities above they're forgotten
+    //  when they end, and their IDs are a sequence of their own.
+    struct Connection {
+        long id = 0;  //  0 iff the slot is free.
+        long ip_address_a_id;  //  The end that opened it.  0 if the address isn't known.
+        long ip_address_b_id;
+        std::array<long, 2> packet_counts;  //  From a, from b.
+        std::array<long, 2> byte_counts;    //  Payload bytes, likewise.
+        uint16_t a_port;
+        uint16_t b_port;
+        ConnectionProtocol protocol;
+        ConnectionEnd end;
+        bool established;
+        bool dirty;  //  Counts changed since the last traffic update.
+    };
+    std::vector<Connection> connections;
+    std::vector<uint32_t> free_connections;
+    std::vector<uint32_t> dirty_connections;  //  May list a slot twice, or one since freed.
+    long next_connection_id = 1;
+
+    //  Returns the resolver at an IP address, making it if need be, or
+    //  nullptr if the address isn't known.
+    Resolver* find_resolver(const IPAddress& address, uint16_t vlan);
+
+    //  List the entity at :index: in :dirty: for the next traffic update.
+    template<class Entity>
+    static void mark_dirty(Entity& entity, uint32_t index, std::vector<uint32_t>& dirty) {
+        if (!entity.dirty) {
+            entity.dirty = true;
+            dirty.push_back(index);
+        }
+    }
+
+    //  Count :packets: packets of :bytes: in all to or from the entity at
+    //  :index:, listing it in :dirty: for the next traffic update and in
+    //  :rated: for rate updates.
+    template<class Entity>
+    static void count_packets(Entity& entity, uint32_t index, unsigned packets, unsigned long bytes,
+                              std::vector<uint32_t>& dirty, std::vector<uint32_t>& rated) {
+        entity.packet_count += packets;
+        entity.byte_count += bytes;
+        mark_dirty(entity, index, dirty);
+        if (!entity.rate.active) {
+            entity.rate.active = true;
+            rated.push_back(index);
+        }
+    }
+
+    //  Bring the rates of the :rated: entities up to date, :seconds: since
+    //  the last update, the old averages weighted by :decay:.  Entities
+    //  whose rates have decayed away are zeroed and unlisted.
+    template<class Entity>
+    static void update_rates(std::vector<Entity>& entities, std::vector<uint32_t>& rated,
+                             std::vector<uint32_t>& dirty, double seconds, double decay);
+    void update_rates();
+
+    //  OUI makers, network prefixes and ASN owners.  Only the packet path
+    //  touches :reference:.  New tables are handed over through
+    //  :next_reference: and the old ones handed back through
+    //  :retired_reference:, both accessed with std::atomic_*().
+    std::shared_ptr<const ReferenceDB> reference { std::make_shared<ReferenceDB>() };
+    std::shared_ptr<const ReferenceDB> next_reference;
+    std::shared_ptr<const ReferenceDB> retired_reference;
+    std::atomic<bool> reference_changed { false };
+
+    //  Re-annotation after a table change.  Entities before these indexes are done.
+    bool refreshing = false;
+    uint32_t refresh_interfaces_index = 0;
+    uint32_t refresh_ip_addresses_index = 0;
+    static constexpr uint32_t refresh_batch = 64;
+
+    void adopt_reference();
+    //  Re-annotate up to refresh_batch entities.
+    void refresh_reference();
+    //  Set an entity's annotations from :reference:.  Returns whether they changed.
+    bool annotate(Interface&);
+    bool annotate(IPAddressInfo&);
 
     struct NameEntry {
         std::string name;
         NameType type;
-
-        bool operator <(const NameEntry& rhs) const {
-            if (name == rhs.name)
-                return type < rhs.type;
-            return name < rhs.name;
-        }
-        bool operator ==(const NameEntry& rhs) const {
-            return name == rhs.name && type == rhs.type;
-        }
     };
-    std::map<IPV4Address, std::set<NameEntry>> ipv4_address_names;
-
-
-    long new_network();
-
-    std::map<MacAddress, Interface>::iterator new_interface(const MacAddress& address, long network_id);
-    IPAddressInfo& new_ip_address(const IPV4Address& address, long interface_id);
-    IPAddressInfo& new_ip_address(const IPV4Address& address, Cloud& cloud);
+    //  Orders NameEntrys by name, then type.  Also compares them with
+    //  (name, type) pairs, so looking one up needn't copy the name.
+    struct NameEntryLess {
+        using is_transparent = void;
+        using Key = std::pair<std::string_view, NameType>;
+        static Key key(const NameEntry& e) { return Key(e.name, e.type); }
+        static const Key& key(const Key& k) { return k; }
+        template<class A, class B> bool operator ()(const A& a, const B& b) const { return key(a) < key(b); }
+    };
+    using NameSet = std::set<NameEntry, NameEntryLess>;
+    FlatHashMap<uint32_t, NameSet> ipv4_address_names;
+    FlatHashMap<uint128_t, NameSet> ipv6_address_names;
+
+    //  Add a name to :names:, and to the IP address at :ip_ix:, if any.
+    void add_name(NameSet& names, const uint32_t* ip_ix, std::string_view name, NameType type);
+
+
+    //  Returns a new ID for an entity at :index: in its type's vector.
+    long new_id(uint32_t index = 0);
+
+    static constexpr uint32_t no_index = UINT32_MAX;
+    uint32_t find_interface(const MacAddress& address, uint16_t vlan) const;
+
+    long new_network(uint16_t vlan);
+    //  Returns the network for an interface new to VLAN :vlan:.
+    long network_for_new_interface(uint16_t vlan);
+
+    //  Returns the ID of the network that network :id: has been merged into,
+    //  or :id: if it hasn't been.
+    long find_network(long id);
+    //  Returns the interface's current network ID.
+    long network_of(Interface& interface);
+
+    //  Returns the new interface's index.
+    uint32_t new_interface(const MacAddress& address, uint16_t vlan, long network_id);
+    //  Make an IP address in :interface:'s VLAN, attached to it.
+    IPAddressInfo& new_ip_address(const IPV4Address& address, const Interface& interface);
+    //  Make an IP address in VLAN :vlan:, in :cloud:.
+    IPAddressInfo& new_ip_address(const IPAddress& address, uint16_t vlan, Cloud& cloud);
+    //  Make an IP address seen through an interface, in the interface's cloud.
+    IPAddressInfo& new_ip_address(const IPAddress& address, const MacAddress& mac, uint16_t vlan);
+    //  Count packets to or from an IP address, and its clouds.
+    void count_ip_packets(IPAddressInfo&, unsigned packets, unsigned long bytes);
     Cloud& new_cloud(const Interface&, const std::string& description = "IP cloud");
-    Cloud& new_cloud(Cloud&, const std::string& description = "cloud-attached");
+    //  Invalidates references to other clouds, including the parent.
+    Cloud& new_cloud(Cloud& parent, const std::string& description = "cloud-attached");
+
+    //  Returns the ID of the cloud an IP address in cloud :cloud_id: belongs
+    //  in: the subcloud named after its ASN owner, if known, made if need be.
+    long as_cloud_id(long cloud_id, const IPAddressInfo&);
 
-    //  Merge two networks.
+    //  Merge two unmerged networks, folding the smaller into the larger.
     void merge_networks(long a_id, long b_id);
 
     void emit(const Network&, bool fini = false);
     void emit(const Interface&, bool fini = false);
     void emit(const IPAddressInfo&, bool fini = false);
     void emit_traffic_update();
+    void fill_traffic_maps(Lansnoop::Traffic&);
+    void fill_traffic_deltas(Lansnoop::Traffic&);
     void emit(const Cloud&, bool fini = false);
+    void emit(const Resolver&, bool fini = false);
+    void emit(const Connection&, bool fini = false);
+    void emit_resolver_updates();
 };
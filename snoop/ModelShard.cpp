@@ -0,0 +1,300 @@
+#include "ModelShard.hpp"
+
+#include <mutex>
+
+
+Model::Shard::Op& Model::Shard::add(Op::Type type, uint16_t vlan)
+{
+    Op& op = this->ops.emplace_back();
+    op.type = type;
+    op.vlan = vlan;
+    return op;
+}
+
+
+void Model::Shard::batch_time(long t)
+{
+    //  Only the latest time since the last call matters.
+    if (this->ops.size() && this->ops.back().type == Op::Type::TIME)
+        this->ops.back().nanoseconds = t;
+    else
+        add(Op::Type::TIME, 0).nanoseconds = t;
+}
+
+
+void Model::Shard::batch_l2(const MacAddress& source_address, const MacAddress& destination_address,
+                            unsigned bytes, uint16_t vlan)
+{
+    uint128_t key = l2_key(source_address, destination_address, vlan);
+    if (const InterfacePair* pair = this->known_interface_pairs.find(key)) {
+        count(this->interface_counts, pair->source_ix, bytes);
+        count(this->interface_counts, pair->destination_ix, bytes);
+        if (vlan)
+            count(this->vlan_counts, vlan, bytes);
+        return;
+    }
+    if (const uint32_t* ix = this->l2_ops.find(key)) {
+        Op& op = this->ops[*ix];
+        ++op.packets;
+        op.bytes += bytes;
+        return;
+    }
+    this->l2_ops[key] = this->ops.size();
+    Op& op = add(Op::Type::L2, vlan);
+    op.mac_a = source_address;
+    op.mac_b = destination_address;
+    op.packets = 1;
+    op.bytes = bytes;
+}
+
+
+void Model::Shard::batch_ip(const IPAddress& ip, const MacAddress& mac, unsigned bytes, uint16_t vlan)
+{
+    if (mac[0] & 0x01)
+        return;  // Multicast address.  The Model ignores these.
+
+    //  Once the first call has made the address, the Model ignores
+    //  the interface, so the rest needn't match it.
+    IPAddressKey key = ip_address_key(ip, vlan);
+    if (const uint32_t* ix = this->known_ip_addresses.find(key)) {
+        count(this->ip_address_counts, *ix, bytes);
+        return;
+    }
+    if (const uint32_t* ix = this->ip_ops.find(key)) {
+        Op& op = this->ops[*ix];
+        ++op.packets;
+        op.bytes += bytes;
+        return;
+    }
+    this->ip_ops[key] = this->ops.size();
+    Op& op = add(Op::Type::IP, vlan);
+    op.ip_a = ip;
+    op.mac_a = mac;
+    op.packets = 1;
+    op.bytes = bytes;
+}
+
+
+void Model::Shard::note_arp(const MacAddress& mac_address, const IPV4Address& ip_address, uint16_t vlan)
+{
+    if (!this->batching) {
+        this->model.note_arp(mac_address, ip_address, vlan);
+        return;
+    }
+    Op& op = add(Op::Type::ARP, vlan);
+    op.mac_a = mac_address;
+    op.ip_a = ip_address;
+
+    //  The reply may move the address out of its cloud.  Packets counted
+    //  so far are merged before it, to the old cloud.  Make later ones
+    //  their own call, after it.
+    IPAddressKey key = ip_address_key(ip_address, vlan);
+    this->ip_ops.erase(key);
+    this->known_ip_addresses.erase(key);
+}
+
+
+void Model::Shard::note_name(const IPV4Address& address, std::string_view name, NameType type, uint16_t vlan)
+{
+    if (!this->batching) {
+        this->model.note_name(address, name, type, vlan);
+        return;
+    }
+    Op& op = add(Op::Type::NAME, vlan);
+    op.ip_a = address;
+    op.name_offset = this->names.size();
+    op.name_length = name.size();
+    op.name_type = type;
+    this->names.append(name);
+}
+
+
+void Model::Shard::note_name(const IPV6Address& address, std::string_view name, NameType type, uint16_t vlan)
+{
+    if (!this->batching) {
+        this->model.note_name(address, name, type, vlan);
+        return;
+    }
+    Op& op = add(Op::Type::NAME, vlan);
+    op.ip_a = address;
+    op.name_offset = this->names.size();
+    op.name_length = name.size();
+    op.name_type = type;
+    this->names.append(name);
+}
+
+
+uint32_t Model::Shard::open_connection(ConnectionProtocol protocol,
+                                       const IPAddress& a, uint16_t a_port,
+                                       const IPAddress& b, uint16_t b_port, uint16_t vlan)
+{
+    if (!this->batching)
+        return this->model.open_connection(protocol, a, a_port, b, b_port, vlan);
+
+    uint32_t handle;
+    if (this->free_handles.size()) {
+        handle = this->free_handles.back();
+        this->free_handles.pop_back();
+    }
+    else {
+        handle = this->connections.size();
+        this->connections.push_back(0);
+    }
+    Op& op = add(Op::Type::OPEN, vlan);
+    op.protocol = protocol;
+    op.ip_a = a;
+    op.a_port = a_port;
+    op.ip_b = b;
+    op.b_port = b_port;
+    op.connection = handle;
+    return handle;
+}
+
+
+void Model::Shard::batch_connection_packet(uint32_t connection, int from_b, unsigned bytes)
+{
+    uint64_t key = uint64_t(connection) << 1 | (from_b ? 1 : 0);
+    if (const uint32_t* ix = this->connection_ops.find(key)) {
+        Op& op = this->ops[*ix];
+        ++op.packets;
+        op.bytes += bytes;
+        return;
+    }
+    this->connection_ops[key] = this->ops.size();
+    Op& op = add(Op::Type::CONNECTION, 0);
+    op.connection = connection;
+    op.from_b = from_b ? 1 : 0;
+    op.packets = 1;
+    op.bytes = bytes;
+}
+
+
+void Model::Shard::close_connection(uint32_t connection, ConnectionEnd end, bool established)
+{
+    if (!this->batching) {
+        this->model.close_connection(connection, end, established);
+        return;
+    }
+    Op& op = add(Op::Type::CLOSE, 0);
+    op.connection = connection;
+    op.end = end;
+    op.established = established;
+    //  Not reused until merged, so this batch's calls for it stay apart
+    //  from the next connection's.
+    this->closed_handles.push_back(connection);
+}
+
+
+void Model::Shard::note_dns_response(const IPAddress& resolver, long latency, uint16_t vlan)
+{
+    if (!this->batching) {
+        this->model.note_dns_response(resolver, latency, vlan);
+        return;
+    }
+    Op& op = add(Op::Type::DNS_RESPONSE, vlan);
+    op.ip_a = resolver;
+    op.nanoseconds = latency;
+}
+
+
+void Model::Shard::note_dns_timeout(const IPAddress& resolver, uint16_t vlan)
+{
+    if (!this->batching) {
+        this->model.note_dns_timeout(resolver, vlan);
+        return;
+    }
+    add(Op::Type::DNS_TIMEOUT, vlan).ip_a = resolver;
+}
+
+
+void Model::Shard::merge()
+{
+    if (this->ops.empty() && !this->packets)
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(this->model.mutex);
+        Model& model = this->model;
+        model.packet_count += this->packets;
+        this->interface_counts.for_each([&model](uint32_t ix, const Counts& c) {
+            count_packets(model.interfaces[ix], ix, c.packets, c.bytes, model.dirty_interfaces, model.rated_interfaces);
+        });
+        this->ip_address_counts.for_each([&model](uint32_t ix, const Counts& c) {
+            model.count_ip_packets(model.ip_addresses[ix], c.packets, c.bytes);
+        });
+        this->vlan_counts.for_each([&model](uint32_t vlan, const Counts& c) {
+            count_packets(model.vlans[vlan], vlan, c.packets, c.bytes, model.dirty_vlans, model.rated_vlans);
+        });
+        for (const Op& op : this->ops)
+            apply(op);
+    }
+
+    this->ops.clear();
+    this->names.clear();
+    this->packets = 0;
+    this->l2_ops.clear();
+    this->ip_ops.clear();
+    this->connection_ops.clear();
+    this->interface_counts.clear();
+    this->ip_address_counts.clear();
+    this->vlan_counts.clear();
+    this->free_handles.insert(this->free_handles.end(), this->closed_handles.begin(), this->closed_handles.end());
+    this->closed_handles.clear();
+}
+
+
+void Model::Shard::apply(const Op& op)
+{
+    Model& model = this->model;
+    switch (op.type) {
+    case Op::Type::TIME:
+        model.note_time(op.nanoseconds);
+        break;
+    case Op::Type::L2:
+        model.note_l2_packet_traffic(op.mac_a, op.mac_b, op.bytes, op.vlan, op.packets);
+        if (!(op.mac_b[0] & 0x01)) {
+            if (this->known_interface_pairs.size() >= known_limit)
+                this->known_interface_pairs.clear();
+            this->known_interface_pairs[l2_key(op.mac_a, op.mac_b, op.vlan)] = InterfacePair {
+                model.find_interface(op.mac_a, op.vlan), model.find_interface(op.mac_b, op.vlan) };
+        }
+        break;
+    case Op::Type::IP: {
+        if (op.ip_a.is_ipv6())
+            model.note_ip_through_interface(op.ip_a.ipv6(), op.mac_a, op.bytes, op.vlan, op.packets);
+        else
+            model.note_ip_through_interface(op.ip_a.ipv4(), op.mac_a, op.bytes, op.vlan, op.packets);
+        if (this->known_ip_addresses.size() >= known_limit)
+            this->known_ip_addresses.clear();
+        this->known_ip_addresses[ip_address_key(op.ip_a, op.vlan)] = *model.find_ip_address(op.ip_a, op.vlan);
+        break;
+    }
+    case Op::Type::ARP:
+        model.note_arp(op.mac_a, op.ip_a.ipv4(), op.vlan);
+        break;
+    case Op::Type::NAME: {
+        std::string_view name(this->names.data() + op.name_offset, op.name_length);
+        if (op.ip_a.is_ipv6())
+            model.note_name(op.ip_a.ipv6(), name, op.name_type, op.vlan);
+        else
+            model.note_name(op.ip_a.ipv4(), name, op.name_type, op.vlan);
+        break;
+    }
+    case Op::Type::OPEN:
+        this->connections[op.connection] = model.open_connection(op.protocol, op.ip_a, op.a_port,
+                                                                 op.ip_b, op.b_port, op.vlan);
+        break;
+    case Op::Type::CONNECTION:
+        model.note_connection_packet(this->connections[op.connection], op.from_b, op.bytes, op.packets);
+        break;
+    case Op::Type::CLOSE:
+        model.close_connection(this->connections[op.connection], op.end, op.established);
+        break;
+    case Op::Type::DNS_RESPONSE:
+        model.note_dns_response(op.ip_a, op.nanoseconds, op.vlan);
+        break;
+    case Op::Type::DNS_TIMEOUT:
+        model.note_dns_timeout(op.ip_a, op.vlan);
+        break;
+    }
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "FlatHashMap.hpp"
+#include "Model.hpp"
+#include "util.hpp"
+
+
+//  One thread's way into a Model it may share with others.
+//
+//  A Shard has the note_*() methods a Snoop calls.  Unless it's batching
+//  it passes them straight to the Model.  A batching Shard records them
+//  instead, and merge() applies the batch with the Model's mutex held,
+//  so threads sharing the Model take the lock once per batch rather than
+//  several times a packet.
+//
+//  Most packets are between interfaces and IP addresses the Model already
+//  has.  The Shard remembers the Model's indexes for those it has merged,
+//  and counts their packets itself, by index, so that merge() just adds
+//  the counts to the Model's.  Packets to or from anything else are
+//  added to the counts of its first call in the batch, so the Model does
+//  one call's work for each, and calls that make new entities keep their
+//  order.
+//
+//  A batching Shard's connection handles are its own, mapped to the
+//  Model's as the batch opening them is merged.
+//
+class Model::Shard
+{
+public:
+    explicit Shard(Model& model, bool batching = false) : model(model), batching(batching) {}
+
+    void note_time(long t) {
+        if (this->batching)
+            batch_time(t);
+        else
+            this->model.note_time(t);
+    }
+    void note_packet() {
+        if (this->batching)
+            ++this->packets;
+        else
+            this->model.note_packet();
+    }
+    void note_l2_packet_traffic(const MacAddress& source_address,
+                                const MacAddress& destination_address,
+                                unsigned bytes, uint16_t vlan = 0) {
+        if (this->batching)
+            batch_l2(source_address, destination_address, bytes, vlan);
+        else
+            this->model.note_l2_packet_traffic(source_address, destination_address, bytes, vlan);
+    }
+    void note_ip_through_interface(const IPV4Address& ip, const MacAddress& mac, unsigned bytes, uint16_t vlan = 0) {
+        if (this->batching)
+            batch_ip(ip, mac, bytes, vlan);
+        else
+            this->model.note_ip_through_interface(ip, mac, bytes, vlan);
+    }
+    void note_ip_through_interface(const IPV6Address& ip, const MacAddress& mac, unsigned bytes, uint16_t vlan = 0) {
+        if (this->batching)
+            batch_ip(ip, mac, bytes, vlan);
+        else
+            this->model.note_ip_through_interface(ip, mac, bytes, vlan);
+    }
+    void note_arp(const MacAddress& mac_address, const IPV4Address& ip_address, uint16_t vlan = 0);
+    void note_name(const IPV4Address& address, std::string_view name, NameType type, uint16_t vlan = 0);
+    void note_name(const IPV6Address& address, std::string_view name, NameType type, uint16_t vlan = 0);
+    uint32_t open_connection(ConnectionProtocol protocol,
+                             const IPAddress& a, uint16_t a_port,
+                             const IPAddress& b, uint16_t b_port, uint16_t vlan = 0);
+    void note_connection_packet(uint32_t connection, int from_b, unsigned bytes) {
+        if (this->batching)
+            batch_connection_packet(connection, from_b, bytes);
+        else
+            this->model.note_connection_packet(connection, from_b, bytes);
+    }
+    void close_connection(uint32_t connection, ConnectionEnd end, bool established);
+    void note_dns_response(const IPAddress& resolver, long latency, uint16_t vlan = 0);
+    void note_dns_timeout(const IPAddress& resolver, uint16_t vlan = 0);
+
+    //  Apply the calls batched since the last merge to the Model.
+    //  Does nothing unless batching.
+    void merge();
+
+private:
+    Model& model;
+    bool batching;
+
+    //  A batched call.  Which fields are used depends on its type.
+    struct Op {
+        enum class Type : uint8_t {
+            TIME,
+            L2,
+            IP,
+            ARP,
+            NAME,
+            OPEN,
+            CONNECTION,
+            CLOSE,
+            DNS_RESPONSE,
+            DNS_TIMEOUT,
+        };
+        Type type;
+        uint16_t vlan;
+        MacAddress mac_a;        //  L2: the source.  IP and ARP: the interface.
+        MacAddress mac_b;        //  L2: the destination.
+        IPAddress ip_a;          //  OPEN: the opening end.  IP, ARP, NAME and DNS_*: the address.
+        IPAddress ip_b;          //  OPEN: the other end.
+        uint16_t a_port;         //  OPEN.
+        uint16_t b_port;         //  OPEN.
+        uint32_t connection;     //  OPEN, CONNECTION and CLOSE: the Shard's handle.
+        uint8_t from_b;          //  CONNECTION.
+        unsigned packets;        //  L2, IP and CONNECTION.
+        unsigned long bytes;     //  L2, IP and CONNECTION.
+        long nanoseconds;        //  TIME: the time.  DNS_RESPONSE: the latency.
+        uint32_t name_offset;    //  NAME: the name, in :names:.
+        uint32_t name_length;
+        NameType name_type;      //  NAME.
+        ConnectionProtocol protocol;  //  OPEN.
+        ConnectionEnd end;       //  CLOSE.
+        bool established;        //  CLOSE.
+    };
+    std::vector<Op> ops;
+    std::string names;  //  The NAME calls' names, end to end.
+    long packets = 0;
+
+    //  Indexes in :ops: of the calls counting packets, by what they count.
+    FlatHashMap<uint128_t, uint32_t> l2_ops;       //  By l2_key().
+    FlatHashMap<IPAddressKey, uint32_t> ip_ops;    //  By address and VLAN ID.
+    FlatHashMap<uint64_t, uint32_t> connection_ops;  //  By handle and direction.
+
+    //  The Model's indexes for the interface pairs and IP addresses merged
+    //  so far, keyed as above.  Unicast pairs only: once a pair's call is
+    //  merged both interfaces exist, in one network, and later packets
+    //  between them change nothing but counts.  Forgotten when they grow
+    //  past known_limit, to be relearned.
+    struct InterfacePair {
+        uint32_t source_ix;
+        uint32_t destination_ix;
+    };
+    FlatHashMap<uint128_t, InterfacePair> known_interface_pairs;
+    FlatHashMap<IPAddressKey, uint32_t> known_ip_addresses;
+    static constexpr size_t known_limit = 1 << 16;
+
+    //  Packets counted here since the last merge, by Model index or VLAN ID.
+    struct Counts {
+        unsigned packets = 0;
+        unsigned long bytes = 0;
+    };
+    FlatHashMap<uint32_t, Counts> interface_counts;
+    FlatHashMap<uint32_t, Counts> ip_address_counts;
+    FlatHashMap<uint32_t, Counts> vlan_counts;
+
+    static void count(FlatHashMap<uint32_t, Counts>& counts, uint32_t index, unsigned bytes) {
+        Counts& c = counts[index];
+        ++c.packets;
+        c.bytes += bytes;
+    }
+    static uint128_t l2_key(const MacAddress& source_address, const MacAddress& destination_address, uint16_t vlan) {
+        return pack(source_address) | uint128_t(pack(destination_address)) << 48 | uint128_t(vlan) << 96;
+    }
+
+    //  By handle, the Model's connection, once the batch opening it is merged.
+    std::vector<uint32_t> connections;
+    std::vector<uint32_t> free_handles;
+    //  Handles closed in this batch, reused once it's merged.
+    std::vector<uint32_t> closed_handles;
+
+    Op& add(Op::Type type, uint16_t vlan);
+    void batch_time(long t);
+    void batch_l2(const MacAddress& source_address, const MacAddress& destination_address,
+                  unsigned bytes, uint16_t vlan);
+    void batch_ip(const IPAddress& ip, const MacAddress& mac, unsigned bytes, uint16_t vlan);
+    void batch_connection_packet(uint32_t connection, int from_b, unsigned bytes);
+    void apply(const Op& op);
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+//  The open-addressing core shared by FlatHashMap and FlowTable.
+//
+//  Slots live in one flat vector and collide by linear probing, so a
+//  lookup usually touches a single cache line.  Erasure shifts following
+//  slots back rather than leaving tombstones, so probe sequences stay
+//  short.  The capacity is a power of two.  When to grow is left to the
+//  owner, as is the load factor.
+//
+//  Key is an unsigned integer type of up to 128 bits, or a class with
+//  operator== and a uint64_t hash() const.  Growing or erasing may move
+//  slots, invalidating their indexes and references to their values.
+//
+template<class Key, class Value>
+class OpenHashTable
+{
+public:
+    //  :capacity: must be a power of two.
+    explicit OpenHashTable(size_t capacity) : slots(capacity), mask(capacity - 1) {}
+
+    //  Returns the slot holding :key:, or the empty slot where it belongs.
+    size_t slot(const Key& key) const {
+        size_t ix = hash(key) & this->mask;
+        while (this->slots[ix].value && !(this->slots[ix].key == key))
+            ix = (ix + 1) & this->mask;
+        return ix;
+    }
+
+    //  The slot after :ix:, wrapping around.
+    size_t next(size_t ix) const { return (ix + 1) & this->mask; }
+
+    bool used(size_t ix) const { return this->slots[ix].value.has_value(); }
+    const Key& key(size_t ix) const { return this->slots[ix].key; }
+    Value& value(size_t ix) { return *this->slots[ix].value; }
+    const Value& value(size_t ix) const { return *this->slots[ix].value; }
+
+    //  Fill empty slot :ix:, as returned by slot(:key:), constructing its
+    //  value from :args:.
+    template<class... Args>
+    Value& emplace_at(size_t ix, const Key& key, Args&&... args) {
+        Slot& s = this->slots[ix];
+        s.key = key;
+        s.value.emplace(std::forward<Args>(args)...);
+        ++this->count;
+        return *s.value;
+    }
+
+    void erase_at(size_t ix);
+
+    //  Double the capacity.
+    void grow();
+
+    //  Empty every slot, keeping the capacity.
+    void clear();
+
+    size_t size() const { return this->count; }
+    size_t capacity() const { return this->slots.size(); }
+
+    static uint64_t hash(const Key& key) {
+        if constexpr (std::is_class_v<Key>)
+            return key.hash();
+        else {
+            uint64_t h = uint64_t(key);
+            if constexpr (sizeof(Key) > sizeof(uint64_t))
+                h ^= uint64_t(key >> 64) * 0x9e3779b97f4a7c15ULL;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return h;
+        }
+    }
+
+private:
+    struct Slot {
+        Key key {};
+        std::optional<Value> value;  // Empty iff the slot is unused.
+    };
+
+    std::vector<Slot> slots;
+    size_t mask;
+    size_t count = 0;
+};
+
+
+template<class Key, class Value>
+void OpenHashTable<Key, Value>::erase_at(size_t ix)
+{
+    this->slots[ix].value.reset();
+    --this->count;
+
+    //  Shift back following slots that would otherwise become
+    //  unreachable from their home slot.
+    size_t hole = ix;
+    size_t j = ix;
+    for (;;) {
+        j = (j + 1) & this->mask;
+        Slot& s = this->slots[j];
+        if (!s.value)
+            return;
+        size_t home = hash(s.key) & this->mask;
+        bool stays = (hole <= j) ? (hole < home && home <= j) : (hole < home || home <= j);
+        if (!stays) {
+            this->slots[hole].key = s.key;
+            this->slots[hole].value = std::move(s.value);
+            s.value.reset();
+            hole = j;
+        }
+    }
+}
+
+
+template<class Key, class Value>
+void OpenHashTable<Key, Value>::grow()
+{
+    std::vector<Slot> old(2 * this->slots.size());
+    old.swap(this->slots);
+    this->mask = this->slots.size() - 1;
+    for (Slot& s : old)
+        if (s.value) {
+            Slot& moved = this->slots[slot(s.key)];
+            moved.key = s.key;
+            moved.value = std::move(s.value);
+        }
+}
+
+
+template<class Key, class Value>
+void OpenHashTable<Key, Value>::clear()
+{
+    if (!this->count)
+        return;
+    for (Slot& s : this->slots)
+        s.value.reset();
+    this->count = 0;
+}
@@ -0,0 +1,76 @@
+#include "PacketQueue.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+
+PacketQueue::PacketQueue(size_t bytes)
+{
+    if (bytes < 64 * 1024)
+        throw std::invalid_argument("PacketQueue: queue must be at least 64KB");
+    size_t size = 1;
+    while (size < bytes)
+        size <<= 1;
+    this->ring.reset(new unsigned char[size]);
+    this->mask = size - 1;
+}
+
+
+bool PacketQueue::push(const timeval& ts, const unsigned char* frame, unsigned length, unsigned wire_length, bool wait)
+{
+    if (!frame)
+        length = 0;
+    //  A record must never fill the whole ring.
+    if (length > this->capacity() / 4) {
+        length = this->capacity() / 4;
+        this->truncation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    size_t size = (sizeof(Record) + length + alignment - 1) & ~(alignment - 1);
+
+    //  Records don't wrap around the end of the ring.  Pad out to the end if necessary.
+    size_t head = this->head.load(std::memory_order_relaxed);
+    size_t contiguous = this->capacity() - (head & this->mask);
+    size_t pad = size > contiguous ? contiguous : 0;
+
+    size_t tail = this->tail.load(std::memory_order_acquire);
+    while (this->capacity() - (head - tail) < pad + size) {
+        if (!wait) {
+            this->drop_count.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        std::this_thread::yield();
+        tail = this->tail.load(std::memory_order_acquire);
+    }
+
+    if (pad) {
+        Record* record = at(head);
+        record->size = pad;
+        record->type = Record::PAD;
+        head += pad;
+    }
+
+    Record* record = at(head);
+    record->ts = ts;
+    record->length = length;
+    record->wire_length = wire_length;
+    record->size = size;
+    record->type = frame ? Record::FRAME : Record::TICK;
+    if (frame)
+        memcpy(record + 1, frame, length);
+    head += size;
+    this->head.store(head, std::memory_order_release);
+
+    size_t occupancy = head - tail;
+    if (occupancy > this->high_water_mark.load(std::memory_order_relaxed))
+        this->high_water_mark.store(occupancy, std::memory_order_relaxed);
+    return true;
+}
+
+
+size_t PacketQueue::occupancy() const
+{
+    size_t tail = this->tail.load(std::memory_order_acquire);
+    size_t head = this->head.load(std::memory_order_acquire);
+    return head - tail;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <sys/time.h>
+
+
+//  A lock-free single-producer, single-consumer queue of captured frames.
+//  Frames are copied into a preallocated byte ring as variable-length
+//  records, so neither side allocates or waits on the other.  One capture
+//  thread pushes, one parse thread drains.
+//
+class PacketQueue
+{
+public:
+    struct Record {
+        timeval ts;
+        unsigned length;   // Frame bytes following this header.
+        unsigned wire_length;  // Frame bytes on the wire, of which :length: were captured.
+        unsigned size;     // Bytes this record occupies in the ring, including padding.
+        enum Type : unsigned { FRAME, TICK, PAD } type;
+
+        const unsigned char* frame() const { return reinterpret_cast<const unsigned char*>(this + 1); }
+    };
+
+    //  :bytes: is rounded up to a power of two.
+    explicit PacketQueue(size_t bytes);
+
+    //  Producer side.
+    //  Copy a frame into the queue, :length: bytes captured of :wire_length:.
+    //  Frames longer than a quarter of the capacity are truncated to fit,
+    //  and counted.  A null frame queues a tick noting that time has passed.
+    //  If the queue is full, either drop the frame and return false, or,
+    //  if :wait: is set, wait for the consumer to make room.
+    bool push(const timeval& ts, const unsigned char* frame, unsigned length, unsigned wire_length, bool wait = false);
+    //  Tell the consumer nothing more will be pushed.
+    void close() { this->closed.store(true, std::memory_order_release); }
+
+    //  Consumer side.
+    //  Call f(const Record&) for up to :max: queued frames and ticks.  Returns the number drained.
+    template<class F> size_t drain(size_t max, F&& f);
+    bool is_closed() const { return this->closed.load(std::memory_order_acquire); }
+
+    size_t capacity() const { return this->mask + 1; }
+    size_t occupancy() const;  // In bytes.
+    size_t high_water() const { return this->high_water_mark.load(std::memory_order_relaxed); }
+    long drops() const { return this->drop_count.load(std::memory_order_relaxed); }
+    long truncations() const { return this->truncation_count.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t alignment = 64;
+
+    std::unique_ptr<unsigned char[]> ring;
+    size_t mask;
+
+    //  Keep the producer's and consumer's offsets on separate cache lines.
+    //  Both only ever increase.
+    alignas(64) std::atomic<size_t> head { 0 };  // Written only by the producer.
+    alignas(64) std::atomic<size_t> tail { 0 };  // Written only by the consumer.
+    alignas(64) std::atomic<size_t> high_water_mark { 0 };
+    std::atomic<long> drop_count { 0 };
+    std::atomic<long> truncation_count { 0 };
+    std::atomic<bool> closed { false };
+
+    Record* at(size_t offset) { return reinterpret_cast<Record*>(this->ring.get() + (offset & this->mask)); }
+};
+
+
+template<class F> size_t PacketQueue::drain(size_t max, F&& f)
+{
+    size_t tail = this->tail.load(std::memory_order_relaxed);
+    size_t head = this->head.load(std::memory_order_acquire);
+    size_t n = 0;
+    while (tail != head && n < max) {
+        const Record* record = at(tail);
+        if (record->type != Record::PAD) {
+            f(*record);
+            ++n;
+        }
+        tail += record->size;
+    }
+    this->tail.store(tail, std::memory_order_release);
+    return n;
+}
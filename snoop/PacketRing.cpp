@@ -0,0 +1,192 @@
+#include "PacketRing.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <linux/if_packet.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "Snoop.hpp"
+
+
+PacketRing::PacketRing(const std::string& interface, unsigned block_size, unsigned block_count)
+    : block_size(block_size), block_count(block_count)
+{
+    //  The kernel requires blocks to be a multiple of the page size.
+    //  Frames never span blocks, so a block must hold at least one jumbo frame.
+    const unsigned frame_size = 2048;
+    if (block_size < 16384 || block_size % getpagesize())
+        throw std::invalid_argument("ring block size must be a multiple of the page size and at least 16KB");
+    if (block_count < 2)
+        throw std::invalid_argument("ring block count must be at least 2");
+
+    unsigned ifindex = if_nametoindex(interface.c_str());
+    if (!ifindex)
+        throw std::invalid_argument(std::string("unknown interface ") + interface);
+
+    this->fd = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+    if (this->fd < 0)
+        fail("socket()");
+
+    int version = TPACKET_V3;
+    if (setsockopt(this->fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)))
+        fail("setsockopt(PACKET_VERSION)");
+
+    struct tpacket_req3 req;
+    memset(&req, 0, sizeof(req));
+    req.tp_block_size = block_size;
+    req.tp_block_nr = block_count;
+    req.tp_frame_size = frame_size;
+    req.tp_frame_nr = block_size / frame_size * block_count;
+    req.tp_retire_blk_tov = 1; //  Retire a partly filled block after 1 ms, like libpcap's timeout.
+    if (setsockopt(this->fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)))
+        fail("setsockopt(PACKET_RX_RING)");
+
+    this->ring_size = size_t(block_size) * block_count;
+    void* ring = mmap(nullptr, this->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+    if (ring == MAP_FAILED)
+        fail("mmap()");
+    this->ring = static_cast<unsigned char*>(ring);
+
+    struct sockaddr_ll sll;
+    memset(&sll, 0, sizeof(sll));
+    sll.sll_family = AF_PACKET;
+    sll.sll_protocol = htons(ETH_P_ALL);
+    sll.sll_ifindex = ifindex;
+    if (bind(this->fd, reinterpret_cast<struct sockaddr*>(&sll), sizeof(sll)))
+        fail("bind()");
+
+    struct packet_mreq mreq;
+    memset(&mreq, 0, sizeof(mreq));
+    mreq.mr_ifindex = ifindex;
+    mreq.mr_type = PACKET_MR_PROMISC;
+    if (setsockopt(this->fd, SOL_PACKET, PACKET_ADD_MEMBERSHIP, &mreq, sizeof(mreq)))
+        fail("setsockopt(PACKET_ADD_MEMBERSHIP)");
+}
+
+
+PacketRing::~PacketRing()
+{
+    if (this->ring)
+        munmap(this->ring, this->ring_size);
+    if (this->fd >= 0)
+        close(this->fd);
+}
+
+
+void PacketRing::fail(const std::string& what)
+{
+    int error = errno;
+    if (this->ring)
+        munmap(this->ring, this->ring_size);
+    this->ring = nullptr;
+    if (this->fd >= 0)
+        close(this->fd);
+    this->fd = -1;
+    throw std::runtime_error(std::string("PacketRing: ") + what + ": " + strerror(error));
+}
+
+
+void PacketRing::join_fanout(unsigned group_id)
+{
+    //  PACKET_FANOUT_HASH keeps both directions of a flow together.
+    //  The defrag flag reassembles IP fragments before hashing so that
+    //  they all land on the same ring.
+    int fanout = (group_id & 0xffff) | ((PACKET_FANOUT_HASH | PACKET_FANOUT_FLAG_DEFRAG) << 16);
+    if (setsockopt(this->fd, SOL_PACKET, PACKET_FANOUT, &fanout, sizeof(fanout)))
+        fail("setsockopt(PACKET_FANOUT)");
+}
+
+
+void PacketRing::capture(Snoop& snoop)
+{
+    unsigned current = 0;
+    while (!this->done) {
+        tpacket_block_desc* block = reinterpret_cast<tpacket_block_desc*>(this->ring + size_t(current) * this->block_size);
+
+        //  Wait for the kernel to retire the next block to us.
+        //
+        if (!(__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER)) {
+            struct pollfd pfd { this->fd, POLLIN | POLLERR, 0 };
+            int ret = poll(&pfd, 1, 10);
+            if (ret < 0 && errno != EINTR)
+                throw std::runtime_error(std::string("PacketRing: poll(): ") + strerror(errno));
+            if (ret == 0) {
+                //  Notify the packet parser that time has passed.
+                struct timeval now;
+                gettimeofday(&now, NULL);
+                snoop.parse_ethernet(now, NULL, 0);
+                snoop.merge();
+            }
+            continue;
+        }
+
+        walk_block(snoop, block);
+        snoop.merge();
+
+        //  Hand the block back to the kernel.
+        __atomic_store_n(&block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+        current = (current + 1) % this->block_count;
+        this->stats.blocks++;
+    }
+}
+
+
+void PacketRing::walk_block(Snoop& snoop, tpacket_block_desc* block)
+{
+    unsigned char* base = reinterpret_cast<unsigned char*>(block);
+    unsigned count = block->hdr.bh1.num_pkts;
+    const tpacket3_hdr* header = reinterpret_cast<const tpacket3_hdr*>(base + block->hdr.bh1.offset_to_first_pkt);
+    for (unsigned i=0; i<count; ++i) {
+        struct timeval ts;
+        ts.tv_sec = header->tp_sec;
+        ts.tv_usec = header->tp_nsec / 1000;
+        const unsigned char* frame = reinterpret_cast<const unsigned char*>(header) + header->tp_mac;
+        snoop.parse_ethernet(ts, frame, header->tp_snaplen, header->tp_len);
+        header = reinterpret_cast<const tpacket3_hdr*>(reinterpret_cast<const unsigned char*>(header) + header->tp_next_offset);
+    }
+}
+
+
+const PacketRing::Stats& PacketRing::get_stats()
+{
+    //  The kernel resets its counters each time they're read.
+    struct tpacket_stats_v3 kstats;
+    socklen_t length = sizeof(kstats);
+    if (this->fd >= 0 && !getsockopt(this->fd, SOL_PACKET, PACKET_STATISTICS, &kstats, &length)) {
+        this->stats.packets += kstats.tp_packets;
+        this->stats.drops += kstats.tp_drops;
+        this->stats.freezes += kstats.tp_freeze_q_cnt;
+    }
+    return this->stats;
+}
+
+
+PacketRing::Stats& PacketRing::Stats::operator+=(const Stats& rhs)
+{
+    this->packets += rhs.packets;
+    this->drops += rhs.drops;
+    this->freezes += rhs.freezes;
+    this->blocks += rhs.blocks;
+    return *this;
+}
+
+
+std::ostream& operator<<(std::ostream& o, const PacketRing::Stats& stats)
+{
+    o << "Ring stats:\n";
+    o << "    " << std::setw(9) << stats.packets << " packets seen by the kernel\n";
+    o << "    " << std::setw(9) << stats.drops << " packets dropped by the kernel\n";
+    o << "    " << std::setw(9) << stats.freezes << " ring full queue freezes\n";
+    o << "    " << std::setw(9) << stats.blocks << " blocks processed\n";
+    return o;
+}
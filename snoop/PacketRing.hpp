@@ -0,0 +1,63 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <signal.h>
+
+class Snoop;
+struct tpacket_block_desc;
+
+
+//  Captures packets from a network interface through a Linux AF_PACKET
+//  TPACKET_V3 memory-mapped ring.  The kernel fills whole blocks of frames
+//  which are handed to the Snoop in place, without a per-packet copy or
+//  a per-packet system call.
+//
+class PacketRing
+{
+public:
+    struct Stats {
+        long packets = 0;  // Packets seen by the kernel, including drops.
+        long drops = 0;    // Packets the kernel dropped because the ring was full.
+        long freezes = 0;  // Times the kernel found the ring full and froze the queue.
+        long blocks = 0;   // Blocks retired to and processed by us.
+
+        Stats& operator+=(const Stats&);
+    };
+
+    //  Defaults give a 32MB ring, the same as libpcap's buffer in read_interface().
+    static constexpr unsigned default_block_size = 1024 * 1024;
+    static constexpr unsigned default_block_count = 32;
+
+    PacketRing(const std::string& interface, unsigned block_size, unsigned block_count);
+    ~PacketRing();
+    PacketRing(const PacketRing&) = delete;
+    PacketRing& operator=(const PacketRing&) = delete;
+
+    //  Join a PACKET_FANOUT group.  The kernel spreads the interface's
+    //  packets over all rings in the group, keeping each flow on one ring.
+    void join_fanout(unsigned group_id);
+
+    //  Hand packets to the Snoop until break_loop() is called.
+    void capture(Snoop& snoop);
+
+    //  Ask capture() to return.  Safe to call from a signal handler.
+    void break_loop() { this->done = 1; }
+
+    const Stats& get_stats();
+
+private:
+    int fd = -1;
+    unsigned char* ring = nullptr;
+    size_t ring_size = 0;
+    unsigned block_size;
+    unsigned block_count;
+    volatile sig_atomic_t done = 0;
+    Stats stats;
+
+    void walk_block(Snoop& snoop, tpacket_block_desc* block);
+    [[noreturn]] void fail(const std::string& what);
+};
+
+
+std::ostream& operator<<(std::ostream&, const PacketRing::Stats&);
@@ -4,9 +4,15 @@
 
 class Snoop;
 
+
+//  Interprets a session's payloads.  Handlers keep no per-session state,
+//  so each is a singleton shared by every session.
+//
 class Protocol
 {
 public:
     virtual Disposition put(Snoop&, int dir, const unsigned char* payload, int length) = 0;
+
+protected:
     virtual ~Protocol() {};
 };
@@ -1,5 +1,7 @@
 #include <array>
 #include <algorithm>
+#include <cstring>
+#include <string_view>
 #include <arpa/inet.h>
 
 #include "ProtocolDNS.hpp"
@@ -10,18 +12,37 @@
 //  Values for some selected resource record types.
 constexpr int RR_A = 1;
 constexpr int RR_PTR = 12;
+constexpr int RR_AAAA = 28;
 
 
-/*  Parses a sequence of labels into a DNS name appended to :name:.
+//  Longest name we decode, in dotted form without the trailing dot.  RFC-1035
+//  limits names to 255 octets on the wire, which is at most 253 characters.
+constexpr size_t max_name_length = 255;
+
+//  Compression pointers we'll follow in one name, in case they loop.
+constexpr int max_name_pointers = 10;
+
+
+//  A DNS name decoded into a fixed buffer, so that parsing never allocates.
+struct DNSName {
+    char text[max_name_length];
+    size_t length = 0;
+
+    std::string_view view() const { return std::string_view(text, length); }
+};
+
+
+/*  Parses a sequence of labels into the dotted DNS name :name:.
  *  :label: should point to the first label.
  *  :frame: the DNS datagram which may provide compressed data.
  *  :eof: end of frame, one byte past the end of the datagram.
  *  Returns a pointer to the first byte after the name on success.  Nullptr on error.
  */
-const unsigned char* decompress(const unsigned char* label, const unsigned char* frame, const unsigned char* eof, std::string& name, int depth = 0)
+static const unsigned char* decompress(const unsigned char* label, const unsigned char* frame, const unsigned char* eof, DNSName& name)
 {
-    if (depth > 10)
-        return nullptr;
+    name.length = 0;
+    const unsigned char* after = nullptr;  //  Set at the first compression pointer.
+    int pointers = 0;
 
     for (;;) {
         if (label >= eof)
@@ -36,34 +57,40 @@ const unsigned char* decompress(const unsigned char* label, const unsigned char*
             // Uncompressed label.
             case 0b00:
                 if (label_length == 0)
-                    return label; // Zero-length label marks the end of the name.
+                    return after ? after : label; // Zero-length label marks the end of the name.
                 if (label+label_length >= eof)
                     return nullptr; // Error: label spans end of packet.
-                if (name.size())
-                    name.append(".");
-                name.append(reinterpret_cast<const char*>(label), label_length);
+                if (name.length + (name.length != 0) + label_length > max_name_length)
+                    return nullptr;
+                if (name.length)
+                    name.text[name.length++] = '.';
+                memcpy(name.text + name.length, label, label_length);
+                name.length += label_length;
                 label += label_length;
                 break;
 
+            //  Compression pointer.  The rest of the name is elsewhere in the frame.
             case 0b11: {
                 if (label >= eof)
                     return nullptr;
                 int pointer = ((label_length & 0x3f) << 8) | *label++;
                 if (frame+pointer >= eof)
                     return nullptr;
-                if (decompress(frame+pointer, frame, eof, name, depth+1))
-                    return label;
-                else
+                if (++pointers > max_name_pointers)
                     return nullptr;
+                if (!after)
+                    after = label;
+                label = frame + pointer;
+                break;
             }
         }
     }
 }
 
 
-static bool caseless_compare(const std::string& a, const std::string& b)
+static bool caseless_equal(std::string_view a, std::string_view b)
 {
-    return a.size() == a.size() && std::equal(a.begin(), a.end(), a.begin(),
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(),
         [](char a, char b){ return std::tolower(a) == std::tolower(b); }
     );
 }
@@ -73,7 +100,7 @@ static bool caseless_compare(const std::string& a, const std::string& b)
  *  Parse a name like "41.2.168.192.in-addr.arpa" and set :address:.
  *  Returns true on success.
  */
-static bool parse_ptr_address(const std::string& name, IPV4Address& address)
+static bool parse_ptr_address(std::string_view name, IPV4Address& address)
 {
     size_t pos = 0;
     for (int o=3; o>=0; --o) {
@@ -91,7 +118,37 @@ static bool parse_ptr_address(const std::string& name, IPV4Address& address)
                 return false;
         }
     }
-    return caseless_compare(name.substr(pos), "in-addr.arpa");
+    return caseless_equal(name.substr(pos), "in-addr.arpa");
+}
+
+
+/*
+ *  Parse a name like "b.a.9.8.7.6.5.0.4.0.0.0.3.0.0.0.2.0.0.0.1.0.0.0.0.0.0.0.1.2.3.4.ip6.arpa",
+ *  the address's 32 hex digits in reverse, and set :address:.
+ *  Returns true on success.
+ */
+static bool parse_ptr_address(std::string_view name, IPV6Address& address)
+{
+    if (name.size() < 64)
+        return false;
+    for (int n=0; n<32; ++n) {
+        char c = std::tolower(name[2*n]);
+        int digit;
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else
+            return false;
+        if (name[2*n + 1] != '.')
+            return false;
+        int o = 15 - n/2;
+        if (n % 2)
+            address[o] |= digit << 4;
+        else
+            address[o] = digit;
+    }
+    return caseless_equal(name.substr(64), "ip6.arpa");
 }
 
 
@@ -117,6 +174,13 @@ From RFC-1035:
 */
 
 
+ProtocolDNS& ProtocolDNS::instance()
+{
+    static ProtocolDNS dns;
+    return dns;
+}
+
+
 Disposition ProtocolDNS::put(Snoop& snoop, int dir, const unsigned char* payload, int length)
 {
     struct dns_header_st {
@@ -133,8 +197,11 @@ Disposition ProtocolDNS::put(Snoop& snoop, int dir, const unsigned char* payload
 
     uint16_t flags = ntohs(header->flags);
     bool response = (flags & 0x8000) == 0x8000;
-    if (!response)
+    if (!response) {
+        snoop.note_dns_query(ntohs(header->id));
         return Disposition::DNS;
+    }
+    snoop.note_dns_response(ntohs(header->id));
     const unsigned char* ptr = payload + sizeof(dns_header_st);
     const unsigned char* end = payload + length;
 
@@ -168,7 +235,7 @@ Disposition ProtocolDNS::put(Snoop& snoop, int dir, const unsigned char* payload
         for (unsigned rr_ix = 0; rr_ix < rcount; ++rr_ix) {
 
             //  Parse the name field.
-            std::string name;
+            DNSName name;
             ptr = decompress(ptr, payload, payload+length, name);
             if (!ptr)
                 return Disposition::DNS_ERROR;
@@ -217,15 +284,25 @@ Disposition ProtocolDNS::put(Snoop& snoop, int dir, const unsigned char* payload
                     return Disposition::DNS_ERROR;
                 IPV4Address ipaddr;
                 std::copy_n(rdata_start, 4, ipaddr.begin());
-                snoop.get_model().note_name(ipaddr, name, Model::NameType::DNS);
+                snoop.get_model().note_name(ipaddr, name.view(), Model::NameType::DNS, snoop.get_vlan());
+            }
+            if (rclass == 1 && type == RR_AAAA) {
+                if (rdlength != 16) // AAAA record should have a 16-octet IP address.
+                    return Disposition::DNS_ERROR;
+                IPV6Address ipaddr;
+                std::copy_n(rdata_start, 16, ipaddr.begin());
+                snoop.get_model().note_name(ipaddr, name.view(), Model::NameType::DNS, snoop.get_vlan());
             }
             if (rclass == 1 && type == RR_PTR) {
-                std::string ptr_name;
+                DNSName ptr_name;
                 if (!decompress(rdata_start, payload, payload+length, ptr_name))
                     return Disposition::DNS_ERROR;
                 IPV4Address ipaddr;
-                if (parse_ptr_address(name, ipaddr))
-                    snoop.get_model().note_name(ipaddr, ptr_name, Model::NameType::DNS);
+                IPV6Address ipv6addr;
+                if (parse_ptr_address(name.view(), ipaddr))
+                    snoop.get_model().note_name(ipaddr, ptr_name.view(), Model::NameType::DNS, snoop.get_vlan());
+                else if (parse_ptr_address(name.view(), ipv6addr))
+                    snoop.get_model().note_name(ipv6addr, ptr_name.view(), Model::NameType::DNS, snoop.get_vlan());
             }
         }
     }
@@ -1,10 +1,74 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+
 #include "Protocol.hpp"
+#include "util.hpp"
 
+//  Stateless.  All sessions share one instance.
+//
 class ProtocolDNS : public Protocol
 {
 public:
+    static ProtocolDNS& instance();
     Disposition put(Snoop&, int dir, const unsigned char* payload, int length) override;
+
+private:
+    ProtocolDNS() = default;
     ~ProtocolDNS() override {};
 };
+
+
+//  Identifies an outstanding DNS query by its VLAN, its client's and
+//  resolver's addresses and ports and its transaction ID.  For Snoop's
+//  FlowTable.  Both addresses are IPv4, or both IPv6.
+//
+struct DNSQueryKey {
+    uint128_t client_address;   //  Network byte order, zero padded.
+    uint128_t resolver_address;
+    uint16_t client_port;       //  Host byte order.
+    uint16_t resolver_port;
+    uint16_t id;
+    uint16_t vlan;
+    bool ipv6;
+
+    DNSQueryKey() = default;
+
+    DNSQueryKey(const IPAddress& client, uint16_t client_port, const IPAddress& resolver, uint16_t resolver_port,
+                uint16_t id, uint16_t vlan)
+        : client_address(0), resolver_address(0), client_port(client_port), resolver_port(resolver_port),
+          id(id), vlan(vlan), ipv6(resolver.is_ipv6())
+    {
+        memcpy(&client_address, client.data(), client.size());
+        memcpy(&resolver_address, resolver.data(), resolver.size());
+    }
+
+    IPAddress resolver() const {
+        if (ipv6) {
+            IPV6Address address;
+            memcpy(address.data(), &resolver_address, 16);
+            return address;
+        }
+        IPV4Address address;
+        memcpy(address.data(), &resolver_address, 4);
+        return address;
+    }
+
+    bool operator ==(const DNSQueryKey& rhs) const {
+        return client_address == rhs.client_address && resolver_address == rhs.resolver_address
+            && client_port == rhs.client_port && resolver_port == rhs.resolver_port && id == rhs.id
+            && vlan == rhs.vlan && ipv6 == rhs.ipv6;
+    }
+
+    uint64_t hash() const {
+        uint64_t h = uint64_t(client_address) ^ uint64_t(client_address >> 64) * 0xc2b2ae3d27d4eb4fULL;
+        h ^= (uint64_t(resolver_address) ^ uint64_t(resolver_address >> 64) * 0x165667b19e3779f9ULL) * 0xd6e8feb86659fd93ULL;
+        h ^= ((uint64_t(vlan) << 48) | (uint64_t(client_port) << 32) | (uint64_t(resolver_port) << 16) | id)
+             * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 32;
+        h *= 0xd6e8feb86659fd93ULL;
+        h ^= h >> 32;
+        return h;
+    }
+};
@@ -4,11 +4,21 @@
 
 class Snoop;
 
+//  Stateless.  All sessions share one instance.
+//
 class ProtocolDiscard : public Protocol
 {
 public:
+    static ProtocolDiscard& instance()
+    {
+        static ProtocolDiscard discard;
+        return discard;
+    }
+
     Disposition put(Snoop&, int dir, const unsigned char* payload, int length) override
         { return Disposition::L4_PROTOCOL; };
 
+private:
+    ProtocolDiscard() = default;
     ~ProtocolDiscard() override {};
 };
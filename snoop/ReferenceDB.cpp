@@ -0,0 +1,453 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ReferenceDB.hpp"
+
+
+//  Database file layout.  A header, then sections of fixed size records,
+//  each aligned to a cache line.  Everything is in host byte order;
+//  the file is meant to be compiled where it's used.
+//
+namespace {
+    const char db_magic[8] = { 'L', 'S', 'N', 'P', 'R', 'E', 'F', '\0' };
+    constexpr uint32_t db_version = 2;
+    constexpr uint32_t db_byte_order = 0x01020304;
+    constexpr size_t db_alignment = 64;
+
+    struct Section {
+        uint64_t offset;  //  From the start of the file.
+        uint64_t count;   //  Of records.
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        Section ouis;      //  Sorted by OUI.
+        Section asns;      //  Sorted by ASN.
+        Section prefixes;
+        Section tbl24;     //  Empty, or 1<<24 entries.
+        Section tbl8;
+        Section strings;   //  Bytes.
+        Section prefixes6;
+        Section tbl16;     //  Empty, or (1<<16)+1 entries.
+        Section starts6;
+        Section entries6;  //  As many as starts6.
+    };
+}
+
+
+std::shared_ptr<ReferenceDB> ReferenceDB::load(const Sources& sources, bool verbose)
+{
+    auto reference = std::make_shared<ReferenceDB>();
+    if (sources.db_path.size()) {
+        if (sources.oui_path.size() || sources.prefix_paths.size() || sources.prefix6_paths.size() || sources.asn_paths.size())
+            throw std::invalid_argument("a reference database can't be combined with OUI, prefix or ASN files");
+        reference->open(sources.db_path, verbose);
+    }
+
+    if (sources.oui_path.size())
+        reference->load_oui(sources.oui_path, verbose);
+
+    for (const std::string& path : sources.asn_paths)
+        reference->load_asns(path, verbose);
+
+    for (const std::string& path : sources.prefix_paths)
+        reference->load_prefixes(path, verbose);
+
+    for (const std::string& path : sources.prefix6_paths)
+        reference->load_prefixes6(path, verbose);
+
+    return reference;
+}
+
+
+ReferenceDB::~ReferenceDB()
+{
+    unmap();
+}
+
+
+void ReferenceDB::load_oui(const std::string& path, bool verbose)
+{
+    //  This seems to be an ISO-4180 formatted file.
+
+    std::ifstream in(path);
+    if (!in.good())
+        throw std::invalid_argument("unable to open OUI CSV file");
+
+    int count = 0;
+    char line[1024];
+    while (in.getline(line, sizeof(line), '\n')) {
+        if (!count++)
+            continue; // Skip column header line.
+        char* ptr = line;
+
+        //  Discard first column.
+        while (*ptr && *ptr != ',')
+            ptr++;
+        if (*ptr != ',')
+            throw std::invalid_argument("OUI parse error, missing first comma");
+        ptr++;
+
+        //  Second column should contain a 6-digit hex OUI value.
+        int oui = 0;
+        for (int i=0; i<6; ++i) {
+            int digit = tolower(*ptr++);
+            if (digit >= 'a')
+                digit = digit - 'a' + 10;
+            else
+                digit -= '0';
+            oui = (oui << 4) + digit;
+        }
+        if (*ptr++ != ',')
+            throw std::invalid_argument("OUI parse error, expected second comma");
+
+        //  Third column is organization name.
+        bool quoted = (*ptr == '"');
+        if (quoted)
+            ++ptr;
+        char* name_start = ptr;
+        if (quoted) {
+            //  A "" inside the field is a single quote, and not a field delimiter.
+            while (*ptr) {
+                if (ptr[0] == '"' && ptr[1] == '"')
+                    ptr += 2;
+                else if (*ptr == '"')
+                    break;
+                else
+                    ++ptr;
+            }
+            if (*ptr != '"')
+                throw std::invalid_argument("OUI parse error, third column, unmatched quote");
+        }
+        else {
+            while (*ptr && *ptr != ',')
+                ++ptr;
+            if (*ptr != ',')
+                throw std::invalid_argument("OUI parse error, expected third comma");
+        }
+
+        //  Discard the remaining columns.
+
+        this->ouis.push_back(Name { uint32_t(oui), intern(name_start, ptr) });
+    }
+    sort(this->ouis);
+    view_loaded();
+    if (verbose)
+        std::cerr << count << " OUIs loaded from " << path << std::endl;
+}
+
+
+void ReferenceDB::load_prefixes(const std::string& path, bool verbose)
+{
+    this->prefixes.load(path, verbose);
+    view_loaded();
+}
+
+
+void ReferenceDB::load_prefixes6(const std::string& path, bool verbose)
+{
+    this->prefixes6.load(path, verbose);
+    view_loaded();
+}
+
+
+void ReferenceDB::load_asns(const std::string& path, bool verbose)
+{
+    std::ifstream in(path);
+    if (!in.good())
+        throw std::invalid_argument("unable to open ASN file");
+
+    int count = 0;
+    char line[1024];
+    while (in.getline(line, sizeof(line), '\n')) {
+        ++count;
+        char* ptr = line;
+
+        //  Read past leading whitespace.
+        while (*ptr == ' ')
+            ++ptr;
+
+        uint32_t asn = 0;
+        while (*ptr && isdigit(*ptr))
+            asn = asn * 10 + *ptr++ - '0';
+
+        //  Whitespace.
+        while (*ptr == ' ')
+            ++ptr;
+
+        this->asns.push_back(Name { asn, intern(ptr, ptr + strlen(ptr)) });
+    }
+    sort(this->asns);
+    view_loaded();
+    if (verbose)
+        std::cerr << count << " ASNs loaded from " << path << std::endl;
+}
+
+
+uint32_t ReferenceDB::intern(const char* begin, const char* end)
+{
+    auto inserted = this->string_offsets.emplace(std::string(begin, end), this->strings.size());
+    if (inserted.second) {
+        this->strings.insert(this->strings.end(), begin, end);
+        this->strings.push_back('\0');
+        if (this->strings.size() > UINT32_MAX)
+            throw std::length_error("ReferenceDB: too many names");
+    }
+    return inserted.first->second;
+}
+
+
+void ReferenceDB::sort(std::vector<Name>& names)
+{
+    std::stable_sort(names.begin(), names.end());
+
+    //  Later entries replace earlier ones with the same key.
+    auto out = names.begin();
+    for (auto it = names.begin(); it != names.end(); ++it) {
+        if (it + 1 != names.end() && (it + 1)->key == it->key)
+            continue;
+        *out++ = *it;
+    }
+    names.erase(out, names.end());
+}
+
+
+void ReferenceDB::view_loaded()
+{
+    unmap();
+    View& v = this->view;
+    v.ouis = this->ouis.data();
+    v.oui_count = this->ouis.size();
+    v.asns = this->asns.data();
+    v.asn_count = this->asns.size();
+    v.prefixes = this->prefixes.get_prefixes().data();
+    v.tbl24 = this->prefixes.get_tbl24().empty() ? nullptr : this->prefixes.get_tbl24().data();
+    v.tbl8 = this->prefixes.get_tbl8().data();
+    v.prefixes6 = this->prefixes6.get_prefixes().data();
+    v.tbl16 = this->prefixes6.get_tbl16().empty() ? nullptr : this->prefixes6.get_tbl16().data();
+    v.starts6 = this->prefixes6.get_starts().data();
+    v.entries6 = this->prefixes6.get_entries().data();
+    v.strings = this->strings.data();
+}
+
+
+void ReferenceDB::compile(const std::string& path) const
+{
+    Header header {};
+    memcpy(header.magic, db_magic, sizeof(db_magic));
+    header.version = db_version;
+    header.byte_order = db_byte_order;
+
+    //  Lay out the sections.
+    uint64_t offset = sizeof(Header);
+    auto place = [&offset](Section& section, size_t count, size_t size) {
+        offset = (offset + db_alignment - 1) / db_alignment * db_alignment;
+        section.offset = offset;
+        section.count = count;
+        offset += count * size;
+    };
+    place(header.ouis, this->ouis.size(), sizeof(Name));
+    place(header.asns, this->asns.size(), sizeof(Name));
+    place(header.prefixes, this->prefixes.get_prefixes().size(), sizeof(Prefix));
+    place(header.tbl24, this->prefixes.get_tbl24().size(), sizeof(uint32_t));
+    place(header.tbl8, this->prefixes.get_tbl8().size(), sizeof(uint32_t));
+    place(header.strings, this->strings.size(), 1);
+    place(header.prefixes6, this->prefixes6.get_prefixes().size(), sizeof(Prefix6));
+    place(header.tbl16, this->prefixes6.get_tbl16().size(), sizeof(uint32_t));
+    place(header.starts6, this->prefixes6.get_starts().size(), sizeof(uint128_t));
+    place(header.entries6, this->prefixes6.get_entries().size(), sizeof(uint32_t));
+
+    //  Write to a temporary file and rename it into place, so that a
+    //  snoop starting meanwhile never maps a partly written database.
+    std::string temp_path = path + ".tmp";
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::invalid_argument("unable to create reference database file " + temp_path);
+    auto write = [&out](const Section& section, const void* data, size_t size) {
+        static const char padding[db_alignment] = {};
+        out.write(padding, section.offset - out.tellp());
+        out.write(static_cast<const char*>(data), section.count * size);
+    };
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    write(header.ouis, this->ouis.data(), sizeof(Name));
+    write(header.asns, this->asns.data(), sizeof(Name));
+    write(header.prefixes, this->prefixes.get_prefixes().data(), sizeof(Prefix));
+    write(header.tbl24, this->prefixes.get_tbl24().data(), sizeof(uint32_t));
+    write(header.tbl8, this->prefixes.get_tbl8().data(), sizeof(uint32_t));
+    write(header.strings, this->strings.data(), 1);
+    write(header.prefixes6, this->prefixes6.get_prefixes().data(), sizeof(Prefix6));
+    write(header.tbl16, this->prefixes6.get_tbl16().data(), sizeof(uint32_t));
+    write(header.starts6, this->prefixes6.get_starts().data(), sizeof(uint128_t));
+    write(header.entries6, this->prefixes6.get_entries().data(), sizeof(uint32_t));
+    out.close();
+    if (!out)
+        throw std::runtime_error("failed writing reference database file " + temp_path);
+    if (rename(temp_path.c_str(), path.c_str()))
+        throw std::runtime_error("unable to rename " + temp_path + " to " + path + ": " + strerror(errno));
+}
+
+
+void ReferenceDB::open(const std::string& path, bool verbose)
+{
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw std::invalid_argument("unable to open reference database file " + path + ": " + strerror(errno));
+    struct stat st;
+    if (fstat(fd, &st)) {
+        close(fd);
+        throw std::runtime_error("unable to stat reference database file " + path + ": " + strerror(errno));
+    }
+    size_t size = st.st_size;
+    if (size < sizeof(Header)) {
+        close(fd);
+        throw std::invalid_argument("not a reference database file: " + path);
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+        throw std::runtime_error("unable to map reference database file " + path + ": " + strerror(errno));
+    const char* base = static_cast<const char*>(mapping);
+
+    //  Check the header, that the sections lie within the file, and that
+    //  every index in them stays within the sections it indexes.
+    const Header& header = *reinterpret_cast<const Header*>(base);
+    auto check = [size](const Section& section, size_t record_size) {
+        return section.offset % db_alignment == 0 && section.offset <= size
+            && section.count <= (size - section.offset) / record_size;
+    };
+    const char* error = nullptr;
+    if (memcmp(header.magic, db_magic, sizeof(db_magic)))
+        error = "not a reference database file: ";
+    else if (header.version != db_version || header.byte_order != db_byte_order)
+        error = "reference database file is from an incompatible snoop, recompile it: ";
+    else if (!check(header.ouis, sizeof(Name)) || !check(header.asns, sizeof(Name))
+             || !check(header.prefixes, sizeof(Prefix)) || !check(header.tbl24, sizeof(uint32_t))
+             || !check(header.tbl8, sizeof(uint32_t)) || !check(header.strings, 1)
+             || (header.tbl24.count != 0 && header.tbl24.count != 1U << 24)
+             || !check(header.prefixes6, sizeof(Prefix6)) || !check(header.tbl16, sizeof(uint32_t))
+             || !check(header.starts6, sizeof(uint128_t)) || !check(header.entries6, sizeof(uint32_t))
+             || (header.tbl16.count != 0 && (header.tbl16.count != (1U << 16) + 1 || header.starts6.count == 0))
+             || header.entries6.count != header.starts6.count
+             || header.strings.count == 0 || base[header.strings.offset + header.strings.count - 1] != '\0')
+        error = "reference database file is corrupt: ";
+    else {
+        auto names_valid = [base, &header](const Section& section) {
+            const Name* names = reinterpret_cast<const Name*>(base + section.offset);
+            for (size_t i=0; i<section.count; ++i)
+                if (names[i].name >= header.strings.count)
+                    return false;
+            return true;
+        };
+        auto entries = [base](const Section& section) {
+            return reinterpret_cast<const uint32_t*>(base + section.offset);
+        };
+        const uint128_t* starts6 = reinterpret_cast<const uint128_t*>(base + header.starts6.offset);
+        if (!names_valid(header.ouis) || !names_valid(header.asns)
+            || (header.tbl24.count && !IPV4PrefixTable::valid(entries(header.tbl24), entries(header.tbl8),
+                                                               header.tbl8.count, header.prefixes.count))
+            || (header.tbl16.count && !IPV6PrefixTable::valid(entries(header.tbl16), starts6, entries(header.entries6),
+                                                               header.starts6.count, header.prefixes6.count)))
+            error = "reference database file is corrupt: ";
+    }
+    if (error) {
+        munmap(mapping, size);
+        throw std::invalid_argument(error + path);
+    }
+
+    //  Drop anything loaded from text files.
+    unmap();
+    this->ouis.clear();
+    this->asns.clear();
+    this->prefixes = IPV4PrefixTable();
+    this->prefixes6 = IPV6PrefixTable();
+    this->strings.assign(1, '\0');
+    this->string_offsets.clear();
+    this->mapping = mapping;
+    this->mapping_size = size;
+
+    View& v = this->view;
+    v.ouis = reinterpret_cast<const Name*>(base + header.ouis.offset);
+    v.oui_count = header.ouis.count;
+    v.asns = reinterpret_cast<const Name*>(base + header.asns.offset);
+    v.asn_count = header.asns.count;
+    v.prefixes = reinterpret_cast<const Prefix*>(base + header.prefixes.offset);
+    v.tbl24 = header.tbl24.count ? reinterpret_cast<const uint32_t*>(base + header.tbl24.offset) : nullptr;
+    v.tbl8 = reinterpret_cast<const uint32_t*>(base + header.tbl8.offset);
+    v.strings = base + header.strings.offset;
+    v.prefixes6 = reinterpret_cast<const Prefix6*>(base + header.prefixes6.offset);
+    v.tbl16 = header.tbl16.count ? reinterpret_cast<const uint32_t*>(base + header.tbl16.offset) : nullptr;
+    v.starts6 = reinterpret_cast<const uint128_t*>(base + header.starts6.offset);
+    v.entries6 = reinterpret_cast<const uint32_t*>(base + header.entries6.offset);
+
+    if (verbose)
+        std::cerr << header.ouis.count << " OUIs, " << header.prefixes.count << " IPv4 prefixes, "
+                  << header.prefixes6.count << " IPv6 prefixes and "
+                  << header.asns.count << " ASNs mapped from " << path << std::endl;
+}
+
+
+void ReferenceDB::unmap()
+{
+    if (this->mapping)
+        munmap(this->mapping, this->mapping_size);
+    this->mapping = nullptr;
+    this->mapping_size = 0;
+}
+
+
+const char* ReferenceDB::find(const Name* names, size_t count, uint32_t key, const char* strings)
+{
+    const Name* it = std::lower_bound(names, names + count, Name { key, 0 });
+    if (it == names + count || it->key != key)
+        return nullptr;
+    return strings + it->name;
+}
+
+
+const char* ReferenceDB::maker(uint32_t oui) const
+{
+    return find(this->view.ouis, this->view.oui_count, oui, this->view.strings);
+}
+
+
+const char* ReferenceDB::as_name(uint32_t asn) const
+{
+    return find(this->view.asns, this->view.asn_count, asn, this->view.strings);
+}
+
+
+const ReferenceDB::Prefix* ReferenceDB::look_up(uint32_t address) const
+{
+    if (!this->view.tbl24)
+        return nullptr;
+    return IPV4PrefixTable::look_up(this->view.prefixes, this->view.tbl24, this->view.tbl8, address);
+}
+
+
+const ReferenceDB::Prefix* ReferenceDB::look_up(const IPV4Address& address) const
+{
+    uint32_t a = 0;
+    for (int i=0; i<4; ++i)
+        a = (a << 8) | address[i];
+    return look_up(a);
+}
+
+
+const ReferenceDB::Prefix6* ReferenceDB::look_up(const IPV6Address& address) const
+{
+    if (!this->view.tbl16)
+        return nullptr;
+    return IPV6PrefixTable::look_up(this->view.prefixes6, this->view.tbl16, this->view.starts6, this->view.entries6,
+                                    IPV6PrefixTable::to_host(address));
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IPV4PrefixTable.hpp"
+#include "IPV6PrefixTable.hpp"
+
+
+//  The reference data snoop annotates its model with: interface makers by
+//  OUI, and ASNs and their owners by IPv4 and IPv6 prefix.
+//
+//  It's loaded either from the text files (oui.csv, data-raw-table,
+//  ipv6-raw-table and data-used-autnums), or from a single database file written by
+//  compile() from those.  The database is mmap()ed and used in place, so
+//  opening it costs no parsing and no allocation however big the tables.
+//
+//  Both ways end up with the same flat tables: OUIs and ASNs in sorted
+//  arrays, the prefix tables' arrays, and names in a pool of
+//  NUL-terminated strings, each name stored once.
+//
+class ReferenceDB {
+public:
+    using Prefix = IPV4PrefixTable::Prefix;
+    using Prefix6 = IPV6PrefixTable::Prefix;
+
+    //  Where to load the tables from: either text files or a database file.
+    struct Sources {
+        std::string oui_path;
+        std::vector<std::string> prefix_paths;
+        std::vector<std::string> prefix6_paths;
+        std::vector<std::string> asn_paths;
+        std::string db_path;
+
+        bool empty() const {
+            return oui_path.empty() && prefix_paths.empty() && prefix6_paths.empty() && asn_paths.empty() && db_path.empty();
+        }
+    };
+
+    //  Load new tables from :sources:.
+    static std::shared_ptr<ReferenceDB> load(const Sources& sources, bool verbose = false);
+
+    ReferenceDB() = default;
+    ~ReferenceDB();
+    ReferenceDB(const ReferenceDB&) = delete;
+    ReferenceDB& operator=(const ReferenceDB&) = delete;
+
+    //  Load the OUI table from a CSV file.
+    //  Obtain from http://standards-oui.ieee.org/oui/oui.csv
+    void load_oui(const std::string& path, bool verbose = false);
+    void load_prefixes(const std::string& path, bool verbose = false);
+    void load_prefixes6(const std::string& path, bool verbose = false);
+    void load_asns(const std::string& path, bool verbose = false);
+
+    //  Write what's been loaded from text files to a database file.
+    void compile(const std::string& path) const;
+
+    //  Map a database file written by compile(), replacing anything loaded.
+    void open(const std::string& path, bool verbose = false);
+
+    //  Returns the maker of interfaces with this OUI, or nullptr if not known.
+    const char* maker(uint32_t oui) const;
+
+    //  Returns the longest prefix matching a given IP address, or nullptr if not found.
+    const Prefix* look_up(uint32_t address) const;
+    const Prefix* look_up(const IPV4Address&) const;
+    const Prefix6* look_up(const IPV6Address&) const;
+
+    //  Returns the owner of an ASN, or nullptr if not known.
+    const char* as_name(uint32_t asn) const;
+
+private:
+    struct Name {
+        uint32_t key;   //  OUI or ASN.
+        uint32_t name;  //  Offset in the string pool.
+
+        bool operator <(const Name& rhs) const { return key < rhs.key; }
+    };
+
+    //  Tables loaded from text files.
+    std::vector<Name> ouis;
+    std::vector<Name> asns;
+    IPV4PrefixTable prefixes;
+    IPV6PrefixTable prefixes6;
+    std::vector<char> strings { '\0' };  //  Offset 0 is the empty string.
+    std::unordered_map<std::string, uint32_t> string_offsets;
+
+    uint32_t intern(const char* begin, const char* end);
+
+    //  Sort, keeping the last loaded of any duplicate keys.
+    static void sort(std::vector<Name>&);
+
+    //  The tables in use, either those above or those in the mapped file.
+    struct View {
+        const Name* ouis = nullptr;
+        size_t oui_count = 0;
+        const Name* asns = nullptr;
+        size_t asn_count = 0;
+        const Prefix* prefixes = nullptr;
+        const uint32_t* tbl24 = nullptr;  //  nullptr if there are no prefixes.
+        const uint32_t* tbl8 = nullptr;
+        const Prefix6* prefixes6 = nullptr;
+        const uint32_t* tbl16 = nullptr;  //  nullptr if there are no IPv6 prefixes.
+        const uint128_t* starts6 = nullptr;
+        const uint32_t* entries6 = nullptr;
+        const char* strings = nullptr;
+    };
+    View view;
+    void view_loaded();
+
+    void* mapping = nullptr;
+    size_t mapping_size = 0;
+    void unmap();
+
+    static const char* find(const Name* names, size_t count, uint32_t key, const char* strings);
+};
@@ -0,0 +1,51 @@
+#include <cerrno>
+#include <ctime>
+#include <iostream>
+
+#include <signal.h>
+
+#include "ReferenceReloader.hpp"
+
+
+ReferenceReloader::ReferenceReloader(Model& model, const ReferenceDB::Sources& sources, bool verbose)
+    : model(model), sources(sources), verbose(verbose)
+{
+    sigset_t hup;
+    sigemptyset(&hup);
+    sigaddset(&hup, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &hup, nullptr);
+
+    this->thread = std::thread(&ReferenceReloader::run, this);
+}
+
+
+ReferenceReloader::~ReferenceReloader()
+{
+    this->stopping.store(true);
+    this->thread.join();
+}
+
+
+void ReferenceReloader::run()
+{
+    sigset_t hup;
+    sigemptyset(&hup);
+    sigaddset(&hup, SIGHUP);
+
+    //  Wake regularly to free retired tables and to notice when to stop.
+    const timespec interval { 0, 100000000 };  // 100ms
+    while (!this->stopping.load()) {
+        this->model.take_retired_reference();
+
+        if (sigtimedwait(&hup, nullptr, &interval) != SIGHUP)
+            continue;
+        if (this->verbose)
+            std::cerr << "Caught SIGHUP, reloading reference tables" << std::endl;
+        try {
+            this->model.set_reference(ReferenceDB::load(this->sources, this->verbose));
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Reloading reference tables failed, keeping the current ones: " << e.what() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "Model.hpp"
+#include "ReferenceDB.hpp"
+
+
+//  Reloads the model's reference tables whenever snoop gets a SIGHUP, so a
+//  fresh APNIC dump or OUI list can be picked up without losing the model.
+//
+//  Loading happens on a thread of its own, and the new tables are handed
+//  to the model with Model::set_reference().  The old tables are freed on
+//  that thread too, once the model lets go of them.  A failed reload is
+//  reported and the current tables kept.
+//
+//  The constructor blocks SIGHUP in the calling thread, and so in threads
+//  it starts afterwards.  Construct it before starting any other threads.
+//
+class ReferenceReloader
+{
+public:
+    ReferenceReloader(Model& model, const ReferenceDB::Sources& sources, bool verbose = false);
+    ~ReferenceReloader();
+    ReferenceReloader(const ReferenceReloader&) = delete;
+    ReferenceReloader& operator=(const ReferenceReloader&) = delete;
+
+private:
+    Model& model;
+    ReferenceDB::Sources sources;
+    bool verbose;
+    std::atomic<bool> stopping { false };
+    std::thread thread;
+
+    void run();
+};
@@ -7,29 +7,85 @@
 #include <net/ethernet.h>
 #include <net/if_arp.h>
 #include <netinet/ip.h>
+#include <netinet/ip6.h>
+#include <netinet/tcp.h>
 #include <netinet/udp.h>
 #include <arpa/inet.h>
 
 #include "/home/abarton/debug.hpp"
 
 
-Snoop::Snoop()
+Snoop::Snoop(Model& model, const Options& options)
+    : model(model, options.batch_model),
+      ipv4_udp_sessions(options.udp_session_limit, options.udp_idle_timeout),
+      ipv6_udp_sessions(options.udp_session_limit, options.udp_idle_timeout),
+      ipv4_tcp_sessions(options.tcp_session_limit, options.tcp_idle_timeout),
+      ipv6_tcp_sessions(options.tcp_session_limit, options.tcp_idle_timeout),
+      dns_queries(options.dns_query_limit, options.dns_timeout),
+      ipv4_fragments(options.fragment_memory, options.fragment_datagram_limit, options.fragment_timeout)
 {
 }
 
 
-void Snoop::parse_ethernet(const timeval& ts, const unsigned char* frame, unsigned frame_length)
+void Snoop::parse_ethernet(const timeval& ts, const unsigned char* frame, unsigned frame_length, unsigned wire_length)
 {
-    this->model.note_time(ts.tv_sec * 1e9 + ts.tv_usec * 1e3);
+    long now = ts.tv_sec * 1000000000L + ts.tv_usec * 1000L;
+    this->model.note_time(now);
+    this->ipv4_udp_sessions.expire(now);
+    this->ipv6_udp_sessions.expire(now);
+    this->ipv4_tcp_sessions.expire(now, [this](const IPV4FlowKey&, TCPSession& session) {
+        end_tcp(session, Model::ConnectionEnd::IDLE);
+    });
+    this->ipv6_tcp_sessions.expire(now, [this](const IPV6FlowKey&, TCPSession& session) {
+        end_tcp(session, Model::ConnectionEnd::IDLE);
+    });
+    this->ipv4_fragments.expire(now);
+    this->dns_queries.expire(now, [this](const DNSQueryKey& key, long) {
+        this->model.note_dns_timeout(key.resolver(), key.vlan);
+    });
+    this->now = now;
     if (frame) {
         this->stats.observed++;
-        this->model.note_packet_count(this->stats.observed);
+        this->model.note_packet();
+        this->wire_length = wire_length ? wire_length : frame_length;
         Disposition disp = _parse_ethernet(frame, frame_length);
         this->stats.dispositions[int(disp)]++;
     }
 }
 
 
+void Snoop::note_queue(long capacity, long occupancy, long high_water, long drops, long truncations)
+{
+    this->stats.queue_capacity = capacity;
+    this->stats.queue_occupancy = occupancy;
+    this->stats.queue_high_water = high_water;
+    this->stats.queue_drops = drops;
+    this->stats.queue_truncations = truncations;
+}
+
+
+const Snoop::Stats& Snoop::get_stats()
+{
+    this->stats.udp_sessions = this->ipv4_udp_sessions.size() + this->ipv6_udp_sessions.size();
+    this->stats.udp_idle_evictions = this->ipv4_udp_sessions.get_stats().idle_evictions
+                                   + this->ipv6_udp_sessions.get_stats().idle_evictions;
+    this->stats.udp_sheds = this->ipv4_udp_sessions.get_stats().sheds + this->ipv6_udp_sessions.get_stats().sheds;
+    this->stats.tcp_sessions = this->ipv4_tcp_sessions.size() + this->ipv6_tcp_sessions.size();
+    this->stats.tcp_idle_evictions = this->ipv4_tcp_sessions.get_stats().idle_evictions
+                                   + this->ipv6_tcp_sessions.get_stats().idle_evictions;
+    this->stats.tcp_sheds = this->ipv4_tcp_sessions.get_stats().sheds + this->ipv6_tcp_sessions.get_stats().sheds;
+    this->stats.dns_queries = this->dns_queries.size();
+    this->stats.dns_timeouts = this->dns_queries.get_stats().idle_evictions;
+    this->stats.dns_sheds = this->dns_queries.get_stats().sheds;
+    this->stats.fragment_datagrams = this->ipv4_fragments.size();
+    this->stats.fragments_reassembled = this->ipv4_fragments.get_stats().reassembled;
+    this->stats.fragment_timeouts = this->ipv4_fragments.get_stats().timeouts;
+    this->stats.fragment_evictions = this->ipv4_fragments.get_stats().evictions;
+    this->stats.fragment_rejects = this->ipv4_fragments.get_stats().rejects;
+    return this->stats;
+}
+
+
 Disposition Snoop::_parse_ethernet(const unsigned char* frame, unsigned frame_length)
 {
     if (frame_length < sizeof(struct ether_header))
@@ -50,16 +106,33 @@ Disposition Snoop::_parse_ethernet(const unsigned char* frame, unsigned frame_le
     MacAddress source, destination;
     std::copy_n(header->ether_shost, 6, source.begin());
     std::copy_n(header->ether_dhost, 6, destination.begin());
-    this->model.note_l2_packet_traffic(source, destination);
 
     const unsigned char* payload = frame + sizeof(ether_header);
     unsigned payload_length = frame_length - sizeof(ether_header);
 
-    switch (ntohs(header->ether_type)) {
+    //  Strip 802.1Q tags, and stacked 802.1ad (QinQ) tags.  Only the
+    //  innermost (customer) tag's VLAN ID partitions the model: outer
+    //  (service) tags are dropped, so the same customer VLAN ID carried
+    //  under two service tags is taken to be one VLAN.
+    uint16_t ether_type = ntohs(header->ether_type);
+    this->vlan = 0;
+    while (ether_type == 0x8100 || ether_type == 0x88A8 || ether_type == 0x9100) {
+        if (payload_length < 4)
+            return Disposition::TRUNCATED;
+        this->vlan = ((payload[0] << 8) | payload[1]) & 0x0FFF;
+        ether_type = (payload[2] << 8) | payload[3];
+        payload += 4;
+        payload_length -= 4;
+    }
+    this->model.note_l2_packet_traffic(source, destination, this->wire_length, this->vlan);
+
+    switch (ether_type) {
         case 0x0800: // IPv4
             return parse_ipv4(source, destination, payload, payload_length);
         case 0x0806: // ARP
             return parse_arp(payload, payload_length);
+        case 0x86DD: // IPv6
+            return parse_ipv6(source, destination, payload, payload_length);
         default:
             return Disposition::ETHERTYPE_BAD;
     }
@@ -115,11 +188,11 @@ Disposition Snoop::parse_arp(const unsigned char* frame, unsigned frame_length)
     IPV4Address ipaddr;
     std::copy(args->sender_mac, args->sender_mac+6, mac.begin());
     std::copy(args->sender_ip_address, args->sender_ip_address+4, ipaddr.begin());
-    this->model.note_arp(mac, ipaddr);
+    this->model.note_arp(mac, ipaddr, this->vlan);
 
     std::copy(args->target_mac, args->target_mac+6, mac.begin());
     std::copy(args->target_ip_address, args->target_ip_address+4, ipaddr.begin());
-    this->model.note_arp(mac, ipaddr);
+    this->model.note_arp(mac, ipaddr, this->vlan);
 
     return Disposition::ARP;
 }
@@ -136,12 +209,6 @@ Disposition Snoop::parse_ipv4(
 
     const struct ip* header = reinterpret_cast<const struct ip*>(packet);
 
-    uint16_t frag_off = ntohs(header->ip_off) & IP_OFFMASK;
-    unsigned more_fragments = (ntohs(header->ip_off) & IP_MF) == IP_MF;
-    if (frag_off || more_fragments)
-        return Disposition::IPv4_FRAGMENT;
-    //  TODO: handle fragments
-
     if (4 != header->ip_v)
         return Disposition::IPv4_BAD;
 
@@ -156,26 +223,44 @@ Disposition Snoop::parse_ipv4(
     else if (total_length > adjusted_length)
         return Disposition::TRUNCATED;
 
+    unsigned int header_length = 4 * header->ip_hl;
+    if (header_length < sizeof(struct ip) || header_length > adjusted_length)
+        return Disposition::IPv4_BAD;
+
     IPV4Address ip_src_addr;
     const unsigned char* s_addr = reinterpret_cast<const unsigned char*>(&header->ip_src.s_addr);
     std::copy(s_addr, s_addr+4, ip_src_addr.begin());
-    this->model.note_ip_through_interface(ip_src_addr, eth_src_addr);
+    this->model.note_ip_through_interface(ip_src_addr, eth_src_addr, this->wire_length, this->vlan);
 
     IPV4Address ip_dst_addr;
     s_addr = reinterpret_cast<const unsigned char*>(&header->ip_dst.s_addr);
     std::copy(s_addr, s_addr+4, ip_dst_addr.begin());
-    this->model.note_ip_through_interface(ip_dst_addr, eth_dst_addr);
+    this->model.note_ip_through_interface(ip_dst_addr, eth_dst_addr, this->wire_length, this->vlan);
+
+    const unsigned char* payload = packet + header_length;
+    unsigned payload_length = adjusted_length - header_length;
+
+    //  Hold fragments until their datagram is whole, then carry on with
+    //  it as if it had arrived in one piece.
+    uint16_t frag_off = ntohs(header->ip_off) & IP_OFFMASK;
+    bool more_fragments = (ntohs(header->ip_off) & IP_MF) == IP_MF;
+    if (frag_off || more_fragments) {
+        IPV4Reassembler::Key key { header->ip_src.s_addr, header->ip_dst.s_addr, ntohs(header->ip_id), header->ip_p };
+        unsigned datagram_length;
+        payload = this->ipv4_fragments.add(key, this->now, 8 * frag_off, more_fragments,
+                                           payload, payload_length, datagram_length);
+        if (!payload)
+            return Disposition::IPv4_FRAGMENT;
+        payload_length = datagram_length;
+    }
 
-    unsigned int header_length = 4 * header->ip_hl;
     switch (header->ip_p) {
-#if 0
         case IPPROTO_TCP:
-            parse_tcp(packet + header_length, adjusted_length - header_length);
+            return parse_tcp(ip_src_addr, ip_dst_addr, payload, payload_length);
             break;
-#endif
 
         case IPPROTO_UDP:
-            return parse_udp(ip_src_addr, ip_dst_addr, packet + header_length, adjusted_length - header_length);
+            return parse_udp(ip_src_addr, ip_dst_addr, payload, payload_length);
             break;
 
         default:
@@ -199,19 +284,267 @@ Disposition Snoop::parse_udp(
     IPV4SockAddress dst_sa { dst_ip, ntohs(header->uh_dport) };
 
     IPV4UDPKey key(src_sa, dst_sa);
-    auto it = this->ipv4_udp_sessions.find(key);
-    if (it == this->ipv4_udp_sessions.end()) {
-        auto [new_it, _] = this->ipv4_udp_sessions.emplace(key, key);
-        it = new_it;
+    IPV4FlowKey flow_key(key);
+    IPV4UDPSession* session = this->ipv4_udp_sessions.find(flow_key, this->now);
+    if (!session)
+        session = &this->ipv4_udp_sessions.emplace(flow_key, this->now, key);
+    int dir = src_sa == key.a;
+    this->udp_source = src_ip;
+    this->udp_destination = dst_ip;
+    this->udp_source_port = src_sa.port;
+    this->udp_destination_port = dst_sa.port;
+    return session->put(*this, dir, packet+sizeof(struct udphdr), length - sizeof(struct udphdr));
+}
+
+
+Disposition Snoop::parse_ipv6(
+        const MacAddress& eth_src_addr,
+        const MacAddress& eth_dst_addr,
+        const unsigned char* packet,
+        unsigned packet_length)
+{
+    if (packet_length < sizeof(struct ip6_hdr))
+        return Disposition::TRUNCATED;
+
+    const struct ip6_hdr* header = reinterpret_cast<const struct ip6_hdr*>(packet);
+    if ((header->ip6_vfc >> 4) != 6)
+        return Disposition::IPv6_BAD;
+
+    //  As with IPv4, the frame may be padded or truncated.
+    unsigned total_length = sizeof(struct ip6_hdr) + ntohs(header->ip6_plen);
+    if (total_length > packet_length)
+        return Disposition::TRUNCATED;
+    packet_length = total_length;
+
+    IPV6Address ip_src_addr, ip_dst_addr;
+    memcpy(ip_src_addr.data(), &header->ip6_src, 16);
+    memcpy(ip_dst_addr.data(), &header->ip6_dst, 16);
+    this->model.note_ip_through_interface(ip_src_addr, eth_src_addr, this->wire_length, this->vlan);
+    this->model.note_ip_through_interface(ip_dst_addr, eth_dst_addr, this->wire_length, this->vlan);
+
+    //  Walk the extension headers to the upper layer.  Each is at least
+    //  8 octets, so the packet's length bounds the walk.
+    unsigned next_header = header->ip6_nxt;
+    unsigned offset = sizeof(struct ip6_hdr);
+    for (;;) {
+        switch (next_header) {
+            case IPPROTO_HOPOPTS:
+            case IPPROTO_ROUTING:
+            case IPPROTO_DSTOPTS:
+            case IPPROTO_MH: {
+                if (offset + sizeof(struct ip6_ext) > packet_length)
+                    return Disposition::TRUNCATED;
+                const struct ip6_ext* ext = reinterpret_cast<const struct ip6_ext*>(packet + offset);
+                next_header = ext->ip6e_nxt;
+                offset += 8 * (ext->ip6e_len + 1);
+                break;
+            }
+
+            case IPPROTO_AH: {
+                //  AH counts its length in 4 octet units, less 2.
+                if (offset + sizeof(struct ip6_ext) > packet_length)
+                    return Disposition::TRUNCATED;
+                const struct ip6_ext* ext = reinterpret_cast<const struct ip6_ext*>(packet + offset);
+                next_header = ext->ip6e_nxt;
+                offset += 4 * (ext->ip6e_len + 2);
+                break;
+            }
+
+            case IPPROTO_FRAGMENT: {
+                if (offset + sizeof(struct ip6_frag) > packet_length)
+                    return Disposition::TRUNCATED;
+                const struct ip6_frag* frag = reinterpret_cast<const struct ip6_frag*>(packet + offset);
+                if (frag->ip6f_offlg & (IP6F_OFF_MASK | IP6F_MORE_FRAG))
+                    return Disposition::IPv6_FRAGMENT;
+                //  An atomic fragment holds the whole packet.
+                next_header = frag->ip6f_nxt;
+                offset += sizeof(struct ip6_frag);
+                break;
+            }
+
+            case IPPROTO_UDP:
+                return parse_udp(ip_src_addr, ip_dst_addr, packet + offset, packet_length - offset);
+
+            case IPPROTO_TCP:
+                return parse_tcp(ip_src_addr, ip_dst_addr, packet + offset, packet_length - offset);
+
+            default:
+                return Disposition::IPv6_PROTOCOL;
+        }
+        if (offset > packet_length)
+            return Disposition::TRUNCATED;
     }
+}
+
+
+Disposition Snoop::parse_udp(
+        const IPV6Address& src_ip,
+        const IPV6Address& dst_ip,
+        const unsigned char* packet,
+        unsigned length)
+{
+    if (length < sizeof(struct udphdr))
+        return Disposition::TRUNCATED;
+
+    const struct udphdr* header = reinterpret_cast<const struct udphdr*>(packet);
+    IPV6SockAddress src_sa { src_ip, ntohs(header->uh_sport) };
+    IPV6SockAddress dst_sa { dst_ip, ntohs(header->uh_dport) };
+
+    IPV6UDPKey key(src_sa, dst_sa);
+    IPV6FlowKey flow_key(key);
+    IPV6UDPSession* session = this->ipv6_udp_sessions.find(flow_key, this->now);
+    if (!session)
+        session = &this->ipv6_udp_sessions.emplace(flow_key, this->now, key);
     int dir = src_sa == key.a;
-    return it->second.put(*this, dir, packet+sizeof(struct udphdr), length - sizeof(struct udphdr));
+    this->udp_source = src_ip;
+    this->udp_destination = dst_ip;
+    this->udp_source_port = src_sa.port;
+    this->udp_destination_port = dst_sa.port;
+    return session->put(*this, dir, packet+sizeof(struct udphdr), length - sizeof(struct udphdr));
+}
+
+
+void Snoop::note_dns_query(uint16_t id)
+{
+    DNSQueryKey key(this->udp_source, this->udp_source_port, this->udp_destination, this->udp_destination_port, id,
+                    this->vlan);
+    //  Time a retransmitted query from the first transmission, and time it
+    //  out from then too: peek() leaves it seen when it was first sent.
+    if (!this->dns_queries.peek(key))
+        this->dns_queries.emplace(key, this->now, this->now);
+}
+
+
+void Snoop::note_dns_response(uint16_t id)
+{
+    DNSQueryKey key(this->udp_destination, this->udp_destination_port, this->udp_source, this->udp_source_port, id,
+                    this->vlan);
+    const long* sent = this->dns_queries.peek(key);
+    if (!sent)
+        return;  //  Missed the query, or answered already.
+    this->model.note_dns_response(this->udp_source, this->now - *sent, this->vlan);
+    this->dns_queries.erase(key);
+}
+
+
+Disposition Snoop::parse_tcp(
+        const IPV4Address& src_ip,
+        const IPV4Address& dst_ip,
+        const unsigned char* packet,
+        unsigned length)
+{
+    if (length < sizeof(struct tcphdr))
+        return Disposition::TRUNCATED;
+
+    const struct tcphdr* header = reinterpret_cast<const struct tcphdr*>(packet);
+    unsigned header_length = 4 * header->th_off;
+    if (header_length < sizeof(struct tcphdr) || header_length > length)
+        return Disposition::TCP_BAD;
+    IPV4SockAddress src_sa { src_ip, ntohs(header->th_sport) };
+    IPV4SockAddress dst_sa { dst_ip, ntohs(header->th_dport) };
+
+    IPV4SessionKey key(src_sa, dst_sa);
+    int dir = src_sa == key.a;
+    return put_tcp(this->ipv4_tcp_sessions, IPV4FlowKey(key), dir,
+                   src_ip, src_sa.port, dst_ip, dst_sa.port,
+                   header->th_flags, length - header_length);
+}
+
+
+Disposition Snoop::parse_tcp(
+        const IPV6Address& src_ip,
+        const IPV6Address& dst_ip,
+        const unsigned char* packet,
+        unsigned length)
+{
+    if (length < sizeof(struct tcphdr))
+        return Disposition::TRUNCATED;
+
+    const struct tcphdr* header = reinterpret_cast<const struct tcphdr*>(packet);
+    unsigned header_length = 4 * header->th_off;
+    if (header_length < sizeof(struct tcphdr) || header_length > length)
+        return Disposition::TCP_BAD;
+    IPV6SockAddress src_sa { src_ip, ntohs(header->th_sport) };
+    IPV6SockAddress dst_sa { dst_ip, ntohs(header->th_dport) };
+
+    IPV6SessionKey key(src_sa, dst_sa);
+    int dir = src_sa == key.a;
+    return put_tcp(this->ipv6_tcp_sessions, IPV6FlowKey(key), dir,
+                   src_ip, src_sa.port, dst_ip, dst_sa.port,
+                   header->th_flags, length - header_length);
+}
+
+
+template<class FlowKey>
+Disposition Snoop::put_tcp(FlowTable<FlowKey, TCPSession>& sessions, const FlowKey& flow_key, int dir,
+                           const IPAddress& src, uint16_t src_port, const IPAddress& dst, uint16_t dst_port,
+                           uint8_t flags, unsigned payload_length)
+{
+    TCPSession* session = sessions.find(flow_key, this->now);
+    if (!session) {
+        if (!TCPSession::starts(flags, payload_length))
+            return Disposition::TCP;
+        if (sessions.full())
+            sessions.shed([this](const FlowKey&, TCPSession& shed) {
+                end_tcp(shed, Model::ConnectionEnd::SHED);
+            });
+
+        //  The model's a end is whichever opened the connection.
+        bool src_opened = TCPSession::opener_dir(dir, flags) == dir;
+        uint32_t connection = src_opened
+            ? this->model.open_connection(Model::ConnectionProtocol::TCP, src, src_port, dst, dst_port, this->vlan)
+            : this->model.open_connection(Model::ConnectionProtocol::TCP, dst, dst_port, src, src_port, this->vlan);
+        session = &sessions.emplace(flow_key, this->now, connection, dir, flags);
+    }
+
+    session->put(dir, flags, payload_length);
+    this->model.note_connection_packet(session->get_connection(), session->from(dir), payload_length);
+    if (session->ended()) {
+        bool reset = session->get_state() == TCPSession::State::RESET;
+        end_tcp(*session, reset ? Model::ConnectionEnd::RESET : Model::ConnectionEnd::CLOSED);
+        sessions.erase(flow_key);
+    }
+    return Disposition::TCP;
+}
+
+
+void Snoop::end_tcp(const TCPSession& session, Model::ConnectionEnd end)
+{
+    this->model.close_connection(session.get_connection(), end, session.established());
 }
 
 
 //  TODO: Implement IPv6's Neighbor Discovery and Inverse Neighbor Discovery protocols.
 
 
+Snoop::Stats& Snoop::Stats::operator+=(const Stats& rhs)
+{
+    this->observed += rhs.observed;
+    for (int i=0; i<int(Disposition::_MAX); ++i)
+        this->dispositions[i] += rhs.dispositions[i];
+    this->queue_capacity += rhs.queue_capacity;
+    this->queue_occupancy += rhs.queue_occupancy;
+    this->queue_high_water = std::max(this->queue_high_water, rhs.queue_high_water);
+    this->queue_drops += rhs.queue_drops;
+    this->queue_truncations += rhs.queue_truncations;
+    this->udp_sessions += rhs.udp_sessions;
+    this->udp_idle_evictions += rhs.udp_idle_evictions;
+    this->udp_sheds += rhs.udp_sheds;
+    this->tcp_sessions += rhs.tcp_sessions;
+    this->tcp_idle_evictions += rhs.tcp_idle_evictions;
+    this->tcp_sheds += rhs.tcp_sheds;
+    this->dns_queries += rhs.dns_queries;
+    this->dns_timeouts += rhs.dns_timeouts;
+    this->dns_sheds += rhs.dns_sheds;
+    this->fragment_datagrams += rhs.fragment_datagrams;
+    this->fragments_reassembled += rhs.fragments_reassembled;
+    this->fragment_timeouts += rhs.fragment_timeouts;
+    this->fragment_evictions += rhs.fragment_evictions;
+    this->fragment_rejects += rhs.fragment_rejects;
+    return *this;
+}
+
+
 std::ostream& operator<<(std::ostream& o, const Snoop::Stats& stats)
 {
     o << "Stats:\n";
@@ -220,5 +553,31 @@ std::ostream& operator<<(std::ostream& o, const Snoop::Stats& stats)
     for (int i=0; i<int(Disposition::_MAX); ++i) {
         o << "       " << std::setw(9) << stats.dispositions[i] << " " << Disposition(i) << "\n";
     }
+    o << "    " << "         " << " UDP sessions\n";
+    o << "       " << std::setw(9) << stats.udp_sessions << " tracked\n";
+    o << "       " << std::setw(9) << stats.udp_idle_evictions << " evicted idle\n";
+    o << "       " << std::setw(9) << stats.udp_sheds << " shed when full\n";
+    o << "    " << "         " << " TCP connections\n";
+    o << "       " << std::setw(9) << stats.tcp_sessions << " tracked\n";
+    o << "       " << std::setw(9) << stats.tcp_idle_evictions << " evicted idle\n";
+    o << "       " << std::setw(9) << stats.tcp_sheds << " shed when full\n";
+    o << "    " << "         " << " DNS queries\n";
+    o << "       " << std::setw(9) << stats.dns_queries << " awaiting a response\n";
+    o << "       " << std::setw(9) << stats.dns_timeouts << " timed out\n";
+    o << "       " << std::setw(9) << stats.dns_sheds << " shed when full\n";
+    o << "    " << "         " << " IPv4 fragmented datagrams\n";
+    o << "       " << std::setw(9) << stats.fragment_datagrams << " awaiting fragments\n";
+    o << "       " << std::setw(9) << stats.fragments_reassembled << " reassembled\n";
+    o << "       " << std::setw(9) << stats.fragment_timeouts << " timed out\n";
+    o << "       " << std::setw(9) << stats.fragment_evictions << " evicted when full\n";
+    o << "       " << std::setw(9) << stats.fragment_rejects << " rejected for overlapping or malformed fragments\n";
+    if (stats.queue_capacity) {
+        o << "    " << "         " << " capture queue\n";
+        o << "       " << std::setw(9) << stats.queue_capacity << " bytes capacity\n";
+        o << "       " << std::setw(9) << stats.queue_occupancy << " bytes occupied\n";
+        o << "       " << std::setw(9) << stats.queue_high_water << " bytes high-water mark\n";
+        o << "       " << std::setw(9) << stats.queue_drops << " overflow drops\n";
+        o << "       " << std::setw(9) << stats.queue_truncations << " frames truncated to fit\n";
+    }
     return o;
 }
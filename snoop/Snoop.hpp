@@ -6,7 +6,12 @@
 
 #include "util.hpp"
 #include "Disposition.hpp"
+#include "FlowTable.hpp"
+#include "IPV4Reassembler.hpp"
 #include "Model.hpp"
+#include "ModelShard.hpp"
+#include "ProtocolDNS.hpp"
+#include "TCPSession.hpp"
 #include "UDPSession.hpp"
 
 
@@ -16,16 +21,81 @@ public:
     struct Stats {
         long observed = 0;
         long dispositions[int(Disposition::_MAX)] = { 0 };
+
+        //  Capture queue stats.  All zero when frames aren't queued.
+        long queue_capacity = 0;    // Bytes.
+        long queue_occupancy = 0;   // Bytes of frames waiting to be parsed.
+        long queue_high_water = 0;  // Most bytes ever waiting to be parsed.
+        long queue_drops = 0;       // Frames dropped because the queue was full.
+        long queue_truncations = 0; // Frames cut short to fit in the queue.
+
+        long udp_sessions = 0;          // UDP sessions currently tracked.
+        long udp_idle_evictions = 0;    // UDP sessions forgotten for being idle.
+        long udp_sheds = 0;             // UDP sessions forgotten to make room for new ones.
+
+        long tcp_sessions = 0;          // TCP connections currently tracked.
+        long tcp_idle_evictions = 0;    // TCP connections forgotten for being idle.
+        long tcp_sheds = 0;             // TCP connections forgotten to make room for new ones.
+
+        long dns_queries = 0;           // DNS queries awaiting a response.
+        long dns_timeouts = 0;          // DNS queries never answered.
+        long dns_sheds = 0;             // DNS queries forgotten to make room for new ones.
+
+        long fragment_datagrams = 0;    // IPv4 datagrams awaiting more fragments.
+        long fragments_reassembled = 0; // IPv4 datagrams reassembled from their fragments.
+        long fragment_timeouts = 0;     // IPv4 datagrams abandoned for their fragments taking too long.
+        long fragment_evictions = 0;    // IPv4 datagrams abandoned to make room for others.
+        long fragment_rejects = 0;      // IPv4 datagrams abandoned for overlapping or malformed fragments.
+
+        Stats& operator+=(const Stats&);
     };
 
-    Snoop();
-    void parse_ethernet(const timeval& ts, const unsigned char* frame, unsigned frame_length);
-    const Stats& get_stats() const { return stats; }
-    Model& get_model() { return model; }
+    struct Options {
+        size_t udp_session_limit = 262144;  //  Most UDP sessions tracked at once, each for IPv4 and IPv6.
+        long udp_idle_timeout = 120 * 1000000000L; //  Nanoseconds.
+        //  Each tracked TCP connection takes about 150 bytes here and in the
+        //  Model (IPv6 ones 190), so a million take about 150MB.
+        size_t tcp_session_limit = 1048576;  //  Most TCP connections tracked at once, each for IPv4 and IPv6.
+        long tcp_idle_timeout = 600 * 1000000000L; //  Nanoseconds.
+        //  At 100k queries per second this holds 2.6 seconds of unanswered
+        //  queries, in about 21MB.
+        size_t dns_query_limit = 262144;    //  Most DNS queries awaiting a response at once.
+        long dns_timeout = 5 * 1000000000L; //  Nanoseconds.  Like the resolver(5) default.
+        size_t fragment_memory = 4 << 20;     //  Bytes of IPv4 fragments held for reassembly at once.
+        size_t fragment_datagram_limit = 1024;  //  Most IPv4 datagrams being reassembled at once.
+        long fragment_timeout = 30 * 1000000000L; //  Nanoseconds.  Like Linux's ipfrag_time default.
+        //  Batch calls to the Model until merge(), for Snoops on several
+        //  threads sharing one Model.
+        bool batch_model = false;
+    };
+
+    Snoop(Model& model, const Options& options);
+    //  Parse a frame, :frame_length: bytes of it captured of :wire_length:
+    //  sent, or all of them if :wire_length: is 0.  A null frame just
+    //  notes the time.
+    void parse_ethernet(const timeval& ts, const unsigned char* frame, unsigned frame_length, unsigned wire_length = 0);
+    void note_queue(long capacity, long occupancy, long high_water, long drops, long truncations);
+    const Stats& get_stats();
+    Model::Shard& get_model() { return model; }
+    //  With Options::batch_model, apply the Model calls batched since the
+    //  last merge, taking the Model's lock once.  Call after each batch of
+    //  frames, and after a null frame noting the time.
+    void merge() { this->model.merge(); }
+    //  The VLAN ID of the frame being parsed, 0 if untagged.
+    uint16_t get_vlan() const { return this->vlan; }
+
+    //  Note a DNS query or response with transaction ID :id: in the
+    //  UDP datagram being parsed.  Responses are matched with queries to
+    //  time the resolver.
+    void note_dns_query(uint16_t id);
+    void note_dns_response(uint16_t id);
 
 private:
     Stats stats;
-    Model model;
+    Model::Shard model;
+    long now = 0; //  Timestamp of the current packet.  Nanoseconds since the epoch.
+    uint16_t vlan = 0;  //  Innermost VLAN ID of the current frame, 0 if untagged.
+    unsigned wire_length = 0;  //  Length of the current frame on the wire.
 
     Disposition _parse_ethernet(const unsigned char* frame, unsigned frame_length);
     Disposition parse_arp(const unsigned char* frame, unsigned frame_length);
@@ -33,12 +103,46 @@ private:
                            const MacAddress& eth_dst_addr,
                            const unsigned char* packet,
                            unsigned packet_length);
+    Disposition parse_ipv6(const MacAddress& eth_src_addr,
+                           const MacAddress& eth_dst_addr,
+                           const unsigned char* packet,
+                           unsigned packet_length);
     Disposition parse_udp(const IPV4Address& src,
                           const IPV4Address& dst,
                           const unsigned char* packet,
                           unsigned packet_length);
+    Disposition parse_udp(const IPV6Address& src,
+                          const IPV6Address& dst,
+                          const unsigned char* packet,
+                          unsigned packet_length);
+    Disposition parse_tcp(const IPV4Address& src,
+                          const IPV4Address& dst,
+                          const unsigned char* packet,
+                          unsigned packet_length);
+    Disposition parse_tcp(const IPV6Address& src,
+                          const IPV6Address& dst,
+                          const unsigned char* packet,
+                          unsigned packet_length);
+    //  Track a TCP segment in :sessions:, noting the connection in the model.
+    template<class FlowKey>
+    Disposition put_tcp(FlowTable<FlowKey, TCPSession>& sessions, const FlowKey& flow_key, int dir,
+                        const IPAddress& src, uint16_t src_port, const IPAddress& dst, uint16_t dst_port,
+                        uint8_t flags, unsigned payload_length);
+    void end_tcp(const TCPSession&, Model::ConnectionEnd);
+
+    FlowTable<IPV4FlowKey, IPV4UDPSession> ipv4_udp_sessions;
+    FlowTable<IPV6FlowKey, IPV6UDPSession> ipv6_udp_sessions;
+    FlowTable<IPV4FlowKey, TCPSession> ipv4_tcp_sessions;
+    FlowTable<IPV6FlowKey, TCPSession> ipv6_tcp_sessions;
+
+    //  Addresses and ports of the UDP datagram being parsed.
+    IPAddress udp_source, udp_destination;
+    uint16_t udp_source_port = 0, udp_destination_port = 0;
+
+    //  Outstanding DNS queries, and when they were sent.
+    FlowTable<DNSQueryKey, long> dns_queries;
 
-    std::map<IPV4UDPKey, IPV4UDPSession> ipv4_udp_sessions;
+    IPV4Reassembler ipv4_fragments;
 };
 
 
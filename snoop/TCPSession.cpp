@@ -0,0 +1,77 @@
+#include <netinet/tcp.h>
+
+#include "TCPSession.hpp"
+
+
+bool TCPSession::starts(uint8_t flags, unsigned payload_length)
+{
+    if (flags & (TH_RST | TH_FIN))
+        return false;
+    return (flags & TH_SYN) || payload_length;
+}
+
+
+int TCPSession::opener_dir(int dir, uint8_t flags)
+{
+    //  A SYN-ACK is the reply to an opener's SYN that was missed.  Else,
+    //  whichever end is seen first is as good a guess at the opener as any.
+    if ((flags & TH_SYN) && (flags & TH_ACK))
+        return !dir;
+    return dir;
+}
+
+
+TCPSession::TCPSession(uint32_t connection, int dir, uint8_t flags)
+    : connection(connection), opener(opener_dir(dir, flags))
+{
+    if ((flags & TH_SYN) && (flags & TH_ACK))
+        this->state = State::SYN_RECEIVED;
+    else if (flags & TH_SYN)
+        this->state = State::SYN_SENT;
+    else {
+        //  Already open.
+        this->state = State::ESTABLISHED;
+        this->was_established = true;
+    }
+}
+
+
+void TCPSession::put(int dir, uint8_t flags, unsigned payload_length)
+{
+    if (this->ended())
+        return;
+    if (flags & TH_RST) {
+        this->state = State::RESET;
+        return;
+    }
+
+    //  Data from either end means the handshake is done, whatever of it
+    //  was missed: a one-way mirror may never show the SYN-ACK, or the
+    //  opener's packets after it.
+    bool data = !(flags & TH_SYN) && payload_length;
+    switch (this->state) {
+        case State::SYN_SENT:
+            if (dir != this->opener && (flags & TH_SYN) && (flags & TH_ACK))
+                this->state = State::SYN_RECEIVED;
+            else if (data) {
+                this->state = State::ESTABLISHED;
+                this->was_established = true;
+            }
+            break;
+        case State::SYN_RECEIVED:
+            //  The opener's ACK of the SYN-ACK, or data if that was missed.
+            if ((dir == this->opener && !(flags & TH_SYN) && (flags & TH_ACK)) || data) {
+                this->state = State::ESTABLISHED;
+                this->was_established = true;
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (flags & TH_FIN) {
+        this->fins |= 1 << dir;
+        if (this->fins == 3)
+            this->state = State::CLOSED;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+
+//  A TCP connection's state, as far as it can be told from its packets.
+//  There may be millions at once, so it's kept to 8 bytes: the rest of
+//  the connection is its key in the flow table and its Model::Connection.
+//
+//  Directions are as in the UDP sessions: :dir: is 1 for packets from
+//  the flow key's a end.
+//
+class TCPSession {
+public:
+    enum class State : uint8_t {
+        SYN_SENT,      //  The opener's SYN seen.
+        SYN_RECEIVED,  //  The other end's SYN-ACK seen.
+        ESTABLISHED,
+        CLOSED,        //  Both ends sent FINs.
+        RESET,
+    };
+
+    //  Returns whether a packet with TCP :flags: should start a session.
+    //  A SYN starts one, as does data on a connection already open when
+    //  it was first seen, which counts as established.  Bare ACKs, FINs
+    //  and RSTs don't: they're usually the stragglers of connections just
+    //  closed.
+    static bool starts(uint8_t flags, unsigned payload_length);
+
+    //  The direction of the end that opened a session started by a packet
+    //  from direction :dir: with TCP :flags:.
+    static int opener_dir(int dir, uint8_t flags);
+
+    //  A session starting with a packet from direction :dir:.
+    TCPSession(uint32_t connection, int dir, uint8_t flags);
+
+    //  Note a packet from direction :dir: with TCP :flags:.  The opener's
+    //  ACK of the SYN-ACK establishes the connection, as does data from
+    //  either end if parts of the handshake were missed.
+    void put(int dir, uint8_t flags, unsigned payload_length);
+
+    //  0 for a packet from the end that opened the connection, else 1.
+    int from(int dir) const { return dir != this->opener; }
+
+    bool ended() const { return this->state == State::CLOSED || this->state == State::RESET; }
+    //  Whether it got as far as ESTABLISHED, even if it's ended since.
+    bool established() const { return this->was_established; }
+    State get_state() const { return this->state; }
+    uint32_t get_connection() const { return this->connection; }
+
+private:
+    uint32_t connection;  //  The Model's connection handle.
+    State state;
+    uint8_t opener;       //  The direction of the end that opened it.
+    uint8_t fins = 0;     //  Bit :dir: set once a FIN from :dir: is seen.
+    bool was_established = false;
+};
@@ -4,14 +4,18 @@
 #include "ProtocolDiscard.hpp"
 
 
+//  Just assume anything over UDP port 53 is DNS.
+static Protocol* protocol_for_ports(unsigned short a, unsigned short b)
+{
+    if (a == 53 || b == 53)
+        return &ProtocolDNS::instance();
+    return &ProtocolDiscard::instance();
+}
+
+
 IPV4UDPSession::IPV4UDPSession(const IPV4UDPKey& key)
-    : key(key)
+    : key(key), protocol(protocol_for_ports(key.a.port, key.b.port))
 {
-    //  Just assume anything over UDP port 53 is DNS.
-    if (key.a.port == 53 || key.b.port == 53)
-        this->protocol = new ProtocolDNS();
-    else
-        this->protocol = new ProtocolDiscard();
 }
 
 
@@ -19,3 +23,15 @@ Disposition IPV4UDPSession::put(Snoop& snoop, int dir, const unsigned char* payl
 {
     return this->protocol->put(snoop, dir, payload, length);
 }
+
+
+IPV6UDPSession::IPV6UDPSession(const IPV6UDPKey& key)
+    : key(key), protocol(protocol_for_ports(key.a.port, key.b.port))
+{
+}
+
+
+Disposition IPV6UDPSession::put(Snoop& snoop, int dir, const unsigned char* payload, int length)
+{
+    return this->protocol->put(snoop, dir, payload, length);
+}
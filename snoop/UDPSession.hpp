@@ -21,5 +21,23 @@ public:
 
 private:
     IPV4UDPKey key;
-    Protocol* protocol; //  TODO: use unique_ptr<>
+    Protocol* protocol;  //  A shared singleton, not owned.
+};
+
+
+struct IPV6UDPKey : public IPV6SessionKey {
+    explicit IPV6UDPKey(const IPV6SockAddress& a, const IPV6SockAddress& b)
+        : IPV6SessionKey(a, b)
+    {}
+};
+
+
+class IPV6UDPSession {
+public:
+    IPV6UDPSession(const IPV6UDPKey& key);
+    Disposition put(Snoop&, int dir, const unsigned char* payload, int length);
+
+private:
+    IPV6UDPKey key;
+    Protocol* protocol;  //  A shared singleton, not owned.
 };
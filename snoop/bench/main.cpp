@@ -0,0 +1,1275 @@
+//  Microbenchmarks for snoop internals.
+//  Run "bench" with no arguments for a list.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <malloc.h>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <net/ethernet.h>
+#include <netinet/ip.h>
+#include <netinet/ip6.h>
+#include <netinet/tcp.h>
+#include <netinet/udp.h>
+#include <pcap.h>
+#include <unistd.h>
+
+#include "IPV4PrefixTable.hpp"
+#include "IPV4Reassembler.hpp"
+#include "IPV6PrefixTable.hpp"
+#include "Model.hpp"
+#include "ProtocolDNS.hpp"
+#include "ReferenceDB.hpp"
+#include "Snoop.hpp"
+
+
+//  Count every heap allocation.
+//
+static long allocations = 0;
+
+void* operator new(size_t size)
+{
+    ++allocations;
+    void* p = malloc(size ? size : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+
+using Clock = std::chrono::steady_clock;
+
+static double seconds_since(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+
+//  A locally administered MAC address numbered :n:.
+//
+static MacAddress mac(uint32_t n)
+{
+    MacAddress address { { 0x02, 0, 0, 0, 0, 0 } };
+    for (int i=0; i<4; ++i)
+        address[5 - i] = n >> (8 * i);
+    return address;
+}
+
+
+//  Build an Ethernet/IPv4/UDP frame.
+//
+static std::vector<unsigned char> udp_frame(uint32_t src_ip, uint16_t src_port,
+                                            uint32_t dst_ip, uint16_t dst_port,
+                                            unsigned payload_length)
+{
+    std::vector<unsigned char> frame(sizeof(ether_header) + sizeof(ip) + sizeof(udphdr) + payload_length);
+    ether_header* eth = reinterpret_cast<ether_header*>(frame.data());
+    const unsigned char src_mac[6] = { 0x02, 0, 0, 0, 0, 1 };
+    const unsigned char dst_mac[6] = { 0x02, 0, 0, 0, 0, 2 };
+    memcpy(eth->ether_shost, src_mac, 6);
+    memcpy(eth->ether_dhost, dst_mac, 6);
+    eth->ether_type = htons(0x0800);
+
+    ip* iph = reinterpret_cast<ip*>(eth + 1);
+    iph->ip_v = 4;
+    iph->ip_hl = 5;
+    iph->ip_len = htons(sizeof(ip) + sizeof(udphdr) + payload_length);
+    iph->ip_p = IPPROTO_UDP;
+    iph->ip_src.s_addr = htonl(src_ip);
+    iph->ip_dst.s_addr = htonl(dst_ip);
+
+    udphdr* udp = reinterpret_cast<udphdr*>(iph + 1);
+    udp->uh_sport = htons(src_port);
+    udp->uh_dport = htons(dst_port);
+    udp->uh_ulen = htons(sizeof(udphdr) + payload_length);
+    return frame;
+}
+
+
+//  A port scan: every packet opens a new UDP session, half of them DNS.
+//  Reports heap allocations per million packets.
+//
+static void bench_udp_alloc(int argc, char** argv)
+{
+    long packets = argc > 0 ? std::atol(argv[0]) : 1000000;
+
+    Model model;
+    Snoop::Options options;
+    options.udp_session_limit = 65536;
+    Snoop snoop(model, options);
+
+    //  Half DNS, half something else.
+    std::vector<std::vector<unsigned char>> frames;
+    frames.push_back(udp_frame(0x0a000001, 1024, 0x0a000002, 53, 32));
+    frames.push_back(udp_frame(0x0a000001, 1024, 0x0a000002, 9999, 32));
+
+    //  Warm up so the model's one-time topology allocations aren't counted.
+    timeval ts { 1, 0 };
+    snoop.parse_ethernet(ts, frames[0].data(), frames[0].size());
+
+    long before = allocations;
+    auto t0 = Clock::now();
+    for (long i=0; i<packets; ++i) {
+        ts.tv_usec = i % 1000000;
+        ts.tv_sec = 1 + i / 1000000;
+        //  Vary the source port, and occasionally the source address, so each packet is a new flow.
+        std::vector<unsigned char>& frame = frames[i % frames.size()];
+        ip* iph = reinterpret_cast<ip*>(frame.data() + sizeof(ether_header));
+        iph->ip_src.s_addr = htonl(0x0a010000 + i / 60000);
+        udphdr* udp = reinterpret_cast<udphdr*>(iph + 1);
+        udp->uh_sport = htons(1024 + i % 60000);
+        snoop.parse_ethernet(ts, frame.data(), frame.size());
+    }
+    double elapsed = seconds_since(t0);
+    long count = allocations - before;
+
+    std::cerr << "udp-alloc: " << packets << " packets, "
+              << count << " allocations, "
+              << count * 1e6 / packets << " allocations per million packets, "
+              << packets / elapsed / 1e6 << " Mpps\n";
+}
+
+
+//  Build an Ethernet/IPv6/UDP frame, with a hop-by-hop options header
+//  before the UDP header if :hop_by_hop:.
+//
+static std::vector<unsigned char> udp6_frame(const IPV6Address& src_ip, uint16_t src_port,
+                                             const IPV6Address& dst_ip, uint16_t dst_port,
+                                             unsigned payload_length, bool hop_by_hop)
+{
+    unsigned options_length = hop_by_hop ? 8 : 0;
+    std::vector<unsigned char> frame(sizeof(ether_header) + sizeof(ip6_hdr) + options_length + sizeof(udphdr) + payload_length);
+    ether_header* eth = reinterpret_cast<ether_header*>(frame.data());
+    const unsigned char src_mac[6] = { 0x02, 0, 0, 0, 0, 1 };
+    const unsigned char dst_mac[6] = { 0x02, 0, 0, 0, 0, 2 };
+    memcpy(eth->ether_shost, src_mac, 6);
+    memcpy(eth->ether_dhost, dst_mac, 6);
+    eth->ether_type = htons(0x86DD);
+
+    ip6_hdr* ip6h = reinterpret_cast<ip6_hdr*>(eth + 1);
+    ip6h->ip6_vfc = 6 << 4;
+    ip6h->ip6_plen = htons(options_length + sizeof(udphdr) + payload_length);
+    ip6h->ip6_nxt = hop_by_hop ? int(IPPROTO_HOPOPTS) : int(IPPROTO_UDP);
+    ip6h->ip6_hlim = 64;
+    memcpy(&ip6h->ip6_src, src_ip.data(), 16);
+    memcpy(&ip6h->ip6_dst, dst_ip.data(), 16);
+
+    unsigned char* next = reinterpret_cast<unsigned char*>(ip6h + 1);
+    if (hop_by_hop) {
+        next[0] = IPPROTO_UDP;  //  Next header.  The rest, length 0 and PadN, are zero.
+        next += options_length;
+    }
+    udphdr* udp = reinterpret_cast<udphdr*>(next);
+    udp->uh_sport = htons(src_port);
+    udp->uh_dport = htons(dst_port);
+    udp->uh_ulen = htons(sizeof(udphdr) + payload_length);
+    return frame;
+}
+
+
+//  Parsing known UDP flows, over IPv4 and over IPv6 with a hop-by-hop
+//  options header.  Reports nanoseconds per packet for each.
+//
+static void bench_parse(int argc, char** argv)
+{
+    long packets = argc > 0 ? std::atol(argv[0]) : 10000000;
+    const int flows = 64;
+
+    std::vector<std::vector<unsigned char>> ipv4_frames, ipv6_frames, qinq_frames;
+    for (int i=0; i<flows; ++i) {
+        ipv4_frames.push_back(udp_frame(0x0a000001, 1024 + i, 0x0a000002, 9999, 64));
+        //  The same, tagged with S-VLAN 100 and C-VLAN 20.
+        const unsigned char tags[] = { 0x88, 0xa8, 0x00, 100, 0x81, 0x00, 0x00, 20 };
+        qinq_frames.push_back(ipv4_frames.back());
+        qinq_frames.back().insert(qinq_frames.back().begin() + 12, tags, tags + sizeof(tags));
+        IPV6Address src { { 0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 } };
+        IPV6Address dst { { 0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2 } };
+        ipv6_frames.push_back(udp6_frame(src, 1024 + i, dst, 9999, 64, true));
+    }
+
+    auto time = [packets](const char* name, std::vector<std::vector<unsigned char>>& frames) {
+        Model model;
+        Snoop snoop(model, Snoop::Options());
+        timeval ts { 1, 0 };
+        for (auto& frame : frames)
+            snoop.parse_ethernet(ts, frame.data(), frame.size());
+        auto t0 = Clock::now();
+        for (long i=0; i<packets; ++i) {
+            ts.tv_usec = i % 1000000;
+            ts.tv_sec = 2 + i / 1000000;
+            auto& frame = frames[i % frames.size()];
+            snoop.parse_ethernet(ts, frame.data(), frame.size());
+        }
+        double elapsed = seconds_since(t0);
+        std::cerr << "parse: " << name << " " << elapsed * 1e9 / packets << " ns per packet, "
+                  << snoop.get_stats().dispositions[int(Disposition::L4_PROTOCOL)] << " parsed to UDP\n";
+    };
+    time("IPv4", ipv4_frames);
+    time("IPv4 QinQ", qinq_frames);
+    time("IPv6", ipv6_frames);
+}
+
+
+//  Reassembly of 4000-byte datagrams, each in three fragments, with
+//  :interleave: datagrams in progress at once.  Then a flood of first
+//  fragments that never complete, which the reassembler must evict
+//  within its memory budget.  Reports nanoseconds and heap allocations
+//  per fragment.
+//
+static void bench_fragments(int argc, char** argv)
+{
+    long datagrams = argc > 0 ? std::atol(argv[0]) : 1000000;
+    uint16_t interleave = argc > 1 ? std::atoi(argv[1]) : 256;
+    if (interleave < 1)
+        throw std::invalid_argument("interleave must be at least 1");
+
+    const unsigned length = 4000;
+    const unsigned fragment = 1480;
+    std::vector<unsigned char> payload(length);
+    for (unsigned i=0; i<length; ++i)
+        payload[i] = i;
+
+    Snoop::Options options;
+    IPV4Reassembler reassembler(options.fragment_memory, options.fragment_datagram_limit, options.fragment_timeout);
+    long now = 1000000000L;
+    long fragments = 0, mismatches = 0;
+    long before = allocations;
+    auto t0 = Clock::now();
+    for (long d=0; d<datagrams; d+=interleave)
+        for (unsigned offset=0; offset<length; offset+=fragment)
+            for (uint16_t i=0; i<interleave; ++i) {
+                IPV4Reassembler::Key key { 0x0a000001, 0x0a000002, uint16_t(d + i), IPPROTO_UDP };
+                unsigned n = std::min(fragment, length - offset);
+                unsigned datagram_length;
+                const unsigned char* datagram = reassembler.add(key, now += 1000, offset, offset + n < length,
+                                                                payload.data() + offset, n, datagram_length);
+                ++fragments;
+                if (datagram && (datagram_length != length || memcmp(datagram, payload.data(), length)))
+                    ++mismatches;
+            }
+    double elapsed = seconds_since(t0);
+    long count = allocations - before;
+    std::cerr << "fragments: " << elapsed * 1e9 / fragments << " ns per fragment, "
+              << double(count) / fragments << " allocations per fragment, "
+              << reassembler.get_stats().reassembled << " reassembled, "
+              << reassembler.get_stats().evictions << " evicted, "
+              << mismatches << " wrong\n";
+
+    IPV4Reassembler flooded(options.fragment_memory, options.fragment_datagram_limit, options.fragment_timeout);
+    before = allocations;
+    t0 = Clock::now();
+    for (long d=0; d<datagrams; ++d) {
+        IPV4Reassembler::Key key { uint32_t(d >> 16), 0x0a000002, uint16_t(d), IPPROTO_UDP };
+        unsigned datagram_length;
+        flooded.add(key, now += 1000, 0, true, payload.data(), fragment, datagram_length);
+    }
+    elapsed = seconds_since(t0);
+    count = allocations - before;
+    std::cerr << "fragments: flood " << elapsed * 1e9 / datagrams << " ns per fragment, "
+              << double(count) / datagrams << " allocations per fragment, "
+              << flooded.size() << " held, "
+              << flooded.get_stats().evictions << " evicted\n";
+}
+
+
+//  Build an Ethernet/IPv4/TCP frame.
+//
+static std::vector<unsigned char> tcp_frame(uint32_t src_ip, uint16_t src_port,
+                                            uint32_t dst_ip, uint16_t dst_port,
+                                            uint8_t flags, unsigned payload_length)
+{
+    std::vector<unsigned char> frame(sizeof(ether_header) + sizeof(ip) + sizeof(tcphdr) + payload_length);
+    ether_header* eth = reinterpret_cast<ether_header*>(frame.data());
+    const unsigned char src_mac[6] = { 0x02, 0, 0, 0, 0, 1 };
+    const unsigned char dst_mac[6] = { 0x02, 0, 0, 0, 0, 2 };
+    memcpy(eth->ether_shost, src_mac, 6);
+    memcpy(eth->ether_dhost, dst_mac, 6);
+    eth->ether_type = htons(0x0800);
+
+    ip* iph = reinterpret_cast<ip*>(eth + 1);
+    iph->ip_v = 4;
+    iph->ip_hl = 5;
+    iph->ip_len = htons(sizeof(ip) + sizeof(tcphdr) + payload_length);
+    iph->ip_p = IPPROTO_TCP;
+    iph->ip_src.s_addr = htonl(src_ip);
+    iph->ip_dst.s_addr = htonl(dst_ip);
+
+    tcphdr* tcp = reinterpret_cast<tcphdr*>(iph + 1);
+    tcp->th_sport = htons(src_port);
+    tcp->th_dport = htons(dst_port);
+    tcp->th_off = sizeof(tcphdr) / 4;
+    tcp->th_flags = flags;
+    return frame;
+}
+
+
+//  TCP connection tracking.  Opens :flows: connections with a handshake
+//  each, then sends :packets: data packets round robin across them.
+//  Reports nanoseconds per packet for each part, and the heap bytes per
+//  tracked connection, Snoop's and the Model's together.
+//
+static void bench_tcp(int argc, char** argv)
+{
+    long flows = argc > 0 ? std::atol(argv[0]) : 100000;
+    long packets = argc > 1 ? std::atol(argv[1]) : 10000000;
+    if (flows < 1)
+        throw std::invalid_argument("flows must be at least 1");
+
+    Model model;
+    Snoop snoop(model, Snoop::Options());
+    timeval ts { 1, 0 };
+    long tick = 0;
+    auto send = [&](std::vector<unsigned char>& frame, long flow, bool from_client) {
+        ts.tv_usec = tick % 1000000;
+        ts.tv_sec = 1 + tick / 1000000;
+        ++tick;
+        //  Each flow is its own client address and port.
+        ip* iph = reinterpret_cast<ip*>(frame.data() + sizeof(ether_header));
+        tcphdr* tcp = reinterpret_cast<tcphdr*>(iph + 1);
+        uint32_t client = htonl(0x0a010000 + flow / 60000);
+        uint16_t port = htons(1024 + flow % 60000);
+        if (from_client) {
+            iph->ip_src.s_addr = client;
+            tcp->th_sport = port;
+        }
+        else {
+            iph->ip_dst.s_addr = client;
+            tcp->th_dport = port;
+        }
+        snoop.parse_ethernet(ts, frame.data(), frame.size());
+    };
+
+    std::vector<unsigned char> syn = tcp_frame(0, 0, 0x0a000002, 443, TH_SYN, 0);
+    std::vector<unsigned char> syn_ack = tcp_frame(0x0a000002, 443, 0, 0, TH_SYN | TH_ACK, 0);
+    std::vector<unsigned char> ack = tcp_frame(0, 0, 0x0a000002, 443, TH_ACK, 0);
+    std::vector<unsigned char> data = tcp_frame(0, 0, 0x0a000002, 443, TH_ACK | TH_PUSH, 512);
+    std::vector<unsigned char> reply = tcp_frame(0x0a000002, 443, 0, 0, TH_ACK | TH_PUSH, 512);
+
+    //  Warm up so the model's one-time topology allocations aren't counted.
+    send(syn, flows, true);
+
+    //  Large blocks are mapped rather than carved from the heap.
+    auto heap_in_use = []() {
+        struct mallinfo2 info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+    };
+    size_t heap_before = heap_in_use();
+    auto t0 = Clock::now();
+    for (long f=0; f<flows; ++f) {
+        send(syn, f, true);
+        send(syn_ack, f, false);
+        send(ack, f, true);
+    }
+    double elapsed = seconds_since(t0);
+    size_t heap = heap_in_use() - heap_before;
+    std::cerr << "tcp: " << flows << " connections opened, "
+              << elapsed * 1e9 / (3 * flows) << " ns per handshake packet, "
+              << double(heap) / flows << " heap bytes per connection\n";
+
+    t0 = Clock::now();
+    for (long i=0; i<packets; ++i)
+        send(i % 2 ? reply : data, (i / 2) % flows, !(i % 2));
+    elapsed = seconds_since(t0);
+    std::cerr << "tcp: " << elapsed * 1e9 / packets << " ns per data packet, "
+              << snoop.get_stats().tcp_sessions << " tracked, "
+              << snoop.get_stats().dispositions[int(Disposition::TCP)] << " parsed to TCP\n";
+}
+
+
+//  The two forms of Traffic event, over the traffic of bench model:
+//  :hosts: hosts talking to :remotes: addresses at a million packets per
+//  second.  Reports for each form the bytes per second written, the
+//  Model's nanoseconds per packet, and the nanoseconds per Traffic event
+//  to read the events back and apply them as the viewer's
+//  NetworkModelSystem::receive(Traffic) does, less the drawing.
+//
+static void bench_traffic(int argc, char** argv)
+{
+    long packets = argc > 0 ? std::atol(argv[0]) : 2000000;
+    unsigned hosts = argc > 1 ? std::atoi(argv[1]) : 256;
+    unsigned remotes = argc > 2 ? std::atoi(argv[2]) : 16384;
+
+    auto ipv4 = [](uint32_t n) {
+        IPV4Address address;
+        for (int i=0; i<4; ++i)
+            address[3 - i] = n >> (8 * i);
+        return address;
+    };
+    const MacAddress router = mac(0xffffff);
+    std::vector<MacAddress> host_macs;
+    std::vector<IPV4Address> host_ips, remote_ips;
+    for (unsigned i=0; i<hosts; ++i) {
+        host_macs.push_back(mac(i + 1));
+        host_ips.push_back(ipv4(0x0a000001 + i));
+    }
+    for (unsigned i=0; i<remotes; ++i)
+        remote_ips.push_back(ipv4(0x40000000 + i * 0x1003));
+
+    for (bool maps : { true, false }) {
+        //  Write the events to a file.
+        char path[] = "/tmp/bench-traffic-XXXXXX";
+        int fd = mkstemp(path);
+        if (fd < 0)
+            throw std::runtime_error("mkstemp() failed");
+        unlink(path);
+        int saved_stdout = dup(1);
+        dup2(fd, 1);
+
+        double elapsed;
+        {
+            Model model;
+            model.traffic_maps(maps);
+            long now = 1000000000L;
+            uint64_t seed = 1;
+            auto t0 = Clock::now();
+            for (long i=0; i<packets; ++i) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                unsigned h = (seed >> 33) % hosts, r = (seed >> 17) % remotes;
+                model.note_time(now += 1000);
+                model.note_packet();
+                model.note_l2_packet_traffic(host_macs[h], router, 100);
+                model.note_ip_through_interface(host_ips[h], host_macs[h], 100);
+                model.note_ip_through_interface(remote_ips[r], router, 100);
+            }
+            model.flush();
+            elapsed = seconds_since(t0);
+        }
+        dup2(saved_stdout, 1);
+        close(saved_stdout);
+
+        std::vector<unsigned char> stream(lseek(fd, 0, SEEK_END));
+        if (pread(fd, stream.data(), stream.size(), 0) != ssize_t(stream.size()))
+            throw std::runtime_error("pread() failed");
+        close(fd);
+
+        //  Read back.  Like the viewer, map IDs to entities, keep the
+        //  previous counts for the map form, and glow by the packets since.
+        std::unordered_map<int, int> to_entity_ids;
+        std::unordered_map<int, long> packet_counts;
+        std::vector<long> glow;
+        long traffic_events = 0;
+        Lansnoop::Event event;
+        auto t1 = Clock::now();
+        for (size_t offset=0; offset+4<=stream.size(); ) {
+            uint32_t length;
+            memcpy(&length, stream.data() + offset, 4);
+            length = ntohl(length);
+            if (!event.ParseFromArray(stream.data() + offset + 4, length))
+                throw std::runtime_error("bad event");
+            offset += 4 + length;
+
+            if (event.has_interface())
+                to_entity_ids[event.interface().id()] = glow.size();
+            else if (event.has_ipaddress())
+                to_entity_ids[event.ipaddress().id()] = glow.size();
+            else if (event.has_cloud())
+                to_entity_ids[event.cloud().id()] = glow.size();
+            else if (!event.has_traffic())
+                continue;
+            if (!event.has_traffic()) {
+                glow.push_back(0);
+                continue;
+            }
+            ++traffic_events;
+            const Lansnoop::Traffic& traffic = event.traffic();
+            for (const auto* counts : { &traffic.interface_packet_counts(), &traffic.cloud_packet_counts(),
+                                        &traffic.ipaddress_packet_counts() })
+                for (const auto& [id, count] : *counts) {
+                    long dp = count - packet_counts[id];
+                    packet_counts[id] = count;
+                    if (dp)
+                        glow[to_entity_ids.at(id)] += dp;
+                }
+            for (const auto* deltas : { &traffic.interfaces(), &traffic.clouds(), &traffic.ipaddresses() }) {
+                long id = 0;
+                for (int i=0; i<deltas->ids_size(); ++i) {
+                    id += deltas->ids(i);
+                    glow[to_entity_ids.at(id)] += deltas->packets(i);
+                }
+            }
+        }
+        double read_elapsed = seconds_since(t1);
+
+        double seconds = packets * 1e-6;
+        std::cerr << "traffic: " << (maps ? "maps   " : "compact") << " "
+                  << stream.size() / seconds / 1e6 << " MB/s, "
+                  << elapsed * 1e9 / packets << " ns per packet to write, "
+                  << read_elapsed * 1e6 / traffic_events << " us per Traffic event to read, "
+                  << traffic_events << " Traffic events\n";
+    }
+}
+
+
+//  Points stdout at a pipe, and counts the events written to it on a reader thread.
+//
+class EventCounter {
+public:
+    long events = 0;
+    long bytes = 0;
+
+    EventCounter();
+    ~EventCounter() { stop(); }
+
+    //  Restore stdout and wait for the reader to see EOF.
+    //  Call after the Models writing events have been destroyed.
+    void stop();
+
+private:
+    int read_fd;
+    int saved_stdout = -1;
+    std::thread reader;
+
+    void read();
+};
+
+
+EventCounter::EventCounter()
+{
+    int fds[2];
+    if (pipe(fds))
+        throw std::runtime_error("pipe() failed");
+    this->read_fd = fds[0];
+    this->saved_stdout = dup(1);
+    dup2(fds[1], 1);
+    close(fds[1]);
+    this->reader = std::thread([this]() { this->read(); });
+}
+
+
+void EventCounter::stop()
+{
+    if (this->saved_stdout < 0)
+        return;
+    dup2(this->saved_stdout, 1);
+    close(this->saved_stdout);
+    this->saved_stdout = -1;
+    this->reader.join();
+}
+
+
+void EventCounter::read()
+{
+    std::vector<unsigned char> buffer(1024 * 1024);
+    unsigned char header[4];
+    unsigned header_bytes = 0;
+    size_t body_bytes = 0;  // Left to skip in the current event.
+    ssize_t n;
+    while ((n = ::read(this->read_fd, buffer.data(), buffer.size())) > 0) {
+        this->bytes += n;
+        for (ssize_t i=0; i<n; ) {
+            if (body_bytes) {
+                size_t skip = std::min<size_t>(body_bytes, n - i);
+                body_bytes -= skip;
+                i += skip;
+                continue;
+            }
+            header[header_bytes++] = buffer[i++];
+            if (header_bytes == 4) {
+                uint32_t length;
+                memcpy(&length, header, 4);
+                body_bytes = ntohl(length);
+                header_bytes = 0;
+                ++this->events;
+            }
+        }
+    }
+    close(this->read_fd);
+}
+
+
+//  The per-packet Model path for IPv4 traffic between :hosts: LAN hosts and
+//  :remotes: Internet addresses behind one router, as Snoop drives it.
+//  The model learns every address during a warm-up pass.  Reports
+//  nanoseconds per packet.
+//
+static void bench_model(int argc, char** argv)
+{
+    long packets = argc > 0 ? std::atol(argv[0]) : 2000000;
+    unsigned hosts = argc > 1 ? std::atoi(argv[1]) : 256;
+    unsigned remotes = argc > 2 ? std::atoi(argv[2]) : 16384;
+
+    auto ipv4 = [](uint32_t n) {
+        IPV4Address address;
+        for (int i=0; i<4; ++i)
+            address[3 - i] = n >> (8 * i);
+        return address;
+    };
+    const MacAddress router = mac(0xffffff);
+    std::vector<MacAddress> host_macs;
+    std::vector<IPV4Address> host_ips, remote_ips;
+    for (unsigned i=0; i<hosts; ++i) {
+        host_macs.push_back(mac(i + 1));
+        host_ips.push_back(ipv4(0x0a000001 + i));
+    }
+    for (unsigned i=0; i<remotes; ++i)
+        remote_ips.push_back(ipv4(0x40000000 + i * 0x1003));
+
+    Model model;
+    long now = 1000000000L;
+    auto packet = [&](unsigned h, unsigned r) {
+        model.note_time(now += 1000);
+        model.note_packet();
+        model.note_l2_packet_traffic(host_macs[h], router, 100);
+        model.note_ip_through_interface(host_ips[h], host_macs[h], 100);
+        model.note_ip_through_interface(remote_ips[r], router, 100);
+    };
+    for (unsigned i=0; i<std::max(hosts, remotes); ++i)
+        packet(i % hosts, i % remotes);
+
+    std::vector<std::pair<unsigned, unsigned>> pairs(1 << 16);
+    uint64_t seed = 1;
+    for (auto& pair : pairs) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        pair = { (seed >> 33) % hosts, (seed >> 17) % remotes };
+    }
+
+    auto t0 = Clock::now();
+    for (long i=0; i<packets; ++i) {
+        const auto& pair = pairs[i & (pairs.size() - 1)];
+        packet(pair.first, pair.second);
+    }
+    double elapsed = seconds_since(t0);
+
+    std::cerr << "model: " << packets << " packets, "
+              << hosts << " hosts, "
+              << remotes << " remote addresses, "
+              << elapsed * 1e9 / packets << " ns per packet\n";
+}
+
+
+//  A flat L2 segment discovered one host at a time.  Each new host first
+//  appears alone on its own network, then talks to the first host, merging
+//  its network with everyone else's.  Reports the time and events taken.
+//
+static void bench_merge(int argc, char** argv)
+{
+    long hosts = argc > 0 ? std::atol(argv[0]) : 20000;
+
+    const MacAddress broadcast { { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } };
+
+    EventCounter counter;
+    auto t0 = Clock::now();
+    {
+        Model model;
+        model.note_l2_packet_traffic(mac(0), broadcast, 64);
+        for (long i=1; i<hosts; ++i) {
+            model.note_l2_packet_traffic(mac(i), broadcast, 64);
+            model.note_l2_packet_traffic(mac(i), mac(0), 64);
+        }
+    }
+    counter.stop();
+    double elapsed = seconds_since(t0);
+
+    std::cerr << "merge: " << hosts << " hosts, "
+              << counter.events << " events in "
+              << elapsed << " s\n";
+}
+
+
+//  Snoops on several threads sharing one Model, as with --threads: bench
+//  model's traffic as UDP frames, each shard parsing its own flows and
+//  merging its Model calls every :block: frames, as after each ring block.
+//  Reports thousands of packets per second for 1, 2 and 4 shards, and for
+//  one Snoop calling the Model directly, and the nanoseconds per packet
+//  spent merging, which holds the Model's lock and so doesn't scale.
+//
+static void bench_shards(int argc, char** argv)
+{
+    long packets = argc > 0 ? std::atol(argv[0]) : 4000000;
+    unsigned hosts = argc > 1 ? std::atoi(argv[1]) : 256;
+    unsigned remotes = argc > 2 ? std::atoi(argv[2]) : 16384;
+    unsigned block = argc > 3 ? std::atoi(argv[3]) : 1024;
+    if (hosts < 1 || remotes < 1 || block < 1)
+        throw std::invalid_argument("hosts, remotes and block must be at least 1");
+
+    //  Each shard's frames, between random hosts and remote addresses
+    //  behind a router, half of them replies.
+    const unsigned frames_per_shard = 1 << 14;
+    const unsigned max_shards = 4;
+    std::vector<std::vector<std::vector<unsigned char>>> frames(max_shards);
+    uint64_t seed = 1;
+    for (unsigned t=0; t<max_shards; ++t)
+        for (unsigned i=0; i<frames_per_shard; ++i) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            unsigned h = (seed >> 33) % hosts;
+            unsigned r = (seed >> 17) % remotes;
+            uint16_t port = 1024 + (t * frames_per_shard + i) / 2 % 60000;
+            MacAddress host_mac = mac(h + 1);
+            MacAddress router = mac(0xffffff);
+            bool reply = i % 2;
+            std::vector<unsigned char> frame = reply
+                ? udp_frame(0x40000000 + r * 0x1003, 443, 0x0a000001 + h, port, 100)
+                : udp_frame(0x0a000001 + h, port, 0x40000000 + r * 0x1003, 443, 100);
+            ether_header* eth = reinterpret_cast<ether_header*>(frame.data());
+            memcpy(eth->ether_shost, (reply ? router : host_mac).data(), 6);
+            memcpy(eth->ether_dhost, (reply ? host_mac : router).data(), 6);
+            frames[t].push_back(std::move(frame));
+        }
+
+    auto run = [&](unsigned shards, bool batch) {
+        Model model;
+        Snoop::Options options;
+        options.batch_model = batch;
+        std::vector<std::unique_ptr<Snoop>> snoops;
+        for (unsigned t=0; t<shards; ++t)
+            snoops.emplace_back(new Snoop(model, options));
+
+        //  Each shard's clock runs on from where the last pass left it.
+        std::vector<long> ticks(shards);
+        std::vector<double> merging(shards);
+        auto merge = [&](unsigned t) {
+            auto m0 = Clock::now();
+            snoops[t]->merge();
+            merging[t] += seconds_since(m0);
+        };
+        auto pass = [&](unsigned t, long count) {
+            Snoop& snoop = *snoops[t];
+            const std::vector<std::vector<unsigned char>>& mine = frames[t];
+            for (long i=0; i<count; ++i) {
+                long tick = ticks[t]++;
+                timeval ts { 1 + tick / 1000000, tick % 1000000 };
+                const std::vector<unsigned char>& frame = mine[i % mine.size()];
+                snoop.parse_ethernet(ts, frame.data(), frame.size());
+                if ((i + 1) % block == 0)
+                    merge(t);
+            }
+            merge(t);
+        };
+
+        //  Warm up, so the Model knows every address.
+        for (unsigned t=0; t<shards; ++t)
+            pass(t, frames_per_shard);
+        std::fill(merging.begin(), merging.end(), 0);
+
+        auto t0 = Clock::now();
+        std::vector<std::thread> workers;
+        for (unsigned t=0; t<shards; ++t)
+            workers.emplace_back([&, t]() { pass(t, packets / shards); });
+        for (std::thread& worker : workers)
+            worker.join();
+        double elapsed = seconds_since(t0);
+        long timed = packets / shards * shards;
+
+        std::cerr << "shards: " << shards << (batch ? " batching" : " direct")
+                  << ", " << timed / elapsed / 1e3 << " kpps";
+        if (batch) {
+            double merged = 0;
+            for (double m : merging)
+                merged += m;
+            std::cerr << ", " << merged * 1e9 / timed << " ns per packet merging";
+        }
+        std::cerr << "\n";
+    };
+
+    std::cerr << "shards: " << packets << " packets, "
+              << hosts << " hosts, "
+              << remotes << " remote addresses, "
+              << "merging every " << block << " frames, "
+              << std::thread::hardware_concurrency() << " CPUs\n";
+    run(1, false);
+    for (unsigned shards : { 1, 2, 4 })
+        run(shards, true);
+}
+
+
+//  Longest prefix match over a prefix table such as APNIC's data-raw-table.
+//  Compares look_up() and the old look_up_sorted() binary search, for
+//  speed and against a brute force reference for correctness.  Addresses
+//  are half uniformly random, half inside random prefixes.
+//
+static void bench_prefix(int argc, char** argv)
+{
+    using Prefix = IPV4PrefixTable::Prefix;
+    if (argc < 1)
+        throw std::invalid_argument("prefix expects a prefix table file");
+    long lookups = argc > 1 ? std::atol(argv[1]) : 10000000;
+
+    IPV4PrefixTable table;
+    auto t0 = Clock::now();
+    table.load(argv[0]);
+    const std::vector<Prefix>& prefixes = table.get_prefixes();
+    std::cerr << "prefix: " << prefixes.size() << " prefixes loaded in " << seconds_since(t0) << " s\n";
+    if (prefixes.empty())
+        return;
+
+    //  Reference: look up each prefix length, longest first.
+    std::vector<std::unordered_map<uint32_t, const Prefix*>> by_length(33);
+    for (const Prefix& prefix : prefixes)
+        by_length[__builtin_popcount(prefix.netmask)][prefix.address] = &prefix;
+    auto reference = [&](uint32_t address) -> const Prefix* {
+        for (int length=32; length>=0; --length) {
+            uint32_t netmask = length ? 0xffffffffU << (32 - length) : 0;
+            auto it = by_length[length].find(address & netmask);
+            if (it != by_length[length].end())
+                return it->second;
+        }
+        return nullptr;
+    };
+    //  Duplicate prefixes may differ in ASN.  Either is right.
+    auto same = [](const Prefix* a, const Prefix* b) {
+        return a == b || (a && b && a->address == b->address && a->netmask == b->netmask);
+    };
+
+    std::vector<uint32_t> addresses(1 << 20);
+    uint64_t seed = 1;
+    for (size_t i=0; i<addresses.size(); ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint32_t random = seed >> 32;
+        if (i % 2)
+            addresses[i] = random;
+        else {
+            const Prefix& prefix = prefixes[(seed >> 8) % prefixes.size()];
+            addresses[i] = prefix.address | (random & ~prefix.netmask);
+        }
+    }
+
+    long wrong = 0, wrong_sorted = 0, found = 0;
+    for (uint32_t address : addresses) {
+        const Prefix* expected = reference(address);
+        found += expected != nullptr;
+        wrong += !same(table.look_up(address), expected);
+        wrong_sorted += !same(table.look_up_sorted(address), expected);
+    }
+    std::cerr << "prefix: " << addresses.size() << " addresses checked, " << found << " matched\n";
+
+    auto time = [&](const char* name, const Prefix* (IPV4PrefixTable::*look_up)(uint32_t) const, long wrong) {
+        uint64_t sum = 0;  // Keeps the look ups from being optimized away.
+        auto t0 = Clock::now();
+        for (long i=0; i<lookups; ++i) {
+            const Prefix* prefix = (table.*look_up)(addresses[i & (addresses.size() - 1)]);
+            sum += prefix ? prefix->asn : 0;
+        }
+        double elapsed = seconds_since(t0);
+        std::cerr << "prefix: " << name << ": "
+                  << lookups / elapsed / 1e6 << " M lookups/s, "
+                  << wrong << " wrong (checksum " << sum << ")\n";
+    };
+    time("look_up()       ", &IPV4PrefixTable::look_up, wrong);
+    time("look_up_sorted()", &IPV4PrefixTable::look_up_sorted, wrong_sorted);
+}
+
+
+//  Longest prefix match over an IPv6 prefix table such as APNIC's
+//  ipv6-raw-table, for speed and against a brute force reference for
+//  correctness.  Addresses are half uniformly random within 2000::/3,
+//  half inside random prefixes.
+//
+static void bench_prefix6(int argc, char** argv)
+{
+    using Prefix = IPV6PrefixTable::Prefix;
+    if (argc < 1)
+        throw std::invalid_argument("prefix6 expects a prefix table file");
+    long lookups = argc > 1 ? std::atol(argv[1]) : 10000000;
+
+    IPV6PrefixTable table;
+    auto t0 = Clock::now();
+    table.load(argv[0]);
+    const std::vector<Prefix>& prefixes = table.get_prefixes();
+    std::cerr << "prefix6: " << prefixes.size() << " prefixes loaded in " << seconds_since(t0) << " s, "
+              << table.get_starts().size() << " ranges\n";
+    if (prefixes.empty())
+        return;
+
+    auto mask = [](uint32_t length) {
+        return length ? ~uint128_t(0) << (128 - length) : uint128_t(0);
+    };
+    //  Reference: look up each prefix length, longest first.
+    std::vector<std::map<uint128_t, const Prefix*>> by_length(129);
+    for (const Prefix& prefix : prefixes)
+        by_length[prefix.length][prefix.address] = &prefix;
+    auto reference = [&](uint128_t address) -> const Prefix* {
+        for (int length=128; length>=0; --length) {
+            if (by_length[length].empty())
+                continue;
+            auto it = by_length[length].find(address & mask(length));
+            if (it != by_length[length].end())
+                return it->second;
+        }
+        return nullptr;
+    };
+    auto same = [](const Prefix* a, const Prefix* b) {
+        return a == b || (a && b && a->address == b->address && a->length == b->length);
+    };
+
+    std::vector<uint128_t> addresses(1 << 20);
+    uint64_t seed = 1;
+    auto random = [&seed]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return seed;
+    };
+    for (size_t i=0; i<addresses.size(); ++i) {
+        uint128_t r = (uint128_t(random()) << 64) | random();
+        if (i % 2)
+            addresses[i] = (uint128_t(1) << 125) | (r >> 3);
+        else {
+            const Prefix& prefix = prefixes[random() % prefixes.size()];
+            addresses[i] = prefix.address | (r & ~mask(prefix.length));
+        }
+    }
+
+    long wrong = 0, found = 0;
+    for (uint128_t address : addresses) {
+        const Prefix* expected = reference(address);
+        found += expected != nullptr;
+        wrong += !same(table.look_up(address), expected);
+    }
+    std::cerr << "prefix6: " << addresses.size() << " addresses checked, " << found << " matched\n";
+
+    uint64_t sum = 0;  // Keeps the look ups from being optimized away.
+    t0 = Clock::now();
+    for (long i=0; i<lookups; ++i) {
+        const Prefix* prefix = table.look_up(addresses[i & (addresses.size() - 1)]);
+        sum += prefix ? prefix->asn : 0;
+    }
+    double elapsed = seconds_since(t0);
+    std::cerr << "prefix6: look_up() " << elapsed * 1e9 / lookups << " ns per look up, "
+              << wrong << " wrong (" << sum % 10 << ")\n";
+}
+
+
+//  Reference table reloads while packets keep coming.  Each reload maps
+//  the tables from :db: (untimed, as the reloader thread would) and hands
+//  them to the model, which switches to them and re-annotates its
+//  addresses a batch per packet.  Reports the median over the reloads of
+//  the slowest of the 1000 packets after the hand over, and for
+//  comparison the slowest of the 1000 packets before it.
+//
+static void bench_reload(int argc, char** argv)
+{
+    if (argc < 1)
+        throw std::invalid_argument("reload expects a reference database file");
+    ReferenceDB::Sources sources;
+    sources.db_path = argv[0];
+    unsigned remotes = argc > 1 ? std::atoi(argv[1]) : 16384;
+    const int reloads = 15;
+    const int window = 1000;
+
+    auto ipv4 = [](uint32_t n) {
+        IPV4Address address;
+        for (int i=0; i<4; ++i)
+            address[3 - i] = n >> (8 * i);
+        return address;
+    };
+    const MacAddress host = mac(1), router = mac(0xffffff);
+    const IPV4Address host_ip = ipv4(0x0a000001);
+    std::vector<IPV4Address> remote_ips;
+    for (unsigned i=0; i<remotes; ++i)
+        remote_ips.push_back(ipv4(0x40000000 + i * 0x1003));
+
+    Model model;
+    model.set_reference(ReferenceDB::load(sources));
+    long now = 1000000000L;
+    long packets = 0;
+    auto packet = [&]() {
+        auto t0 = Clock::now();
+        model.note_time(now += 1000);
+        model.note_packet();
+        model.note_l2_packet_traffic(host, router, 100);
+        model.note_ip_through_interface(host_ip, host, 100);
+        model.note_ip_through_interface(remote_ips[packets++ % remotes], router, 100);
+        return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+    };
+    for (unsigned i=0; i<remotes; ++i)
+        packet();
+    model.take_retired_reference();
+
+    std::vector<double> before, after;
+    for (int r=0; r<reloads; ++r) {
+        double slowest = 0;
+        for (int i=0; i<window; ++i)
+            slowest = std::max(slowest, packet());
+        before.push_back(slowest);
+
+        model.set_reference(ReferenceDB::load(sources));
+        slowest = 0;
+        for (int i=0; i<window; ++i)
+            slowest = std::max(slowest, packet());
+        after.push_back(slowest);
+        model.take_retired_reference();
+    }
+    auto median = [](std::vector<double>& v) {
+        std::sort(v.begin(), v.end());
+        return v[v.size() / 2];
+    };
+
+    std::cerr << "reload: " << remotes << " remote addresses, slowest packet "
+              << median(before) << " us before a reload, "
+              << median(after) << " us after\n";
+}
+
+
+//  Replay pcap files through Snoop, :repeat: times each with a fresh Model,
+//  writing events into a pipe.  A reader thread drains the pipe and counts
+//  events, like the viewer would.  Reports events per second.
+//
+static void bench_events(int argc, char** argv)
+{
+    if (argc < 2)
+        throw std::invalid_argument("events expects a repeat count and one or more pcap files");
+    long repeat = std::atol(argv[0]);
+
+    struct Frame {
+        timeval ts;
+        std::vector<unsigned char> data;
+    };
+    std::vector<std::vector<Frame>> captures;
+    for (int i=1; i<argc; ++i) {
+        char errbuf[PCAP_ERRBUF_SIZE];
+        pcap_t* libpcap = pcap_open_offline(argv[i], errbuf);
+        if (!libpcap)
+            throw std::invalid_argument(errbuf);
+        captures.emplace_back();
+        pcap_pkthdr* hdr;
+        const u_char* data;
+        while (pcap_next_ex(libpcap, &hdr, &data) == 1)
+            captures.back().push_back(Frame { hdr->ts, std::vector<unsigned char>(data, data + hdr->caplen) });
+        pcap_close(libpcap);
+    }
+
+    EventCounter counter;
+    long packets = 0;
+    auto t0 = Clock::now();
+    for (long r=0; r<repeat; ++r)
+        for (const std::vector<Frame>& capture : captures) {
+            Model model;
+            Snoop snoop(model, Snoop::Options());
+            for (const Frame& frame : capture)
+                snoop.parse_ethernet(frame.ts, frame.data.data(), frame.data.size());
+            packets += capture.size();
+        }
+    counter.stop();
+    double elapsed = seconds_since(t0);
+
+    long events = counter.events;
+    std::cerr << "events: " << packets << " packets, "
+              << events << " events, "
+              << counter.bytes << " bytes in "
+              << elapsed << " s, "
+              << events / elapsed << " events/s\n";
+}
+
+
+//  DNS response parsing, over the DNS messages in pcap files such as
+//  test/dns.pcap and test/dns-ptr.pcap, each parsed :repeat: times.
+//  The names go to one Model, which has seen them all after the first
+//  pass.  Reports nanoseconds and heap allocations per message.
+//
+static void bench_dns(int argc, char** argv)
+{
+    if (argc < 2)
+        throw std::invalid_argument("dns expects a repeat count and one or more pcap files");
+    long repeat = std::atol(argv[0]);
+
+    //  UDP payloads to or from port 53 or 5353.
+    std::vector<std::vector<unsigned char>> messages;
+    for (int i=1; i<argc; ++i) {
+        char errbuf[PCAP_ERRBUF_SIZE];
+        pcap_t* libpcap = pcap_open_offline(argv[i], errbuf);
+        if (!libpcap)
+            throw std::invalid_argument(errbuf);
+        pcap_pkthdr* hdr;
+        const u_char* data;
+        while (pcap_next_ex(libpcap, &hdr, &data) == 1) {
+            const u_char* end = data + hdr->caplen;
+            const ether_header* eth = reinterpret_cast<const ether_header*>(data);
+            const ip* iph = reinterpret_cast<const ip*>(eth + 1);
+            if (hdr->caplen < sizeof(ether_header) + sizeof(ip) || ntohs(eth->ether_type) != 0x0800 || iph->ip_p != IPPROTO_UDP)
+                continue;
+            const udphdr* udp = reinterpret_cast<const udphdr*>(reinterpret_cast<const u_char*>(iph) + 4 * iph->ip_hl);
+            const u_char* payload = reinterpret_cast<const u_char*>(udp + 1);
+            if (payload > end)
+                continue;
+            for (unsigned port : { ntohs(udp->uh_sport), ntohs(udp->uh_dport) })
+                if (port == 53 || port == 5353) {
+                    messages.emplace_back(payload, end);
+                    break;
+                }
+        }
+        pcap_close(libpcap);
+    }
+    if (messages.empty())
+        throw std::invalid_argument("dns found no DNS messages");
+
+    Model model;
+    Snoop snoop(model, Snoop::Options());
+    ProtocolDNS& dns = ProtocolDNS::instance();
+    for (const std::vector<unsigned char>& message : messages)
+        dns.put(snoop, 0, message.data(), message.size());
+
+    long before = allocations;
+    auto t0 = Clock::now();
+    for (long r=0; r<repeat; ++r)
+        for (const std::vector<unsigned char>& message : messages)
+            dns.put(snoop, 0, message.data(), message.size());
+    double elapsed = seconds_since(t0);
+    long count = allocations - before;
+    long parsed = repeat * messages.size();
+
+    std::cerr << "dns: " << messages.size() << " messages, "
+              << parsed << " parsed, "
+              << elapsed * 1e9 / parsed << " ns per message, "
+              << double(count) / parsed << " allocations per message\n";
+}
+
+
+//  DNS latency tracking at :qps: queries per second for :seconds: of
+//  simulated time: 256 clients querying 4 resolvers, each query from a
+//  new source port.  Responses come 1-50ms later, except for one query
+//  in a hundred, which times out.  Over IPv6 if :ipv6: is "ipv6".  Reports
+//  nanoseconds per packet and the most queries awaiting a response at once.
+//
+static void bench_dns_latency(int argc, char** argv)
+{
+    double seconds = argc > 0 ? std::atof(argv[0]) : 10;
+    long qps = argc > 1 ? std::atol(argv[1]) : 100000;
+    bool ipv6 = argc > 2 && std::string(argv[2]) == "ipv6";
+    long queries = long(seconds * qps);
+
+    //  Send times of queries and responses, in order.  Negative indexes are responses.
+    struct Send {
+        long time;
+        long query;
+        bool operator <(const Send& rhs) const { return this->time < rhs.time; }
+    };
+    std::vector<Send> schedule;
+    long unanswered = 0;
+    for (long i=0; i<queries; ++i) {
+        long sent = 1000000000L + i * 1000000000L / qps;
+        schedule.push_back(Send { sent, i });
+        if (i % 100 == 99)
+            ++unanswered;
+        else
+            schedule.push_back(Send { sent + (1 + (i * 37) % 50) * 1000000L, -1 - i });
+    }
+    std::stable_sort(schedule.begin(), schedule.end());
+
+    Model model;
+    Snoop snoop(model, Snoop::Options());
+    std::vector<unsigned char> frame = ipv6 ? udp6_frame(IPV6Address(), 0, IPV6Address(), 0, 12, false)
+                                            : udp_frame(0, 0, 0, 0, 12);
+    ip* iph = reinterpret_cast<ip*>(frame.data() + sizeof(ether_header));
+    ip6_hdr* ip6h = reinterpret_cast<ip6_hdr*>(frame.data() + sizeof(ether_header));
+    udphdr* udp = ipv6 ? reinterpret_cast<udphdr*>(ip6h + 1) : reinterpret_cast<udphdr*>(iph + 1);
+    uint16_t* dns = reinterpret_cast<uint16_t*>(udp + 1);
+
+    long most_awaiting = 0;
+    auto t0 = Clock::now();
+    for (size_t n=0; n<schedule.size(); ++n) {
+        const Send& send = schedule[n];
+        bool response = send.query < 0;
+        long i = response ? -1 - send.query : send.query;
+        uint32_t client = htonl(0x0a000100 + i % 256);
+        uint32_t resolver = htonl(0x08080800 + i % 4);
+        uint16_t client_port = htons(1024 + i % 60000);
+        if (ipv6) {
+            //  2001:db8::<address>.
+            unsigned char* src = reinterpret_cast<unsigned char*>(&ip6h->ip6_src);
+            unsigned char* dst = reinterpret_cast<unsigned char*>(&ip6h->ip6_dst);
+            src[0] = dst[0] = 0x20;
+            src[1] = dst[1] = 0x01;
+            src[2] = dst[2] = 0x0d;
+            src[3] = dst[3] = 0xb8;
+            memcpy(src + 12, response ? &resolver : &client, 4);
+            memcpy(dst + 12, response ? &client : &resolver, 4);
+        }
+        else {
+            iph->ip_src.s_addr = response ? resolver : client;
+            iph->ip_dst.s_addr = response ? client : resolver;
+        }
+        udp->uh_sport = response ? htons(53) : client_port;
+        udp->uh_dport = response ? client_port : htons(53);
+        dns[0] = htons(i);
+        dns[1] = htons(response ? 0x8180 : 0x0100);
+
+        timeval ts { send.time / 1000000000L, (send.time % 1000000000L) / 1000 };
+        snoop.parse_ethernet(ts, frame.data(), frame.size());
+        if (n % 1024 == 0)
+            most_awaiting = std::max(most_awaiting, snoop.get_stats().dns_queries);
+    }
+    double elapsed = seconds_since(t0);
+    const Snoop::Stats& stats = snoop.get_stats();
+
+    std::cerr << "dns-latency: " << queries << " queries, "
+              << elapsed * 1e9 / schedule.size() << " ns per packet, "
+              << "at most " << most_awaiting << " awaiting a response, "
+              << stats.dns_timeouts << " timed out and "
+              << stats.dns_queries << " still awaiting of " << unanswered << " unanswered, "
+              << stats.dns_sheds << " shed\n";
+}
+
+
+int main(int argc, char** argv)
+{
+    //  Swallow Model's event output.
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) {
+        dup2(null_fd, 1);
+        close(null_fd);
+    }
+
+    const std::map<std::string, void (*)(int, char**)> benchmarks {
+        { "dns", bench_dns },
+        { "dns-latency", bench_dns_latency },
+        { "events", bench_events },
+        { "fragments", bench_fragments },
+        { "merge", bench_merge },
+        { "model", bench_model },
+        { "parse", bench_parse },
+        { "prefix", bench_prefix },
+        { "prefix6", bench_prefix6 },
+        { "reload", bench_reload },
+        { "shards", bench_shards },
+        { "tcp", bench_tcp },
+        { "traffic", bench_traffic },
+        { "udp-alloc", bench_udp_alloc },
+    };
+
+    if (argc < 2 || !benchmarks.count(argv[1])) {
+        std::cerr << "Usage: " << argv[0] << " benchmark [args]\n";
+        std::cerr << "Benchmarks:\n";
+        std::cerr << "  dns repeat pcap...     DNS response parsing speed and allocations, replaying pcap files.\n";
+        std::cerr << "  dns-latency [seconds] [qps] [ipv6]\n";
+        std::cerr << "                         Nanoseconds per packet tracking DNS query latency, and queries awaiting a response.\n";
+        std::cerr << "  events repeat pcap...  Events per second written to a pipe, replaying pcap files.\n";
+        std::cerr << "  fragments [datagrams] [interleave]\n";
+        std::cerr << "                         Nanoseconds and allocations per IPv4 fragment reassembled, and in a flood of incomplete datagrams.\n";
+        std::cerr << "  merge [hosts]          Time and events to merge each new host's network into a flat L2 segment.\n";
+        std::cerr << "  model [packets] [hosts] [remotes]\n";
+        std::cerr << "                         Nanoseconds per packet in the Model, IPv4 traffic to remote addresses.\n";
+        std::cerr << "  parse [packets]        Nanoseconds per packet parsing known UDP flows over IPv4, VLAN-tagged IPv4 and IPv6.\n";
+        std::cerr << "  prefix file [lookups]  Longest prefix match speed and correctness on a prefix table.\n";
+        std::cerr << "  prefix6 file [lookups] Longest prefix match speed and correctness on an IPv6 prefix table.\n";
+        std::cerr << "  reload db [remotes]    Slowest packet after handing the model reference tables reloaded from a database.\n";
+        std::cerr << "  shards [packets] [hosts] [remotes] [block]\n";
+        std::cerr << "                         Thousands of packets per second for 1, 2 and 4 threads sharing one Model.\n";
+        std::cerr << "  tcp [flows] [packets]  Nanoseconds per packet tracking TCP connections, and heap bytes per connection.\n";
+        std::cerr << "  traffic [packets] [hosts] [remotes]\n";
+        std::cerr << "                         Bytes per second, and time to write and read, of each form of Traffic event.\n";
+        std::cerr << "  udp-alloc [packets]    Heap allocations per million packets of new UDP flows.\n";
+        return 1;
+    }
+
+    try {
+        benchmarks.at(argv[1])(argc - 2, argv + 2);
+    }
+    catch (const std::exception& e) {
+        std::cerr << argv[0] << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,23 +1,62 @@
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <cstring>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include <signal.h>
+#include <unistd.h>
 #include <pcap.h>
 
 #include "EventSerialization.hpp"
+#include "EventWriter.hpp"
 #include "IPV4PrefixTable.hpp"
+#include "PacketQueue.hpp"
+#include "PacketRing.hpp"
+#include "ReferenceReloader.hpp"
 #include "Snoop.hpp"
 
 
 static pcap_t* global_libpcap = nullptr;
 
+//  The capture threads' rings, for signal_handler() to stop.  A fixed
+//  array of lock-free atomics, so that the handler can read it safely
+//  while it's being filled or emptied.
+static constexpr unsigned max_threads = 64;
+static std::atomic<PacketRing*> global_rings[max_threads];
+
+//  Empties global_rings when it goes out of scope, however it leaves.
+//  Declare it after the rings, so that it runs before they're destroyed.
+struct GlobalRingsGuard {
+    ~GlobalRingsGuard() {
+        for (std::atomic<PacketRing*>& ring : global_rings)
+            ring.store(nullptr);
+    }
+};
+
+
+struct QueueUser {
+    PacketQueue* queue;
+    bool live_capture;
+};
+
 
 extern "C" {
     static void pcap_callback(u_char *user, const struct pcap_pkthdr *hdr, const u_char *frame)
     {
-        reinterpret_cast<Snoop*>(user)->parse_ethernet(hdr->ts, frame, hdr->caplen);
+        reinterpret_cast<Snoop*>(user)->parse_ethernet(hdr->ts, frame, hdr->caplen, hdr->len);
+    }
+
+    static void queue_callback(u_char *user, const struct pcap_pkthdr *hdr, const u_char *frame)
+    {
+        //  Drop frames when live and the parser can't keep up.
+        //  Wait for the parser when reading from a file.
+        QueueUser* qu = reinterpret_cast<QueueUser*>(user);
+        qu->queue->push(hdr->ts, frame, hdr->caplen, hdr->len, !qu->live_capture);
     }
 }
 
@@ -40,6 +79,9 @@ static void signal_handler(int sig, siginfo_t*, void*)
      */
     if (global_libpcap)
         pcap_breakloop(global_libpcap);
+    for (std::atomic<PacketRing*>& slot : global_rings)
+        if (PacketRing* ring = slot.load())
+            ring->break_loop();
 }
 
 
@@ -55,7 +97,7 @@ static void register_signal_handler()
 }
 
 
-static void capture(pcap_t* libpcap, bool live_capture, Snoop* snoop)
+static void capture(pcap_t* libpcap, bool live_capture, pcap_handler callback, u_char* user_data)
 {
     //  Fail if the packets are anyting other than Ethernet.
     //
@@ -70,9 +112,8 @@ static void capture(pcap_t* libpcap, bool live_capture, Snoop* snoop)
 
     int ret = 0;
     int idle_count = 0;
-    u_char* user_data = reinterpret_cast<u_char*>(snoop);
     for (;;) {
-        ret = pcap_dispatch(libpcap, -1, pcap_callback, user_data);
+        ret = pcap_dispatch(libpcap, -1, callback, user_data);
 
         if (-1 == ret) {
             break; //  Error.  Handle below.
@@ -89,9 +130,9 @@ static void capture(pcap_t* libpcap, bool live_capture, Snoop* snoop)
             //  If libpcap's idle timeout is 1ms, this will happen
             //  at most every 10ms.
             if (++idle_count > 10) {
-                struct timeval now;
-                gettimeofday(&now, NULL);
-                snoop->parse_ethernet(now, NULL, 0);
+                struct pcap_pkthdr hdr = {};
+                gettimeofday(&hdr.ts, NULL);
+                callback(user_data, &hdr, NULL);
                 idle_count = 0;
             }
         }
@@ -110,6 +151,49 @@ static void capture(pcap_t* libpcap, bool live_capture, Snoop* snoop)
 }
 
 
+//  Capture on one thread, copying frames into a queue.
+//  Parse on this thread, draining the queue in batches.
+//  A slow Model::emit() then no longer stalls pcap_dispatch().
+//
+static void capture_queued(pcap_t* libpcap, bool live_capture, Snoop* snoop, size_t queue_bytes)
+{
+    PacketQueue queue(queue_bytes);
+    QueueUser user { &queue, live_capture };
+    std::exception_ptr error;
+
+    std::thread capture_thread([&]() {
+        try {
+            capture(libpcap, live_capture, queue_callback, reinterpret_cast<u_char*>(&user));
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        queue.close();
+    });
+
+    const size_t batch = 256;
+    for (;;) {
+        bool closed = queue.is_closed();
+        size_t n = queue.drain(batch, [snoop](const PacketQueue::Record& record) {
+            if (record.type == PacketQueue::Record::TICK)
+                snoop->parse_ethernet(record.ts, NULL, 0);
+            else
+                snoop->parse_ethernet(record.ts, record.frame(), record.length, record.wire_length);
+        });
+        snoop->note_queue(queue.capacity(), queue.occupancy(), queue.high_water(), queue.drops(), queue.truncations());
+        if (!n) {
+            if (closed)
+                break;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    capture_thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+
 static pcap_t* read_interface(const std::string &nic)
 {
     int ret;
@@ -159,15 +243,54 @@ static pcap_t* read_interface(const std::string &nic)
 
 static void usage(const char* argv0, std::ostream& out)
 {
-    out << "Usage: " << argv0 << " [-v] [-i interface] [--oui oui_file] [--prefix fild] [--asn file] [-r pcap_file]" << std::endl;
+    out << "Usage: " << argv0 << " [-v] [-i interface [--ring] [--ring-block-size bytes] [--ring-block-count n] [--threads n]] [--queue megabytes] [--udp-sessions n] [--udp-idle seconds] [--tcp-sessions n] [--tcp-idle seconds] [--dns-queries n] [--dns-timeout seconds] [--fragment-memory megabytes] [--fragment-timeout seconds] [--flush-usec usec] [--oui oui_file] [--prefix fild] [--prefix6 file] [--asn file] [--db db_file] [--compile-db db_file] [-r pcap_file]" << std::endl;
     out << "Writes binary network activity to stdout." << std::endl;
     out << std::endl;
     out << "  -i          Read packets from the named interface." << std::endl;
     out << "  --asn       Load ASN table from file." << std::endl;
+    out << "  --compile-db" << std::endl;
+    out << "              Write the --oui, --prefix, --prefix6 and --asn tables to the named reference" << std::endl;
+    out << "              database file, for --db, and exit." << std::endl;
+    out << "  --db        Map the named reference database file written by --compile-db," << std::endl;
+    out << "              instead of loading --oui, --prefix, --prefix6 and --asn." << std::endl;
+    out << "              Send snoop a SIGHUP to reload whichever of these it was given." << std::endl;
     out << "  --oui       Load OUI information from the named CSV file." << std::endl;
     out << "  --prefix    Load network prefix table named file." << std::endl;
-    out << "  --one-lan   Assume all interfaces the same logical Ethenet network." << std::endl;
+    out << "  --prefix6   Load IPv6 network prefix table named file." << std::endl;
+    out << "  --flush-usec" << std::endl;
+    out << "              Write events out at most this many microseconds after they happen." << std::endl;
+    out << "              Default " << EventWriter::default_flush_usec << ".  0 writes each event immediately." << std::endl;
+    out << "              When stdout is a pipe or socket, it's made nonblocking until snoop exits, so a" << std::endl;
+    out << "              slow reader doesn't stall capture.  Unless stderr goes to the same place (2>&1):" << std::endl;
+    out << "              then stdout is left blocking, and a slow reader stalls capture." << std::endl;
+    out << "  --one-lan   Assume all interfaces in a VLAN the same logical Ethenet network." << std::endl;
+    out << "  --queue     Capture on a separate thread, queueing up to this many megabytes" << std::endl;
+    out << "              of frames for the parser.  Not used with --ring." << std::endl;
     out << "  -r          Read packets from the named libpcap savefile." << std::endl;
+    out << "  --traffic-maps" << std::endl;
+    out << "              Send traffic counts in the older, larger form: maps of whole counts." << std::endl;
+    out << "  --udp-sessions" << std::endl;
+    out << "              Track at most this many UDP sessions, shedding the least recently seen." << std::endl;
+    out << "  --udp-idle  Forget UDP sessions idle for this many seconds." << std::endl;
+    out << "  --tcp-sessions" << std::endl;
+    out << "              Track at most this many TCP connections, shedding the least recently seen." << std::endl;
+    out << "  --tcp-idle  Forget TCP connections idle for this many seconds." << std::endl;
+    out << "  --dns-queries" << std::endl;
+    out << "              Await responses to at most this many DNS queries, shedding the oldest." << std::endl;
+    out << "  --dns-timeout" << std::endl;
+    out << "              Count DNS queries unanswered for this many seconds as timed out." << std::endl;
+    out << "  --fragment-memory" << std::endl;
+    out << "              Hold at most this many megabytes of IPv4 fragments for reassembly," << std::endl;
+    out << "              evicting the oldest datagram's.  Default 4." << std::endl;
+    out << "  --fragment-timeout" << std::endl;
+    out << "              Abandon IPv4 datagrams not reassembled within this many seconds." << std::endl;
+    out << "  --ring      With -i, capture through a TPACKET_V3 memory-mapped ring instead of libpcap." << std::endl;
+    out << "  --ring-block-size" << std::endl;
+    out << "              Size of each ring block in bytes.  Default " << PacketRing::default_block_size << "." << std::endl;
+    out << "  --ring-block-count" << std::endl;
+    out << "              Number of ring blocks.  Default " << PacketRing::default_block_count << "." << std::endl;
+    out << "  --threads   With -i, capture on this many threads.  Implies --ring.  Each thread" << std::endl;
+    out << "              gets its own ring in a PACKET_FANOUT group, hashed by flow.  At most " << max_threads << "." << std::endl;
     out << "  -v          Be verbose.  Print packet stats to stderr on exit." << std::endl;
 }
 
@@ -190,12 +313,17 @@ int main(int argc, char **argv)
 
         GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-        std::string file, iface, oui_path;
-        std::vector<std::string> prefix_paths;
-        std::vector<std::string> asn_paths;
-        Snoop snoop;
+        std::string file, iface, compile_db_path;
+        ReferenceDB::Sources sources;
+        Model model;
 
         bool verbose = false;
+        bool use_ring = false;
+        unsigned ring_block_size = PacketRing::default_block_size;
+        unsigned ring_block_count = PacketRing::default_block_count;
+        unsigned threads = 1;
+        size_t queue_bytes = 0;
+        Snoop::Options options;
         int i = 1;
         while (i < argc) {
             if (std::string("-?") == argv[i] || std::string("--help") == argv[i]) {
@@ -205,7 +333,17 @@ int main(int argc, char **argv)
                 ++i;
                 if (i >= argc)
                     throw std::invalid_argument("--asn expects a ASN table file name, none given");
-                asn_paths.push_back(argv[i++]);
+                sources.asn_paths.push_back(argv[i++]);
+            } else if (std::string("--compile-db") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--compile-db expects a database file name, none given");
+                compile_db_path = argv[i++];
+            } else if (std::string("--db") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--db expects a database file name, none given");
+                sources.db_path = argv[i++];
             } else if (std::string("-i") == argv[i]) {
                 ++i;
                 if (i >= argc)
@@ -216,17 +354,87 @@ int main(int argc, char **argv)
                 ++i;
                 if (i >= argc)
                     throw std::invalid_argument("--oui expects a CSV file name, none given");
-                oui_path = argv[i++];
+                sources.oui_path = argv[i++];
+            }
+            else if (std::string("--flush-usec") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--flush-usec expects a number of microseconds, none given");
+                model.flush_usec(std::stol(argv[i++]));
             }
             else if (std::string("--one-lan") == argv[i]) {
                 ++i;
-                snoop.get_model().one_lan(true);
+                model.one_lan(true);
+            }
+            else if (std::string("--traffic-maps") == argv[i]) {
+                ++i;
+                model.traffic_maps(true);
             }
             else if (std::string("--prefix") == argv[i]) {
                 ++i;
                 if (i >= argc)
                     throw std::invalid_argument("--prefix expects a prefix table file name, none given");
-                prefix_paths.push_back(argv[i++]);
+                sources.prefix_paths.push_back(argv[i++]);
+            }
+            else if (std::string("--prefix6") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--prefix6 expects a prefix table file name, none given");
+                sources.prefix6_paths.push_back(argv[i++]);
+            }
+            else if (std::string("--queue") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--queue expects a size in megabytes, none given");
+                queue_bytes = std::stoul(argv[i++]) * 1024 * 1024;
+            }
+            else if (std::string("--udp-sessions") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--udp-sessions expects a session count, none given");
+                options.udp_session_limit = std::stoul(argv[i++]);
+            }
+            else if (std::string("--udp-idle") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--udp-idle expects a number of seconds, none given");
+                options.udp_idle_timeout = long(std::stod(argv[i++]) * 1e9);
+            }
+            else if (std::string("--tcp-sessions") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--tcp-sessions expects a connection count, none given");
+                options.tcp_session_limit = std::stoul(argv[i++]);
+            }
+            else if (std::string("--tcp-idle") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--tcp-idle expects a number of seconds, none given");
+                options.tcp_idle_timeout = long(std::stod(argv[i++]) * 1e9);
+            }
+            else if (std::string("--dns-queries") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--dns-queries expects a query count, none given");
+                options.dns_query_limit = std::stoul(argv[i++]);
+            }
+            else if (std::string("--dns-timeout") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--dns-timeout expects a number of seconds, none given");
+                options.dns_timeout = long(std::stod(argv[i++]) * 1e9);
+            }
+            else if (std::string("--fragment-memory") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--fragment-memory expects a size in megabytes, none given");
+                options.fragment_memory = std::stoul(argv[i++]) * 1024 * 1024;
+            }
+            else if (std::string("--fragment-timeout") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--fragment-timeout expects a number of seconds, none given");
+                options.fragment_timeout = long(std::stod(argv[i++]) * 1e9);
             }
             else if (std::string("-r") == argv[i]) {
                 ++i;
@@ -234,6 +442,33 @@ int main(int argc, char **argv)
                     throw std::invalid_argument("-r expects a file name, none given");
                 file = argv[i++];
             }
+            else if (std::string("--ring") == argv[i]) {
+                ++i;
+                use_ring = true;
+            }
+            else if (std::string("--ring-block-size") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--ring-block-size expects a size in bytes, none given");
+                ring_block_size = std::stoul(argv[i++]);
+            }
+            else if (std::string("--ring-block-count") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--ring-block-count expects a block count, none given");
+                ring_block_count = std::stoul(argv[i++]);
+            }
+            else if (std::string("--threads") == argv[i]) {
+                ++i;
+                if (i >= argc)
+                    throw std::invalid_argument("--threads expects a thread count, none given");
+                threads = std::stoul(argv[i++]);
+                if (threads < 1)
+                    throw std::invalid_argument("--threads expects at least one thread");
+                if (threads > max_threads)
+                    throw std::invalid_argument("--threads expects at most " + std::to_string(max_threads) + " threads");
+                use_ring = true;
+            }
             else if (std::string("-v") == argv[i]) {
                 ++i;
                 verbose = true;
@@ -243,36 +478,107 @@ int main(int argc, char **argv)
             }
         }
 
-        if (1 != file.empty() + iface.empty())
+        bool text_tables = sources.oui_path.size() || sources.prefix_paths.size() || sources.prefix6_paths.size()
+                           || sources.asn_paths.size();
+        if (sources.db_path.size() && (text_tables || compile_db_path.size()))
+            throw std::invalid_argument("--db can't be used with --oui, --prefix, --prefix6, --asn or --compile-db");
+        if (compile_db_path.empty() && 1 != file.empty() + iface.empty())
             throw std::invalid_argument("please provide either a pcap savefile (-r filename) or an interface (-i iface) to read packets from");
+        if (use_ring && queue_bytes)
+            throw std::invalid_argument("--queue can't be used with --ring or --threads");
+        if (use_ring && iface.empty())
+            throw std::invalid_argument("--ring and --threads require an interface (-i iface)");
+
+        std::shared_ptr<ReferenceDB> reference = ReferenceDB::load(sources, verbose);
+        if (compile_db_path.size()) {
+            reference->compile(compile_db_path);
+            if (verbose)
+                std::cerr << "Reference database written to " << compile_db_path << std::endl;
+            return 0;
+        }
+        model.set_reference(std::move(reference));
 
-        register_signal_handler();
-
-        if (oui_path.size())
-            snoop.get_model().load_oui(oui_path, verbose);
+        //  With reference tables, SIGHUP reloads them rather than stopping capture.
+        std::unique_ptr<ReferenceReloader> reloader;
+        if (!sources.empty())
+            reloader.reset(new ReferenceReloader(model, sources, verbose));
 
-        for (const std::string& path : asn_paths)
-            snoop.get_model().load_asns(path, verbose);
+        register_signal_handler();
 
-        for (const std::string& path : prefix_paths)
-            snoop.get_model().load_prefixes(path, verbose);
+        Snoop::Stats stats;
+        if (use_ring) {
+            //  One ring and one Snoop per thread.  The Snoops keep their own
+            //  parser and session state but share the Model, each batching
+            //  its calls and merging them once per ring block.
+            //
+            options.batch_model = threads > 1;
+            std::vector<std::unique_ptr<PacketRing>> rings;
+            GlobalRingsGuard rings_guard;
+            std::vector<std::unique_ptr<Snoop>> snoops;
+            for (unsigned t=0; t<threads; ++t) {
+                rings.emplace_back(new PacketRing(iface, ring_block_size, ring_block_count));
+                snoops.emplace_back(new Snoop(model, options));
+                if (threads > 1)
+                    rings.back()->join_fanout(getpid());
+                global_rings[t].store(rings.back().get());
+            }
 
-        pcap_t* libpcap;
-        if (file.size())
-            global_libpcap = libpcap = read_file(file);
-        else
-            global_libpcap = libpcap = read_interface(iface);
-        bool live_capture = iface.size();
+            if (threads == 1)
+                rings[0]->capture(*snoops[0]);
+            else {
+                std::vector<std::exception_ptr> errors(threads);
+                std::vector<std::thread> workers;
+                for (unsigned t=0; t<threads; ++t)
+                    workers.emplace_back([&, t]() {
+                        try {
+                            rings[t]->capture(*snoops[t]);
+                        }
+                        catch (...) {
+                            errors[t] = std::current_exception();
+                            for (std::unique_ptr<PacketRing>& ring : rings)
+                                ring->break_loop();
+                        }
+                    });
+                for (std::thread& worker : workers)
+                    worker.join();
+                for (std::exception_ptr& error : errors)
+                    if (error)
+                        std::rethrow_exception(error);
+            }
 
-        capture(libpcap, live_capture, &snoop);
-        global_libpcap = nullptr;
+            PacketRing::Stats ring_stats;
+            for (unsigned t=0; t<threads; ++t) {
+                ring_stats += rings[t]->get_stats();
+                stats += snoops[t]->get_stats();
+            }
+            if (verbose)
+                std::cerr << ring_stats << "\n";
+        }
+        else {
+            Snoop snoop(model, options);
+            pcap_t* libpcap;
+            if (file.size())
+                global_libpcap = libpcap = read_file(file);
+            else
+                global_libpcap = libpcap = read_interface(iface);
+            bool live_capture = iface.size();
+
+            if (queue_bytes)
+                capture_queued(libpcap, live_capture, &snoop, queue_bytes);
+            else
+                capture(libpcap, live_capture, pcap_callback, reinterpret_cast<u_char*>(&snoop));
+            global_libpcap = nullptr;
+
+            pcap_close(libpcap);
+            stats = snoop.get_stats();
+        }
 
-        pcap_close(libpcap);
+        model.flush();
 
         if (verbose) {
-            std::cerr << snoop.get_stats() << "\n";
+            std::cerr << stats << "\n";
             std::cerr << "\n";
-            snoop.get_model().report(std::cerr);
+            model.report(std::cerr);
         }
     }
     catch (const std::exception& e) {
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <iomanip>
 
+#include <arpa/inet.h>
+
 #include "util.hpp"
 
 
@@ -46,3 +48,33 @@ std::ostream& operator<<(std::ostream& o, const IPV4SessionKey& s)
     o << s.a << " - " << s.b;
     return o;
 }
+
+
+std::ostream& operator<<(std::ostream& o, const IPV6Address& address)
+{
+    char text[INET6_ADDRSTRLEN];
+    inet_ntop(AF_INET6, address.data(), text, sizeof(text));
+    return o << text;
+}
+
+
+std::ostream& operator<<(std::ostream& o, const IPAddress& address)
+{
+    if (address.is_ipv6())
+        return o << address.ipv6();
+    return o << address.ipv4();
+}
+
+
+std::ostream& operator<<(std::ostream& o, const IPV6SockAddress& sa)
+{
+    o << "[" << sa.address << "]:" << sa.port;
+    return o;
+}
+
+
+std::ostream& operator<<(std::ostream& o, const IPV6SessionKey& s)
+{
+    o << s.a << " - " << s.b;
+    return o;
+}
@@ -1,10 +1,67 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iosfwd>
 
 class MacAddress : public std::array<unsigned char, 6> {};  // Network byte order.
 class IPV4Address : public std::array<unsigned char, 4> {};  // Network byte order.
+class IPV6Address : public std::array<unsigned char, 16> {};  // Network byte order.
+
+//  GCC's and Clang's 128-bit integer, for packing IPv6 addresses.
+using uint128_t = unsigned __int128;
+
+//  Pack addresses into integers, for hashing.
+inline uint64_t pack(const MacAddress& address) {
+    uint64_t key = 0;
+    memcpy(&key, address.data(), address.size());
+    return key;
+}
+
+inline uint32_t pack(const IPV4Address& address) {
+    uint32_t key;
+    memcpy(&key, address.data(), address.size());
+    return key;
+}
+
+inline uint128_t pack(const IPV6Address& address) {
+    uint128_t key;
+    memcpy(&key, address.data(), address.size());
+    return key;
+}
+
+//  An IPv4 or an IPv6 address, for entities that may be either.
+//
+class IPAddress {
+public:
+    IPAddress() = default;
+    IPAddress(const IPV4Address& address) : length(4) { memcpy(bytes.data(), address.data(), 4); }
+    IPAddress(const IPV6Address& address) : length(16) { memcpy(bytes.data(), address.data(), 16); }
+
+    bool is_ipv6() const { return this->length == 16; }
+    IPV4Address ipv4() const { IPV4Address a; memcpy(a.data(), bytes.data(), 4); return a; }
+    IPV6Address ipv6() const { IPV6Address a; memcpy(a.data(), bytes.data(), 16); return a; }
+
+    const unsigned char* data() const { return this->bytes.data(); }
+    size_t size() const { return this->length; }
+
+    //  IPv4 addresses sort before IPv6 addresses.
+    bool operator <(const IPAddress& rhs) const {
+        if (this->length != rhs.length)
+            return this->length < rhs.length;
+        return memcmp(this->bytes.data(), rhs.bytes.data(), this->length) < 0;
+    }
+
+    bool operator ==(const IPAddress& rhs) const {
+        return this->length == rhs.length && !memcmp(this->bytes.data(), rhs.bytes.data(), this->length);
+    }
+
+private:
+    std::array<unsigned char, 16> bytes {};  // Network byte order.
+    uint8_t length = 0;
+};
 
 struct IPV4SockAddress {
     IPV4Address address;
@@ -50,7 +107,116 @@ struct IPV4SessionKey {
     IPV4SessionKey& operator=(const IPV4SessionKey&) = default;
 };
 
+//  A four-tuple packed into 96 bits for fast hashing and comparison.
+//  Built from an IPV4SessionKey, so a<=b here too.
+//
+struct IPV4FlowKey {
+    uint32_t a_address;  //  Network byte order.
+    uint32_t b_address;
+    uint16_t a_port;     //  Host byte order.
+    uint16_t b_port;
+
+    IPV4FlowKey() = default;
+
+    explicit IPV4FlowKey(const IPV4SessionKey& key) {
+        memcpy(&a_address, key.a.address.data(), 4);
+        memcpy(&b_address, key.b.address.data(), 4);
+        a_port = key.a.port;
+        b_port = key.b.port;
+    }
+
+    bool operator ==(const IPV4FlowKey& rhs) const {
+        return a_address == rhs.a_address && b_address == rhs.b_address
+            && a_port == rhs.a_port && b_port == rhs.b_port;
+    }
+
+    uint64_t hash() const {
+        uint64_t h = (uint64_t(a_address) << 32) | b_address;
+        h ^= ((uint64_t(a_port) << 16) | b_port) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 32;
+        h *= 0xd6e8feb86659fd93ULL;
+        h ^= h >> 32;
+        return h;
+    }
+};
+
+//  The IPv6 versions of the above.
+//
+struct IPV6SockAddress {
+    IPV6Address address;
+    unsigned short port;
+
+    bool operator <(const IPV6SockAddress& rhs) const {
+        if (address == rhs.address)
+            return port < rhs.port;
+        return address < rhs.address;
+    }
+
+    bool operator ==(const IPV6SockAddress& rhs) const {
+        return address == rhs.address && port == rhs.port;
+    }
+};
+
+struct IPV6SessionKey {
+    IPV6SockAddress a, b;
+
+    explicit IPV6SessionKey(const IPV6SessionKey&) = default;
+
+    explicit IPV6SessionKey(const IPV6SockAddress& a, const IPV6SockAddress& b) {
+        if (a<b) {
+            this->a = a;
+            this->b = b;
+        } else {
+            this->a = b;
+            this->b = a;
+        }
+    }
+
+    bool operator <(const IPV6SessionKey& rhs) const {
+        if (a == rhs.a)
+            return b < rhs.b;
+        return a < rhs.a;
+    }
+
+    IPV6SessionKey& operator=(const IPV6SessionKey&) = default;
+};
+
+struct IPV6FlowKey {
+    uint128_t a_address;  //  Network byte order.
+    uint128_t b_address;
+    uint16_t a_port;      //  Host byte order.
+    uint16_t b_port;
+
+    IPV6FlowKey() = default;
+
+    explicit IPV6FlowKey(const IPV6SessionKey& key) {
+        a_address = pack(key.a.address);
+        b_address = pack(key.b.address);
+        a_port = key.a.port;
+        b_port = key.b.port;
+    }
+
+    bool operator ==(const IPV6FlowKey& rhs) const {
+        return a_address == rhs.a_address && b_address == rhs.b_address
+            && a_port == rhs.a_port && b_port == rhs.b_port;
+    }
+
+    uint64_t hash() const {
+        uint64_t h = uint64_t(a_address) ^ uint64_t(a_address >> 64) * 0xc2b2ae3d27d4eb4fULL;
+        h ^= (uint64_t(b_address) ^ uint64_t(b_address >> 64) * 0x165667b19e3779f9ULL) * 0xd6e8feb86659fd93ULL;
+        h ^= ((uint64_t(a_port) << 16) | b_port) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 32;
+        h *= 0xd6e8feb86659fd93ULL;
+        h ^= h >> 32;
+        return h;
+    }
+};
+
 std::ostream& operator<<(std::ostream&, const MacAddress&);
 std::ostream& operator<<(std::ostream&, const IPV4Address&);
 std::ostream& operator<<(std::ostream&, const IPV4SockAddress&);
 std::ostream& operator<<(std::ostream&, const IPV4SessionKey&);
+std::ostream& operator<<(std::ostream&, const IPV6Address&);
+std::ostream& operator<<(std::ostream&, const IPAddress&);
+std::ostream& operator<<(std::ostream&, const IPV6SockAddress&);
+std::ostream& operator<<(std::ostream&, const IPV6SessionKey&);
@@ -0,0 +1,163 @@
+#include <algorithm>
+
+#include "BarnesHutTree.hpp"
+
+
+namespace {
+    //  Spread the low 16 bits of :n: to the even bits.
+    uint32_t spread(uint32_t n)
+    {
+        n &= 0xffff;
+        n = (n | (n << 8)) & 0x00ff00ff;
+        n = (n | (n << 4)) & 0x0f0f0f0f;
+        n = (n | (n << 2)) & 0x33333333;
+        n = (n | (n << 1)) & 0x55555555;
+        return n;
+    }
+}
+
+
+void BarnesHutTree::build(size_t count, const float* x, const float* y)
+{
+    this->bodies.clear();
+    float min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+    for (size_t i=0; i<count; ++i) {
+        if (i == 0) {
+            min_x = max_x = x[i];
+            min_y = max_y = y[i];
+        }
+        min_x = std::min(min_x, x[i]);
+        min_y = std::min(min_y, y[i]);
+        max_x = std::max(max_x, x[i]);
+        max_y = std::max(max_y, y[i]);
+        this->bodies.push_back(Body { x[i], y[i], int(i), 0 });
+    }
+    float size = std::max(std::max(max_x - min_x, max_y - min_y), 1.f);
+    sort(min_x, min_y, size);
+
+    this->cells.clear();
+    this->leaves.clear();
+    this->cells.push_back(Cell { 0, 0, size, 0, int(this->bodies.size()), -1, 0 });
+    split(0, 0);
+}
+
+
+void BarnesHutTree::sort(float min_x, float min_y, float size)
+{
+    const float scale = 65535.f / size;
+    for (Body& body : this->bodies)
+        body.key = spread(uint32_t((body.x - min_x) * scale)) | spread(uint32_t((body.y - min_y) * scale)) << 1;
+
+    //  Radix sort, a byte at a time.  Positions barely change from frame
+    //  to frame, but it's as fast as anything that takes advantage of it.
+    this->scratch.resize(this->bodies.size());
+    for (int shift = 0; shift < 32; shift += 8) {
+        size_t counts[257] = {};
+        for (const Body& body : this->bodies)
+            counts[(body.key >> shift & 0xff) + 1]++;
+        for (int i=1; i<257; ++i)
+            counts[i] += counts[i - 1];
+        for (const Body& body : this->bodies)
+            this->scratch[counts[body.key >> shift & 0xff]++] = body;
+        this->bodies.swap(this->scratch);
+    }
+}
+
+
+//  Find cell :c:'s center of mass, and split it if it holds too many bodies.
+//  Its children, and theirs, are appended to :cells:.
+//
+void BarnesHutTree::split(int c, int depth)
+{
+    Cell cell = this->cells[c];
+    float x = 0, y = 0;
+    for (int b = cell.first; b < cell.first + cell.count; ++b) {
+        x += this->bodies[b].x;
+        y += this->bodies[b].y;
+    }
+    this->cells[c].x = cell.count ? x / cell.count : 0;
+    this->cells[c].y = cell.count ? y / cell.count : 0;
+    if (cell.count <= leaf_bodies || depth == max_depth) {
+        if (cell.count)
+            this->leaves.push_back(c);
+        return;
+    }
+
+    //  The bodies are sorted, so each quadrant's are a run, told apart by
+    //  the key's next two bits.
+    const int shift = 2 * (max_depth - 1 - depth);
+    int child = this->cells.size();
+    int children = 0;
+    int end = cell.first + cell.count;
+    for (int b = cell.first; b < end; ) {
+        uint32_t quadrant = this->bodies[b].key >> shift & 3;
+        int run = b + 1;
+        while (run < end && (this->bodies[run].key >> shift & 3) == quadrant)
+            ++run;
+        this->cells.push_back(Cell { 0, 0, cell.size / 2, b, run - b, -1, 0 });
+        ++children;
+        b = run;
+    }
+    this->cells[c].child = child;
+    this->cells[c].children = children;
+    for (int i=0; i<children; ++i)
+        split(child + i, depth + 1);
+}
+
+
+void BarnesHutTree::repel_leaf(size_t leaf, float k, float theta, float min_d_square, const FDGKernels& kernels,
+                               float* fx, float* fy) const
+{
+    const Cell& group = this->cells[this->leaves[leaf]];
+    const Body* begin = &this->bodies[group.first];
+    const Body* end = begin + group.count;
+    float min_x = begin->x, min_y = begin->y, max_x = begin->x, max_y = begin->y;
+    for (const Body* b = begin; b != end; ++b) {
+        min_x = std::min(min_x, b->x);
+        min_y = std::min(min_y, b->y);
+        max_x = std::max(max_x, b->x);
+        max_y = std::max(max_y, b->y);
+    }
+    const float theta_square = theta * theta;
+
+    //  List what the leaf's bodies are repelled by: the bodies of nearby
+    //  leaves, the leaf's own included, and far cells' centers of mass.  A
+    //  body adds nothing to its own repulsion.  Reused, one list per
+    //  thread.
+    thread_local std::vector<float> xs, ys, masses;
+    xs.clear();
+    ys.clear();
+    masses.clear();
+
+    //  Cells yet to visit.  Each visit replaces one with at most four, one
+    //  level deeper, so this many always suffice.
+    int stack[3 * max_depth + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top) {
+        const Cell& cell = this->cells[stack[--top]];
+        if (cell.child < 0) {
+            for (int b = cell.first; b < cell.first + cell.count; ++b) {
+                xs.push_back(this->bodies[b].x);
+                ys.push_back(this->bodies[b].y);
+                masses.push_back(1);
+            }
+            continue;
+        }
+        //  From the nearest point of the leaf's bodies' bounds.
+        float dx = std::max(std::max(min_x - cell.x, cell.x - max_x), 0.f);
+        float dy = std::max(std::max(min_y - cell.y, cell.y - max_y), 0.f);
+        if (cell.size * cell.size < theta_square * (dx*dx + dy*dy)) {
+            xs.push_back(cell.x);
+            ys.push_back(cell.y);
+            masses.push_back(cell.count);
+        }
+        else
+            for (int i = cell.children - 1; i >= 0; --i)
+                stack[top++] = cell.child + i;
+    }
+
+    for (const Body* b = begin; b != end; ++b)
+        kernels.repulsion(b->x, b->y, xs.data(), ys.data(), masses.data(), xs.size(), k, min_d_square,
+                          fx[b->index], fy[b->index]);
+}
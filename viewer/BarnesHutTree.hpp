@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FDGKernels.hpp"
+
+
+//  A quadtree of equal bodies, for approximating their inverse-square
+//  repulsion (Barnes-Hut): a body far enough from a cell is repelled by
+//  the cell's bodies as if they were one, of their total mass, at their
+//  center of mass.
+//
+//  Rebuilt from scratch every frame.  Bodies are sorted along a Z-order
+//  curve, so each cell's bodies are contiguous, and cells are laid out
+//  in the order they're walked.  The vectors are reused from build to
+//  build, so building allocates nothing once they've grown.
+//
+//  The tree is walked once for each leaf's few bodies together, not for
+//  each body, and what the walk finds is listed, and the list summed for
+//  each body by vector kernels.
+//
+class BarnesHutTree
+{
+public:
+    //  Rebuild the tree from :count: bodies, body i at :x:[i], :y:[i].
+    void build(size_t count, const float* x, const float* y);
+
+    size_t leaf_count() const { return this->leaves.size(); }
+    size_t cell_count() const { return this->cells.size(); }
+
+    //  For each body i in leaf :leaf:, add the repulsion of every other
+    //  body to :fx:[i] and :fy:[i].  A cell of side s at distance d from
+    //  the leaf's bodies is taken whole if s < :theta: * d, so a :theta:
+    //  of 0 opens every cell, and is exact.  The force between two bodies
+    //  at distance d is :k: / d**2, with d no less than :min_d_square:'s
+    //  root.
+    //
+    //  Different leaves may be repelled on different threads at once.
+    void repel_leaf(size_t leaf, float k, float theta, float min_d_square, const FDGKernels& kernels,
+                    float* fx, float* fy) const;
+
+private:
+    //  Cells with no more bodies than this, or this deep, aren't split.
+    static constexpr int leaf_bodies = 8;
+    static constexpr int max_depth = 16;  //  The Z-order key's bits per axis.
+
+    struct Cell {
+        float x, y;      //  Center of mass.
+        float size;      //  Side length.
+        int first;       //  The first of its bodies.
+        int count;       //  Bodies within.
+        int child;       //  The first of its nonempty children, or -1 for a leaf.
+        int children;
+    };
+    struct Body {
+        float x, y;
+        int index;
+        uint32_t key;  //  Z-order.
+    };
+    std::vector<Cell> cells;
+    std::vector<int> leaves;  //  The nonempty leaf cells.
+    std::vector<Body> bodies;
+    std::vector<Body> scratch;  //  For sorting.
+
+    void sort(float min_x, float min_y, float size);
+    void split(int c, int depth);
+};
+
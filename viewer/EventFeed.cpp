@@ -0,0 +1,82 @@
+#include <poll.h>
+
+#include "EventFeed.hpp"
+
+
+EventFeed::EventFeed(int fd, size_t slots)
+    : reader(fd, true)
+{
+    size_t n = 1;
+    while (n < slots)
+        n <<= 1;
+    this->slots.reset(new Lansnoop::Event[n]);
+    this->mask = n - 1;
+
+    this->thread = std::thread(&EventFeed::run, this);
+}
+
+
+EventFeed::~EventFeed()
+{
+    this->stopping.store(true);
+    this->thread.join();
+}
+
+
+const Lansnoop::Event* EventFeed::front()
+{
+    size_t tail = this->tail.load(std::memory_order_relaxed);
+    if (tail != this->head.load(std::memory_order_acquire))
+        return &this->slots[tail & this->mask];
+    if (this->finished.load(std::memory_order_acquire) && this->error) {
+        std::exception_ptr error = this->error;
+        this->error = nullptr;
+        std::rethrow_exception(error);
+    }
+    return nullptr;
+}
+
+
+bool EventFeed::done() const
+{
+    return this->finished.load(std::memory_order_acquire)
+        && this->tail.load(std::memory_order_relaxed) == this->head.load(std::memory_order_acquire)
+        && !this->error;
+}
+
+
+size_t EventFeed::queued() const
+{
+    return this->head.load(std::memory_order_acquire) - this->tail.load(std::memory_order_acquire);
+}
+
+
+void EventFeed::run()
+{
+    //  Wake regularly to notice when to stop.
+    const int interval_ms = 100;
+    pollfd input { this->reader.get_fd(), POLLIN, 0 };
+    try {
+        size_t head = this->head.load(std::memory_order_relaxed);
+        while (!this->stopping.load(std::memory_order_relaxed)) {
+            if (head - this->tail.load(std::memory_order_acquire) > this->mask) {
+                //  Full.  Let the viewer catch up.
+                poll(nullptr, 0, 1);
+                continue;
+            }
+            if (this->reader.next(this->slots[head & this->mask])) {
+                this->head.store(++head, std::memory_order_release);
+                continue;
+            }
+            if (this->reader.fill())
+                continue;
+            if (this->reader.eof())
+                break;
+            poll(&input, 1, interval_ms);
+        }
+    }
+    catch (...) {
+        this->error = std::current_exception();
+    }
+    this->finished.store(true, std::memory_order_release);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+
+#include "event.pb.h"
+#include "EventReader.hpp"
+
+
+//  Reads and parses events from a descriptor on a thread of its own, so
+//  the render loop only has to apply them.
+//
+//  Parsed events wait in a lock-free single-producer, single-consumer ring
+//  of Event slots.  The slots are reused, so once each has held a large
+//  event, parsing allocates little.  When the ring is full the thread
+//  stops reading, and the writer waits on the pipe rather than the viewer
+//  on the writer.
+//
+//  The descriptor isn't owned, and must outlive the EventFeed.  An error
+//  reading or parsing ends the feed, and is rethrown by front() once the
+//  events before it are consumed.
+//
+class EventFeed
+{
+public:
+    //  :slots: is rounded up to a power of two.
+    explicit EventFeed(int fd, size_t slots = default_slots);
+    ~EventFeed();
+    EventFeed(const EventFeed&) = delete;
+    EventFeed& operator=(const EventFeed&) = delete;
+
+    static constexpr size_t default_slots = 4096;
+
+    //  Consumer side.
+    //  The oldest event not yet popped, or null if none is queued.
+    const Lansnoop::Event* front();
+    void pop() { this->tail.store(this->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+    //  Whether the input has ended and every event from it been popped.
+    bool done() const;
+    size_t queued() const;
+
+    const EventReader::Stats& get_stats() const { return this->reader.get_stats(); }  // Racy; for reports.
+
+private:
+    EventReader reader;
+    std::unique_ptr<Lansnoop::Event[]> slots;
+    size_t mask;
+    std::exception_ptr error;  // Written before :finished:.
+
+    //  Both only ever increase.
+    alignas(64) std::atomic<size_t> head { 0 };  // Written only by the thread.
+    alignas(64) std::atomic<size_t> tail { 0 };  // Written only by the consumer.
+    alignas(64) std::atomic<bool> finished { false };
+    std::atomic<bool> stopping { false };
+    std::thread thread;
+
+    void run();
+};
@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "FDGKernels.hpp"
+
+
+//  Plain C++.  The vector kernels finish their ranges' odd ends with these.
+//
+namespace {
+    void repulsion(float x, float y, const float* xs, const float* ys, const float* masses, size_t count,
+                   float k, float min_d_square, float& fx, float& fy)
+    {
+        float sx = 0, sy = 0;
+        for (size_t j=0; j<count; ++j) {
+            float dx = xs[j] - x;
+            float dy = ys[j] - y;
+            float d_square = std::max(dx*dx + dy*dy, min_d_square);
+            float f = (masses ? masses[j] : 1.f) * k / (d_square * std::sqrt(d_square));
+            sx += f * dx;
+            sy += f * dy;
+        }
+        fx -= sx;
+        fy -= sy;
+    }
+
+    void springs(const float* px, const float* py, const int* a, const int* b, const float* length,
+                 size_t begin, size_t end, float k, float* edge_fx, float* edge_fy)
+    {
+        for (size_t e=begin; e<end; ++e) {
+            float dx = px[b[e]] - px[a[e]];
+            float dy = py[b[e]] - py[a[e]];
+            float d = std::sqrt(dx*dx + dy*dy);
+            float f = k * (d - length[e]) / d;
+            edge_fx[e] = f * dx;
+            edge_fy[e] = f * dy;
+        }
+    }
+
+    void origin(const float* px, const float* py, float* fx, float* fy, size_t begin, size_t end, float k)
+    {
+        for (size_t i=begin; i<end; ++i) {
+            float d = std::sqrt(px[i]*px[i] + py[i]*py[i]);
+            fx[i] -= k * d * px[i];
+            fy[i] -= k * d * py[i];
+        }
+    }
+
+    void integrate(float* px, float* py, float* vx, float* vy, const float* fx, const float* fy,
+                   size_t begin, size_t end, float dt, float inverse_drag, float inertia)
+    {
+        for (size_t i=begin; i<end; ++i) {
+            float old_vx = vx[i] * inverse_drag;
+            float old_vy = vy[i] * inverse_drag;
+            vx[i] = old_vx + dt * fx[i] / inertia;
+            vy[i] = old_vy + dt * fy[i] / inertia;
+            px[i] += (vx[i] + old_vx) / 2.0f * dt;
+            py[i] += (vy[i] + old_vy) / 2.0f * dt;
+        }
+    }
+
+    const FDGKernels scalar_kernels { "scalar", repulsion, springs, origin, integrate };
+}
+
+
+#if defined(__x86_64__)
+
+//  SSE2, four lanes.  Every x86-64 CPU has it.
+//
+namespace {
+namespace sse2 {
+    float sum(__m128 v)
+    {
+        v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+        return _mm_cvtss_f32(v);
+    }
+
+    void repulsion(float x, float y, const float* xs, const float* ys, const float* masses, size_t count,
+                   float k, float min_d_square, float& fx, float& fy)
+    {
+        const __m128 vx = _mm_set1_ps(x), vy = _mm_set1_ps(y);
+        const __m128 vk = _mm_set1_ps(k), vmin = _mm_set1_ps(min_d_square);
+        __m128 sx = _mm_setzero_ps(), sy = _mm_setzero_ps();
+        size_t j = 0;
+        for (; j + 4 <= count; j += 4) {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + j), vx);
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + j), vy);
+            __m128 d_square = _mm_max_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), vmin);
+            __m128 m = masses ? _mm_mul_ps(_mm_loadu_ps(masses + j), vk) : vk;
+            __m128 f = _mm_div_ps(m, _mm_mul_ps(d_square, _mm_sqrt_ps(d_square)));
+            sx = _mm_add_ps(sx, _mm_mul_ps(f, dx));
+            sy = _mm_add_ps(sy, _mm_mul_ps(f, dy));
+        }
+        fx -= sum(sx);
+        fy -= sum(sy);
+        ::repulsion(x, y, xs + j, ys + j, masses ? masses + j : nullptr, count - j, k, min_d_square, fx, fy);
+    }
+
+    void springs(const float* px, const float* py, const int* a, const int* b, const float* length,
+                 size_t begin, size_t end, float k, float* edge_fx, float* edge_fy)
+    {
+        const __m128 vk = _mm_set1_ps(k);
+        size_t e = begin;
+        for (; e + 4 <= end; e += 4) {
+            //  No gathers before AVX2.
+            __m128 dx = _mm_sub_ps(_mm_setr_ps(px[b[e]], px[b[e+1]], px[b[e+2]], px[b[e+3]]),
+                                   _mm_setr_ps(px[a[e]], px[a[e+1]], px[a[e+2]], px[a[e+3]]));
+            __m128 dy = _mm_sub_ps(_mm_setr_ps(py[b[e]], py[b[e+1]], py[b[e+2]], py[b[e+3]]),
+                                   _mm_setr_ps(py[a[e]], py[a[e+1]], py[a[e+2]], py[a[e+3]]));
+            __m128 d = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+            __m128 f = _mm_div_ps(_mm_mul_ps(vk, _mm_sub_ps(d, _mm_loadu_ps(length + e))), d);
+            _mm_storeu_ps(edge_fx + e, _mm_mul_ps(f, dx));
+            _mm_storeu_ps(edge_fy + e, _mm_mul_ps(f, dy));
+        }
+        ::springs(px, py, a, b, length, e, end, k, edge_fx, edge_fy);
+    }
+
+    void origin(const float* px, const float* py, float* fx, float* fy, size_t begin, size_t end, float k)
+    {
+        const __m128 vk = _mm_set1_ps(k);
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            __m128 x = _mm_loadu_ps(px + i), y = _mm_loadu_ps(py + i);
+            __m128 kd = _mm_mul_ps(vk, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y))));
+            _mm_storeu_ps(fx + i, _mm_sub_ps(_mm_loadu_ps(fx + i), _mm_mul_ps(kd, x)));
+            _mm_storeu_ps(fy + i, _mm_sub_ps(_mm_loadu_ps(fy + i), _mm_mul_ps(kd, y)));
+        }
+        ::origin(px, py, fx, fy, i, end, k);
+    }
+
+    void integrate(float* px, float* py, float* vx, float* vy, const float* fx, const float* fy,
+                   size_t begin, size_t end, float dt, float inverse_drag, float inertia)
+    {
+        const __m128 vdrag = _mm_set1_ps(inverse_drag);
+        const __m128 vaccel = _mm_set1_ps(dt / inertia), vhalf_dt = _mm_set1_ps(dt / 2);
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            __m128 old_vx = _mm_mul_ps(_mm_loadu_ps(vx + i), vdrag);
+            __m128 old_vy = _mm_mul_ps(_mm_loadu_ps(vy + i), vdrag);
+            __m128 new_vx = _mm_add_ps(old_vx, _mm_mul_ps(vaccel, _mm_loadu_ps(fx + i)));
+            __m128 new_vy = _mm_add_ps(old_vy, _mm_mul_ps(vaccel, _mm_loadu_ps(fy + i)));
+            _mm_storeu_ps(vx + i, new_vx);
+            _mm_storeu_ps(vy + i, new_vy);
+            _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_add_ps(new_vx, old_vx), vhalf_dt)));
+            _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_add_ps(new_vy, old_vy), vhalf_dt)));
+        }
+        ::integrate(px, py, vx, vy, fx, fy, i, end, dt, inverse_drag, inertia);
+    }
+
+    const FDGKernels kernels { "sse2", repulsion, springs, origin, integrate };
+}
+}
+
+
+//  AVX2 and FMA, eight lanes.  Compiled for them whatever the build's
+//  flags, and only used if the CPU has them.
+//
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+
+namespace {
+namespace avx2 {
+    float sum(__m256 v)
+    {
+        return sse2::sum(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+    }
+
+    void repulsion(float x, float y, const float* xs, const float* ys, const float* masses, size_t count,
+                   float k, float min_d_square, float& fx, float& fy)
+    {
+        const __m256 vx = _mm256_set1_ps(x), vy = _mm256_set1_ps(y);
+        const __m256 vk = _mm256_set1_ps(k), vmin = _mm256_set1_ps(min_d_square);
+        __m256 sx = _mm256_setzero_ps(), sy = _mm256_setzero_ps();
+        size_t j = 0;
+        for (; j + 8 <= count; j += 8) {
+            __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + j), vx);
+            __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + j), vy);
+            __m256 d_square = _mm256_max_ps(_mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy)), vmin);
+            __m256 m = masses ? _mm256_mul_ps(_mm256_loadu_ps(masses + j), vk) : vk;
+            __m256 f = _mm256_div_ps(m, _mm256_mul_ps(d_square, _mm256_sqrt_ps(d_square)));
+            sx = _mm256_fmadd_ps(f, dx, sx);
+            sy = _mm256_fmadd_ps(f, dy, sy);
+        }
+        fx -= sum(sx);
+        fy -= sum(sy);
+        sse2::repulsion(x, y, xs + j, ys + j, masses ? masses + j : nullptr, count - j, k, min_d_square, fx, fy);
+    }
+
+    void springs(const float* px, const float* py, const int* a, const int* b, const float* length,
+                 size_t begin, size_t end, float k, float* edge_fx, float* edge_fy)
+    {
+        const __m256 vk = _mm256_set1_ps(k);
+        size_t e = begin;
+        for (; e + 8 <= end; e += 8) {
+            __m256i ia = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + e));
+            __m256i ib = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + e));
+            __m256 dx = _mm256_sub_ps(_mm256_i32gather_ps(px, ib, 4), _mm256_i32gather_ps(px, ia, 4));
+            __m256 dy = _mm256_sub_ps(_mm256_i32gather_ps(py, ib, 4), _mm256_i32gather_ps(py, ia, 4));
+            __m256 d = _mm256_sqrt_ps(_mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy)));
+            __m256 f = _mm256_div_ps(_mm256_mul_ps(vk, _mm256_sub_ps(d, _mm256_loadu_ps(length + e))), d);
+            _mm256_storeu_ps(edge_fx + e, _mm256_mul_ps(f, dx));
+            _mm256_storeu_ps(edge_fy + e, _mm256_mul_ps(f, dy));
+        }
+        sse2::springs(px, py, a, b, length, e, end, k, edge_fx, edge_fy);
+    }
+
+    void origin(const float* px, const float* py, float* fx, float* fy, size_t begin, size_t end, float k)
+    {
+        const __m256 vk = _mm256_set1_ps(k);
+        size_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m256 x = _mm256_loadu_ps(px + i), y = _mm256_loadu_ps(py + i);
+            __m256 kd = _mm256_mul_ps(vk, _mm256_sqrt_ps(_mm256_fmadd_ps(x, x, _mm256_mul_ps(y, y))));
+            _mm256_storeu_ps(fx + i, _mm256_fnmadd_ps(kd, x, _mm256_loadu_ps(fx + i)));
+            _mm256_storeu_ps(fy + i, _mm256_fnmadd_ps(kd, y, _mm256_loadu_ps(fy + i)));
+        }
+        sse2::origin(px, py, fx, fy, i, end, k);
+    }
+
+    void integrate(float* px, float* py, float* vx, float* vy, const float* fx, const float* fy,
+                   size_t begin, size_t end, float dt, float inverse_drag, float inertia)
+    {
+        const __m256 vdrag = _mm256_set1_ps(inverse_drag);
+        const __m256 vaccel = _mm256_set1_ps(dt / inertia), vhalf_dt = _mm256_set1_ps(dt / 2);
+        size_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m256 old_vx = _mm256_mul_ps(_mm256_loadu_ps(vx + i), vdrag);
+            __m256 old_vy = _mm256_mul_ps(_mm256_loadu_ps(vy + i), vdrag);
+            __m256 new_vx = _mm256_fmadd_ps(vaccel, _mm256_loadu_ps(fx + i), old_vx);
+            __m256 new_vy = _mm256_fmadd_ps(vaccel, _mm256_loadu_ps(fy + i), old_vy);
+            _mm256_storeu_ps(vx + i, new_vx);
+            _mm256_storeu_ps(vy + i, new_vy);
+            _mm256_storeu_ps(px + i, _mm256_fmadd_ps(_mm256_add_ps(new_vx, old_vx), vhalf_dt, _mm256_loadu_ps(px + i)));
+            _mm256_storeu_ps(py + i, _mm256_fmadd_ps(_mm256_add_ps(new_vy, old_vy), vhalf_dt, _mm256_loadu_ps(py + i)));
+        }
+        sse2::integrate(px, py, vx, vy, fx, fy, i, end, dt, inverse_drag, inertia);
+    }
+
+    const FDGKernels kernels { "avx2", repulsion, springs, origin, integrate };
+}
+}
+
+#pragma GCC pop_options
+
+#endif
+
+
+const std::vector<const FDGKernels*>& FDGKernels::available()
+{
+    static const std::vector<const FDGKernels*> sets = [] {
+        std::vector<const FDGKernels*> sets { &scalar_kernels };
+#if defined(__x86_64__)
+        sets.push_back(&sse2::kernels);
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            sets.push_back(&avx2::kernels);
+#endif
+        return sets;
+    }();
+    return sets;
+}
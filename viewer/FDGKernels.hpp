@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+
+//  The force directed layout's arithmetic, on vertices kept as a
+//  structure of arrays, in plain C++ and, where the CPU has them, in SSE2
+//  and AVX2 with FMA.  All sets of kernels compute the same forces, up
+//  to rounding.
+//
+//  Each kernel works on a range [begin, end), so that ranges can be
+//  handed to different threads.
+//
+struct FDGKernels {
+    const char* name;
+
+    //  Add to :fx: and :fy: the repulsion on a body at :x:, :y: of the
+    //  :count: bodies at :xs:, :ys:, of masses :masses:, or 1 if null.
+    //  The repulsion of mass m at distance d is :k: * m / d**2, with d no
+    //  less than :min_d_square:'s root.  A body at :x:, :y: itself adds
+    //  nothing.
+    void (*repulsion)(float x, float y, const float* xs, const float* ys, const float* masses, size_t count,
+                      float k, float min_d_square, float& fx, float& fy);
+
+    //  Set :edge_fx:[e] and :edge_fy:[e] to the pull on vertex :a:[e]
+    //  toward vertex :b:[e] of a spring of length :length:[e].  Vertex
+    //  :b:[e] gets the opposite pull.
+    void (*springs)(const float* px, const float* py, const int* a, const int* b, const float* length,
+                    size_t begin, size_t end, float k, float* edge_fx, float* edge_fy);
+
+    //  Add a pull toward the origin, of :k: * d**2 at distance d, to :fx:
+    //  and :fy:.
+    void (*origin)(const float* px, const float* py, float* fx, float* fy, size_t begin, size_t end, float k);
+
+    //  Slow the vertices by :inverse_drag:, then accelerate them by their
+    //  forces for :dt:, and move them.
+    void (*integrate)(float* px, float* py, float* vx, float* vy, const float* fx, const float* fy,
+                      size_t begin, size_t end, float dt, float inverse_drag, float inertia);
+
+    //  The sets this CPU can run, slowest first, starting with plain C++.
+    static const std::vector<const FDGKernels*>& available();
+    static const FDGKernels& best() { return *available().back(); }
+};
@@ -1,9 +1,9 @@
 #include <vector>
-#include <unordered_map>
 #include <string>
 #include <stdexcept>
 #include <algorithm>
-#include <cmath>
+#include <chrono>
+#include <thread>
 
 #include "Components.hpp"
 #include "FDGSystem.hpp"
@@ -23,126 +23,136 @@ void FDGSystem::update(Components& components)
 {
     const float dt = 1.0f/60; //  Assume dt is 1/60 seconds.
 
-    struct Node {
-        int entity_id;
-        float px;
-        float py;
-        float vx;
-        float vy;
-        float fx = 0.0f;
-        float fy = 0.0f;
+    int threads = this->threads > 0 ? this->threads : std::max<int>(std::thread::hardware_concurrency(), 1);
+    if (!this->pool || this->pool->size() != threads)
+        this->pool = std::make_unique<ThreadPool>(threads);
+    ThreadPool& pool = *this->pool;
+    const FDGKernels& kernels = *this->kernels;
+
+    auto t0 = std::chrono::steady_clock::now();
+    auto lap = [&t0]() {
+        auto t1 = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        t0 = t1;
+        return ms;
     };
 
-    //  Load vertex location and other data into a temporary workspace.
+    //  Load vertex location and other data into the workspace.
     //
-    std::vector<Node> nodes;
-    nodes.reserve(components.fdg_vertex_components.size());
+    const size_t n = components.fdg_vertex_components.size();
+    for (std::vector<float>* v : { &this->px, &this->py, &this->vx, &this->vy, &this->fx, &this->fy })
+        v->resize(n);
+    std::fill(this->fx.begin(), this->fx.end(), 0.0f);
+    std::fill(this->fy.begin(), this->fy.end(), 0.0f);
+    this->entity_ids.resize(n);
     int lc_index = 0;
-    for (const FDGVertexComponent& v : components.fdg_vertex_components) {
+    for (size_t i=0; i<n; ++i) {
+        const FDGVertexComponent& v = components.fdg_vertex_components[i];
         const LocationComponent& lc = find_location(components, v.entity_id, lc_index);
-        Node node;
-        node.entity_id = v.entity_id;
-        node.px = lc.x;
-        node.py = lc.y;
-        node.vx = v.vx;
-        node.vy = v.vy;
-        nodes.push_back(node);
+        this->entity_ids[i] = v.entity_id;
+        this->px[i] = lc.x;
+        this->py[i] = lc.y;
+        this->vx[i] = v.vx;
+        this->vy[i] = v.vy;
     }
+    this->timings.load = lap();
 
 #if 1
     //  Compute intervertex repulsion forces.
     //  Repulsion is inversely porportional to distance squared.
     //
-    for (Node& a : nodes)
-        for (Node& b : nodes)
-            if (a.entity_id != b.entity_id) {
-                float d_square = (a.px-b.px)*(a.px-b.px)+(a.py-b.py)*(a.py-b.py);
-                d_square = std::max(d_square, 0.125f);
-                float d = sqrt(d_square);
-                a.fx -= this->k_repulsion / d_square * (b.px-a.px) / d;
-                a.fy -= this->k_repulsion / d_square * (b.py-a.py) / d;
-            }
+    const float min_d_square = 0.125f;
+    if (this->theta <= 0 || n <= this->max_exact_vertices) {
+        this->timings.tree = 0;
+        pool.run(n, 64, [&](size_t begin, size_t end) {
+            for (size_t i=begin; i<end; ++i)
+                kernels.repulsion(this->px[i], this->py[i], this->px.data(), this->py.data(), nullptr, n,
+                                  this->k_repulsion, min_d_square, this->fx[i], this->fy[i]);
+        });
+    }
+    else {
+        //  Far off crowds of vertices repel as one.  O(n log n), not O(n**2).
+        this->tree.build(n, this->px.data(), this->py.data());
+        this->timings.tree = lap();
+        pool.run(this->tree.leaf_count(), 32, [&](size_t begin, size_t end) {
+            for (size_t leaf=begin; leaf<end; ++leaf)
+                this->tree.repel_leaf(leaf, this->k_repulsion, this->theta, min_d_square, kernels,
+                                      this->fx.data(), this->fy.data());
+        });
+    }
+    this->timings.repulsion = lap();
 #endif
 
 #if 1
     //  Compute intervertex attraction forces.
     //  Attration is proportional to distance.
     //
-    std::unordered_map<int, int> entity_to_node_index;
-    entity_to_node_index.reserve(nodes.size());
-    for (size_t ix=0; ix<nodes.size(); ++ix)
-        entity_to_node_index[nodes[ix].entity_id] = ix;
-    for (const FDGEdgeComponent& edge : components.fdg_edge_components) {
-        if (!entity_to_node_index.count(edge.entity_id))
-            throw std::runtime_error(std::string("FDGSystem::update(): entity ID ") + std::to_string(edge.entity_id) + " not found in entity_to_node_index");
-        if (!entity_to_node_index.count(edge.other_entity_id))
-            throw std::runtime_error(std::string("FDGSystem::update(): entity ID ") + std::to_string(edge.other_entity_id) + " not found in entity_to_node_index");
-        Node& a = nodes[entity_to_node_index[edge.entity_id]];
-        Node& b = nodes[entity_to_node_index[edge.other_entity_id]];
-        float d = sqrt((a.px-b.px)*(a.px-b.px)+(a.py-b.py)*(a.py-b.py));
-        a.fx += this->k_link_attraction * (d-edge.length) * (b.px-a.px) / d;
-        a.fy += this->k_link_attraction * (d-edge.length) * (b.py-a.py) / d;
-        b.fx += this->k_link_attraction * (d-edge.length) * (a.px-b.px) / d;
-        b.fy += this->k_link_attraction * (d-edge.length) * (a.py-b.py) / d;
+    //  Entity IDs are handed out in order from 1, so the vertices are
+    //  found by ID in a vector.
+    this->vertex_of_entity.assign(n ? *std::max_element(this->entity_ids.begin(), this->entity_ids.end()) + 1 : 0, -1);
+    for (size_t i=0; i<n; ++i)
+        this->vertex_of_entity[this->entity_ids[i]] = i;
+    auto vertex = [this](int entity_id) {
+        if (entity_id < 0 || size_t(entity_id) >= this->vertex_of_entity.size() || this->vertex_of_entity[entity_id] < 0)
+            throw std::runtime_error(std::string("FDGSystem::update(): entity ID ") + std::to_string(entity_id) + " not found in vertex_of_entity");
+        return this->vertex_of_entity[entity_id];
+    };
+    const size_t edges = components.fdg_edge_components.size();
+    this->edge_a.resize(edges);
+    this->edge_b.resize(edges);
+    this->edge_length.resize(edges);
+    this->edge_fx.resize(edges);
+    this->edge_fy.resize(edges);
+    for (size_t e=0; e<edges; ++e) {
+        const FDGEdgeComponent& edge = components.fdg_edge_components[e];
+        this->edge_a[e] = vertex(edge.entity_id);
+        this->edge_b[e] = vertex(edge.other_entity_id);
+        this->edge_length[e] = edge.length;
     }
+    pool.run(edges, 4096, [&](size_t begin, size_t end) {
+        kernels.springs(this->px.data(), this->py.data(), this->edge_a.data(), this->edge_b.data(), this->edge_length.data(),
+                        begin, end, this->k_link_attraction, this->edge_fx.data(), this->edge_fy.data());
+    });
+    //  Vertices share edges, so this part isn't split between threads.
+    for (size_t e=0; e<edges; ++e) {
+        this->fx[this->edge_a[e]] += this->edge_fx[e];
+        this->fy[this->edge_a[e]] += this->edge_fy[e];
+        this->fx[this->edge_b[e]] -= this->edge_fx[e];
+        this->fy[this->edge_b[e]] -= this->edge_fy[e];
+    }
+    this->timings.springs = lap();
 #endif
 
 #if 1
     //  Compute attraction-to-origin force.
     //  Attration is proportional to distance.
     //
-    for (Node& node : nodes) {
-        float d_square = node.px*node.px + node.py*node.py;
-        // d_square = std::max(d_square, 1.0f);
-        float d = sqrt(d_square);
-        node.fx -= this->k_origin * d * node.px;
-        node.fy -= this->k_origin * d * node.py;
-    }
-#endif
-
-#if 0
-    //  Compute a drag force acting against velocity.
-    //
-    const float kd = 50.0f; //  Drag constant.
-    for (Node& node : nodes) {
-        float speed = sqrt(node.vx*node.vx + node.vy*node.vy);
-        if (speed > 1.0f) {
-            node.fx -= node.vx / speed * kd;
-            node.fy -= node.vy / speed * kd;
-        }
-    }
-#endif
-
-#if 1
-    //  
-    //
-    for (Node& node : nodes) {
-        node.vx *= this->k_inverse_drag;
-        node.vy *= this->k_inverse_drag;
-    }
+    pool.run(n, 4096, [&](size_t begin, size_t end) {
+        kernels.origin(this->px.data(), this->py.data(), this->fx.data(), this->fy.data(), begin, end, this->k_origin);
+    });
+    this->timings.origin = lap();
 #endif
 
-    //  Apply forces to vertices and update positions.
+    //  Slow the vertices by the drag, apply forces to them, and update
+    //  positions.
     //
-    for (Node& node : nodes) {
-        float new_vx = node.vx + dt * node.fx / this->k_vertex_inertia;
-        float new_vy = node.vy + dt * node.fy / this->k_vertex_inertia;
-        node.px += (new_vx + node.vx) / 2.0f * dt;
-        node.py += (new_vy + node.vy) / 2.0f * dt;
-        node.vx = new_vx;
-        node.vy = new_vy;
-    }
+    pool.run(n, 4096, [&](size_t begin, size_t end) {
+        kernels.integrate(this->px.data(), this->py.data(), this->vx.data(), this->vy.data(), this->fx.data(), this->fy.data(),
+                          begin, end, dt, this->k_inverse_drag, this->k_vertex_inertia);
+    });
+    this->timings.integrate = lap();
 
     //  Update the location component and the FDG vertex component.
     //
-    for (size_t i=0; i<nodes.size(); ++i) {
-        components.fdg_vertex_components[i].vx = nodes[i].vx;
-        components.fdg_vertex_components[i].vy = nodes[i].vy;
+    for (size_t i=0; i<n; ++i) {
+        components.fdg_vertex_components[i].vx = this->vx[i];
+        components.fdg_vertex_components[i].vy = this->vy[i];
     }
     lc_index = 0;
-    for (Node& node : nodes) {
-        LocationComponent& lc = find_location(components, node.entity_id, lc_index);
-        lc.x = node.px;
-        lc.y = node.py;
+    for (size_t i=0; i<n; ++i) {
+        LocationComponent& lc = find_location(components, this->entity_ids[i], lc_index);
+        lc.x = this->px[i];
+        lc.y = this->py[i];
     }
+    this->timings.store = lap();
 }
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
+#include "BarnesHutTree.hpp"
+#include "FDGKernels.hpp"
 #include "System.hpp"
+#include "ThreadPool.hpp"
 
 
 //  The Force Directed Graph system alters locations of FDGVertex nodes
@@ -14,8 +20,48 @@ public:
     float k_inverse_drag = 0.99f;     // Drag reciprocal.
     float k_vertex_inertia = 0.25f;     // Vertex inertia.
 
+    //  Repulsion between more than max_exact_vertices vertices is
+    //  approximated with a Barnes-Hut tree, to accuracy theta: 0 is
+    //  exact, and larger is faster and rougher.  Fewer vertices, or a
+    //  theta of 0, are repelled exactly, pair by pair.
+    float theta = 0.7f;
+    size_t max_exact_vertices = 500;
+
+    //  Threads to lay out with, counting the render thread.  0 is one per
+    //  core.
+    int threads = 0;
+    //  The arithmetic, by default the fastest this CPU runs.
+    const FDGKernels* kernels = &FDGKernels::best();
+
+    //  Milliseconds the last update() spent on each pass.
+    struct Timings {
+        double load = 0;
+        double tree = 0;       //  Building the Barnes-Hut tree.
+        double repulsion = 0;
+        double springs = 0;
+        double origin = 0;
+        double integrate = 0;  //  Drag, and moving the vertices.
+        double store = 0;
+    };
+    const Timings& get_timings() const { return this->timings; }
+
     void init() {}
     void update(Components& components);
 
 private:
+    //  The vertices' workspace, reused from frame to frame.  It's a
+    //  structure of arrays, so passes over it vectorize.  Vertex i is
+    //  components.fdg_vertex_components[i].
+    std::vector<int> entity_ids;
+    std::vector<float> px, py, vx, vy, fx, fy;
+    //  Maps entity IDs to vertices, or -1.
+    std::vector<int> vertex_of_entity;
+    //  The edges, as the vertices at each end.
+    std::vector<int> edge_a, edge_b;
+    std::vector<float> edge_length;
+    std::vector<float> edge_fx, edge_fy;
+
+    BarnesHutTree tree;
+    std::unique_ptr<ThreadPool> pool;
+    Timings timings;
 };
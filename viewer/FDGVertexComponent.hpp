@@ -7,5 +7,5 @@ struct FDGVertexComponent {
     int entity_id;
     float vx, vy; // velocity
 
-    FDGVertexComponent(int id) : vx(0), vy(0) {};
+    FDGVertexComponent(int id) : entity_id(id), vx(0), vy(0) {};
 };
@@ -91,6 +91,9 @@ void KeyboardSystem::update(Components& components, FDGSystem& fdg, DisplaySyste
                     case Parameter::FDG_INERTIA:
                         std::cout << (fdg.k_vertex_inertia *= factor);
                         break;
+                    case Parameter::FDG_THETA:
+                        std::cout << (fdg.theta *= factor);
+                        break;
                     case Parameter::LIGHTING_DIFFUSE:
                         display.set_diffuse(display.get_diffuse() * factor);
                         std::cout << display.get_diffuse();
@@ -172,6 +175,7 @@ const char* KeyboardSystem::to_s(Parameter p)
         case Parameter::FDG_ORIGIN:          return "FDG_ORIGIN";
         case Parameter::FDG_DRAG:            return "FDG_DRAG";
         case Parameter::FDG_INERTIA:         return "FDG_INERTIA";
+        case Parameter::FDG_THETA:           return "FDG_THETA";
         case Parameter::LIGHTING_DIFFUSE:    return "LIGHTING_DIFFUSE";
         case Parameter::LIGHTING_AMBIENT:    return "LIGHTING_AMBIENT";
         case Parameter::NONE:                return "NONE";
@@ -22,6 +22,7 @@ private:
         FDG_ORIGIN,
         FDG_DRAG,
         FDG_INERTIA,
+        FDG_THETA,
         LIGHTING_DIFFUSE,
         LIGHTING_AMBIENT,
         NONE, // Must be last.
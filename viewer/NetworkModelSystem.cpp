@@ -1,17 +1,22 @@
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 #include <string>
 #include <regex>
 #include <stdexcept>
 
+#include <arpa/inet.h>
 #include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 #include <glad/glad.h>
 
 #include "stb_image.h"
 
-#include "EventSerialization.hpp"
 #include "Entities.hpp"
 #include "Components.hpp"
 
@@ -20,7 +25,34 @@
 
 constexpr float scatter_factor = 2.0f;
 
+//  Resolvers whose median response takes this latency bucket or slower
+//  (see resolver.proto) are shown as slow.  Bucket 8 is 128ms.
+constexpr int slow_resolver_bucket = 8;
+
 namespace {
+    //  Returns a descriptor connected to the Unix socket at :path:, or -1
+    //  with errno set.
+    int connect_unix_socket(const std::string& path)
+    {
+        struct sockaddr_un address = {};
+        if (path.size() >= sizeof(address.sun_path)) {
+            errno = ENAMETOOLONG;
+            return -1;
+        }
+        address.sun_family = AF_UNIX;
+        memcpy(address.sun_path, path.c_str(), path.size());
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0)
+            return -1;
+        if (connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address))) {
+            int saved_errno = errno;
+            close(fd);
+            errno = saved_errno;
+            return -1;
+        }
+        return fd;
+    }
+
     struct TextureMatch {
         std::regex regex;
         unsigned int texture;
@@ -98,6 +130,11 @@ static std::string bytes_to_mac(const std::string& bytes)
 
 static std::string bytes_to_ip_address(const std::string& bytes)
 {
+    if (bytes.size() == 16) {
+        char text[INET6_ADDRSTRLEN];
+        inet_ntop(AF_INET6, bytes.data(), text, sizeof(text));
+        return text;
+    }
     std::stringstream sstream;
     bool first = true;
     for (char c : bytes) {
@@ -126,12 +163,26 @@ static bool is_rfc1918(const std::string& bytes)
 
 void NetworkModelSystem::receive(Components& components, const Lansnoop::Network& network)
 {
-    if (!network_to_entity_ids.count(network.id())) {
+    if (network.merged_into()) {
+        //  Move the merged network's interfaces to the network it was merged into.
+        int from_entity_id = this->network_to_entity_ids.at(network.id());
+        int to_entity_id = this->network_to_entity_ids.at(network.merged_into());
+        for (FDGEdgeComponent& edge : components.fdg_edge_components)
+            if (edge.other_entity_id == from_entity_id)
+                edge.other_entity_id = to_entity_id;
+        for (InterfaceEdgeComponent& edge : components.interface_edge_components)
+            if (edge.other_entity_id == from_entity_id)
+                edge.other_entity_id = to_entity_id;
+        this->network_to_entity_ids[network.id()] = to_entity_id;
+    }
+    else if (!network_to_entity_ids.count(network.id())) {
         int entity_id = generate_entity_id();
         std::string description("network ");
         description += std::to_string(network.id());
+        if (network.vlan())
+            description += " VLAN " + std::to_string(network.vlan());
         components.description_components.push_back(DescriptionComponent(entity_id, description));
-        components.label_components.push_back(LabelComponent(entity_id, std::string("network ") + std::to_string(network.id())));
+        components.label_components.push_back(LabelComponent(entity_id, description));
         components.location_components.push_back(LocationComponent(entity_id, 2*rng(), 2*rng(), 1.0f));
         // components.shape_components.push_back(ShapeComponent(entity_id, ShapeComponent::Shape::CYLINDER));
         components.fdg_vertex_components.push_back(FDGVertexComponent(entity_id));
@@ -180,6 +231,22 @@ void NetworkModelSystem::receive(Components& components, const Lansnoop::Interfa
 
 void NetworkModelSystem::receive(Components& components, const Lansnoop::Traffic& traffic)
 {
+    //  The compact form carries the packets since the previous Traffic
+    //  event, with delta coded IDs.
+    auto glow = [&](const Lansnoop::TrafficDeltas& deltas, const std::unordered_map<int, int>& to_entity_ids) {
+        long id = 0;
+        for (int i=0; i<deltas.ids_size(); ++i) {
+            id += deltas.ids(i);
+            long entity_id = to_entity_ids.at(id);
+            InterfaceEdgeComponent& iec = components.get(entity_id, components.interface_edge_components);
+            iec.glow += deltas.packets(i);
+        }
+    };
+    glow(traffic.interfaces(), this->interface_to_entity_ids);
+    glow(traffic.clouds(), this->cloud_to_entity_ids);
+    glow(traffic.ipaddresses(), this->ipaddress_to_entity_ids);
+
+    //  The map form, from snoop --traffic-maps, carries whole counts.
     for (const auto [id, count] : traffic.interface_packet_counts()) {
         long dp = count - this->interface_packet_counts[id];
         this->interface_packet_counts[id] = count;
@@ -313,6 +380,9 @@ void NetworkModelSystem::receive(Components& components, const Lansnoop::IPAddre
         if (ipaddress.ns_name().size())
             new_labels.push_back(ipaddress.ns_name());
         new_labels.push_back(bytes_to_ip_address(ipaddress.address()));
+        auto resolver = this->resolvers.find(ipaddress.id());
+        if (resolver != this->resolvers.end())
+            new_labels.push_back(resolver->second.label);
         if (l.labels != new_labels) {
             l.labels = new_labels;
             l.fade = 2.f;
@@ -405,46 +475,150 @@ void NetworkModelSystem::init()
 }
 
 
-void NetworkModelSystem::update(Components& components)
+void NetworkModelSystem::receive(Components& components, const Lansnoop::Resolver& resolver)
 {
-    Lansnoop::Event event;
-    while (read_event_nb(in, event)) {
-        switch (event.type_case()) {
+    auto it = this->ipaddress_to_entity_ids.find(resolver.ipaddress_id());
+    if (it == this->ipaddress_to_entity_ids.end())
+        throw std::invalid_argument("receive(Resolver): IP address not found");
+    int entity_id = it->second;
+    ShapeComponent& shape = components.get(entity_id, components.shape_components);
+    auto [state, is_new] = this->resolvers.try_emplace(resolver.ipaddress_id());
+    if (is_new)
+        state->second.color = shape.color;
+
+    //  Median latency bucket.
+    long total = 0;
+    for (auto count : resolver.latency_counts())
+        total += count;
+    int median = 0;
+    long seen = 0;
+    for (; median < resolver.latency_counts_size(); ++median) {
+        seen += resolver.latency_counts(median);
+        if (2 * seen >= total)
+            break;
+    }
 
-            case Lansnoop::Event::kNetwork:
-                receive(components, event.network());
-                break;
+    std::ostringstream label;
+    label << "DNS";
+    if (total) {
+        if (median == 0)
+            label << " <1ms";
+        else if (median == resolver.latency_counts_size() - 1)
+            label << " >" << (1L << (median - 1)) << "ms";
+        else
+            label << " " << (1L << (median - 1)) << "-" << (1L << median) << "ms";
+    }
+    if (resolver.timeouts())
+        label << ", " << resolver.timeouts() << " timeouts";
 
-            case Lansnoop::Event::kInterface:
-                receive(components, event.interface());
-                break;
+    bool timing_out = long(resolver.timeouts()) > state->second.timeouts;
+    bool slow = total && median >= slow_resolver_bucket;
+    shape.color = (timing_out || slow) ? glm::vec3(1.0, 0.2, 0.2) : state->second.color;
+    state->second.timeouts = resolver.timeouts();
 
-            case Lansnoop::Event::kTraffic:
-                receive(components, event.traffic());
-                break;
+    if (label.str() != state->second.label) {
+        state->second.label = label.str();
+        LabelComponent& l = components.get(entity_id, components.label_components);
+        //  The resolver's label is always the last, after the address.
+        if (!is_new)
+            l.labels.pop_back();
+        l.labels.push_back(state->second.label);
+        l.fade = 2.f;
+    }
+}
 
-            case Lansnoop::Event::kIpaddress:
-                receive(components, event.ipaddress());
-                break;
 
-            case Lansnoop::Event::kCloud:
-                receive(components, event.cloud());
-                break;
+void NetworkModelSystem::receive(Components& components, const Lansnoop::Event& event)
+{
+    switch (event.type_case()) {
 
-            case Lansnoop::Event::TYPE_NOT_SET:
-            // default:
-                break;
-        }
+        case Lansnoop::Event::kNetwork:
+            receive(components, event.network());
+            break;
+
+        case Lansnoop::Event::kInterface:
+            receive(components, event.interface());
+            break;
+
+        case Lansnoop::Event::kTraffic:
+            receive(components, event.traffic());
+            break;
+
+        case Lansnoop::Event::kIpaddress:
+            receive(components, event.ipaddress());
+            break;
+
+        case Lansnoop::Event::kCloud:
+            receive(components, event.cloud());
+            break;
+
+        case Lansnoop::Event::kResolver:
+            receive(components, event.resolver());
+            break;
+
+        case Lansnoop::Event::kConnection:
+            //  Not drawn.  There may be far more connections than entities to draw them with.
+            break;
+
+        case Lansnoop::Event::TYPE_NOT_SET:
+        // default:
+            break;
+    }
+}
+
+
+void NetworkModelSystem::update(Components& components)
+{
+    if (!this->feed)
+        return;
+
+    //  The feed's thread has done the reading and parsing.  Apply what it
+    //  has queued, but only for so long: a backlog, as when snoop starts
+    //  or a crowd of new hosts turns up, drains over several frames.
+    //  Always apply one, so a budget too small for any still makes way.
+    auto deadline = std::chrono::steady_clock::now() + this->time_budget;
+    while (const Lansnoop::Event* event = this->feed->front()) {
+        receive(components, *event);
+        this->feed->pop();
+        if (std::chrono::steady_clock::now() >= deadline)
+            break;
+    }
+
+    if (this->feed->done()) {
+        //  The picture stays up, but there's nothing more to read.  Any
+        //  part of an event left over is dropped.
+        this->feed.reset();
+        close(this->fd);
+        this->fd = -1;
     }
 
     // components.describe_entities();
 }
 
 
+NetworkModelSystem::~NetworkModelSystem()
+{
+    this->feed.reset();
+    if (this->fd >= 0)
+        close(this->fd);
+}
+
+
 void NetworkModelSystem::open(const std::string& path)
 {
-    this->in.open(path, std::ifstream::binary);
-    if (!in.good())
-        throw std::invalid_argument("NetworkModelSystem: unable to open input path");
-    fcntl(0, F_SETFL, fcntl(0, F_GETFL) | O_NONBLOCK);
+    int fd;
+    if (path == "-")
+        fd = dup(0);
+    else {
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0 && errno == ENXIO)
+            fd = connect_unix_socket(path);
+    }
+    if (fd < 0)
+        throw std::invalid_argument("NetworkModelSystem: unable to open input path " + path + ": " + strerror(errno));
+    this->feed.reset();
+    if (this->fd >= 0)
+        close(this->fd);
+    this->fd = fd;
+    this->feed = std::make_unique<EventFeed>(fd);
 }
@@ -1,9 +1,14 @@
 #pragma once
 
-#include <fstream>
+#include <chrono>
+#include <memory>
+#include <string>
 #include <unordered_map>
 
+#include <glm/glm.hpp>
+
 #include "event.pb.h"
+#include "EventFeed.hpp"
 #include "System.hpp"
 
 
@@ -12,13 +17,22 @@
 //
 class NetworkModelSystem : public System {
 public:
+    ~NetworkModelSystem();
     void init();
     void update(Components& components);
 
+    //  Read events from :path:, a file, a FIFO, or a Unix socket to
+    //  connect to.  "-" is standard input, whatever it is.
     void open(const std::string& path);
 
+    //  How long update() may spend applying events each frame.  Whatever
+    //  doesn't fit waits for the next frame.
+    void set_time_budget(std::chrono::microseconds budget) { this->time_budget = budget; }
+
 private:
-    std::ifstream in;
+    int fd = -1;
+    std::unique_ptr<EventFeed> feed;
+    std::chrono::microseconds time_budget { 4000 };
 
     //  Maps snooper IDs to entity IDs.
     std::unordered_map<int, int> network_to_entity_ids;
@@ -26,14 +40,24 @@ private:
     std::unordered_map<int, int> ipaddress_to_entity_ids;
     std::unordered_map<int, int> cloud_to_entity_ids;
 
-    //  Map snooper object ID's to packet counts.
+    //  Map snooper object ID's to packet counts, from Traffic events in the map form.
     std::unordered_map<int, long> interface_packet_counts;
     std::unordered_map<int, long> cloud_packet_counts;
     std::unordered_map<int, long> ipaddress_packet_counts;
 
+    //  DNS resolvers, by snooper IP address ID.
+    struct ResolverState {
+        std::string label;    //  Shown under the address's other labels.
+        long timeouts = 0;
+        glm::vec3 color;      //  The address's usual color, shown while the resolver is healthy.
+    };
+    std::unordered_map<int, ResolverState> resolvers;
+
+    void receive(Components&, const Lansnoop::Event&);
     void receive(Components&, const Lansnoop::Network&);
     void receive(Components&, const Lansnoop::Interface&);
     void receive(Components&, const Lansnoop::Traffic&);
     void receive(Components&, const Lansnoop::IPAddress&);
     void receive(Components&, const Lansnoop::Cloud&);
+    void receive(Components&, const Lansnoop::Resolver&);
 };
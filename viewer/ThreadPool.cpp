@@ -0,0 +1,83 @@
+#include <algorithm>
+
+#include "ThreadPool.hpp"
+
+
+ThreadPool::ThreadPool(int threads)
+{
+    for (int i=1; i<threads; ++i)
+        this->workers.emplace_back(&ThreadPool::work, this);
+}
+
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->start.notify_all();
+    for (std::thread& worker : this->workers)
+        worker.join();
+}
+
+
+void ThreadPool::run(size_t n, size_t grain, const std::function<void(size_t, size_t)>& f)
+{
+    grain = std::max<size_t>(grain, 1);
+    if (this->workers.empty() || n <= grain) {
+        if (n)
+            f(0, n);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->job = &f;
+        this->job_n = n;
+        //  Several parts per thread, for balance.
+        this->job_part = std::max(grain, n / (8 * size()));
+        this->next.store(0);
+        this->working = this->workers.size();
+        ++this->generation;
+    }
+    this->start.notify_all();
+
+    take_parts();
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->finished.wait(lock, [this] { return this->working == 0; });
+    this->job = nullptr;
+}
+
+
+void ThreadPool::take_parts()
+{
+    for (;;) {
+        size_t begin = this->next.fetch_add(this->job_part);
+        if (begin >= this->job_n)
+            return;
+        (*this->job)(begin, std::min(begin + this->job_part, this->job_n));
+    }
+}
+
+
+void ThreadPool::work()
+{
+    long seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->start.wait(lock, [&] { return this->stopping || this->generation != seen; });
+            if (this->stopping)
+                return;
+            seen = this->generation;
+        }
+
+        take_parts();
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (--this->working == 0)
+            this->finished.notify_one();
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+//  A fixed set of threads for splitting loops between them and the
+//  calling thread.  One loop runs at a time, from one calling thread.
+//
+class ThreadPool
+{
+public:
+    //  :threads: counts the calling thread, so 1 starts none.
+    explicit ThreadPool(int threads);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return this->workers.size() + 1; }
+
+    //  Call :f:(begin, end) on consecutive parts of [0, :n:), together
+    //  covering it, in parallel, and return once all calls have.  Parts
+    //  are handed out as threads come free, so uneven ones balance out,
+    //  and are at least :grain: long, so tiny ones don't cost more to hand
+    //  out than to do.
+    void run(size_t n, size_t grain, const std::function<void(size_t, size_t)>& f);
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable finished;
+    long generation = 0;  // Counts loops, so workers can tell a new one.
+    int working = 0;      // Workers not yet done with this loop.
+    bool stopping = false;
+
+    //  The current loop.
+    const std::function<void(size_t, size_t)>* job = nullptr;
+    size_t job_n = 0;
+    size_t job_part = 0;
+    std::atomic<size_t> next { 0 };
+
+    void work();
+    void take_parts();
+};
@@ -0,0 +1,211 @@
+//  Microbenchmarks for viewer internals.
+//  Run "bench" with no arguments for a list.
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Components.hpp"
+#include "FDGSystem.hpp"
+
+
+using Clock = std::chrono::steady_clock;
+
+static double seconds_since(Clock::time_point t0)
+{
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+
+//  A graph shaped like a big capture: a few dozen interfaces on a LAN, and
+//  :vertices: in all, most of them remote addresses hanging off the router,
+//  scattered over a disc as new vertices are.
+//
+static Components layout_graph(int vertices)
+{
+    Components components;
+    uint64_t seed = 1;
+    auto random = [&seed]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return float(seed >> 40) / float(1 << 24);
+    };
+    const int interfaces = std::min(vertices, 32);
+    const float radius = 2 * std::sqrt(float(vertices));
+    for (int i=0; i<vertices; ++i) {
+        int entity_id = i + 1;
+        float r = radius * std::sqrt(random());
+        float a = 2 * float(M_PI) * random();
+        components.location_components.push_back(LocationComponent(entity_id, r * std::cos(a), r * std::sin(a), 0));
+        components.fdg_vertex_components.push_back(FDGVertexComponent(entity_id));
+        if (i == 0)
+            continue;
+        if (i < interfaces)
+            components.fdg_edge_components.push_back(FDGEdgeComponent(entity_id, 1, 10.f));
+        else
+            components.fdg_edge_components.push_back(FDGEdgeComponent(entity_id, 1 + i % interfaces));
+    }
+    return components;
+}
+
+
+//  Time layout steps of graphs of each size, exactly and with Barnes-Hut,
+//  and report how far Barnes-Hut's repulsion strays from the exact one.
+//
+static void bench_layout(int argc, char** argv)
+{
+    int steps = argc > 0 ? std::atoi(argv[0]) : 10;
+    float theta = argc > 1 ? std::atof(argv[1]) : FDGSystem().theta;
+    std::vector<int> sizes;
+    for (int i=2; i<argc; ++i)
+        sizes.push_back(std::atoi(argv[i]));
+    if (sizes.empty())
+        sizes = { 1000, 10000, 100000 };
+    //  Beyond this, exact steps take too long to wait for.
+    const int max_exact = 20000;
+
+    for (int vertices : sizes) {
+        const Components start = layout_graph(vertices);
+
+        //  One step from the start, by repulsion alone, to compare the two.
+        auto displacements = [&](float theta) {
+            FDGSystem fdg;
+            fdg.theta = theta;
+            fdg.max_exact_vertices = 0;
+            fdg.k_link_attraction = 0;
+            fdg.k_origin = 0;
+            Components components = start;
+            fdg.update(components);
+            std::vector<float> d;
+            for (size_t i=0; i<components.location_components.size(); ++i) {
+                d.push_back(components.location_components[i].x - start.location_components[i].x);
+                d.push_back(components.location_components[i].y - start.location_components[i].y);
+            }
+            return d;
+        };
+        auto time_steps = [&](FDGSystem& fdg) {
+            Components components = start;
+            auto t0 = Clock::now();
+            for (int s=0; s<steps; ++s)
+                fdg.update(components);
+            return seconds_since(t0) / steps;
+        };
+
+        FDGSystem barnes_hut;
+        barnes_hut.theta = theta;
+        barnes_hut.max_exact_vertices = 0;
+        double barnes_hut_seconds = time_steps(barnes_hut);
+        std::cerr << "layout: " << vertices << " vertices, Barnes-Hut (theta " << theta << "): "
+                  << barnes_hut_seconds * 1e3 << " ms per step";
+
+        if (vertices <= max_exact) {
+            FDGSystem exact;
+            exact.theta = 0;
+            double exact_seconds = time_steps(exact);
+            std::vector<float> a = displacements(0);
+            std::vector<float> b = displacements(theta);
+            double error = 0, norm = 0;
+            for (size_t i=0; i<a.size(); i+=2) {
+                error += (a[i]-b[i])*(a[i]-b[i]) + (a[i+1]-b[i+1])*(a[i+1]-b[i+1]);
+                norm += a[i]*a[i] + a[i+1]*a[i+1];
+            }
+            std::cerr << ", exact: " << exact_seconds * 1e3 << " ms per step, "
+                      << exact_seconds / barnes_hut_seconds << " times slower; "
+                      << "repulsion error " << 100 * std::sqrt(error / norm) << "%";
+        }
+        std::cerr << "\n";
+    }
+}
+
+
+//  Time each pass of layout steps of graphs of each size, with each set of
+//  kernels on one thread, then with the fastest on :threads:.
+//
+static void bench_passes(int argc, char** argv)
+{
+    int steps = argc > 0 ? std::atoi(argv[0]) : 10;
+    int threads = argc > 1 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+    float theta = argc > 2 ? std::atof(argv[2]) : FDGSystem().theta;
+    std::vector<int> sizes;
+    for (int i=3; i<argc; ++i)
+        sizes.push_back(std::atoi(argv[i]));
+    if (sizes.empty())
+        sizes = { 1000, 10000, 100000 };
+
+    for (int vertices : sizes) {
+        const Components start = layout_graph(vertices);
+        std::vector<std::pair<const FDGKernels*, int>> runs;
+        for (const FDGKernels* kernels : FDGKernels::available())
+            runs.push_back({ kernels, 1 });
+        if (threads > 1)
+            runs.push_back({ &FDGKernels::best(), threads });
+
+        for (const auto& [kernels, run_threads] : runs) {
+            FDGSystem fdg;
+            fdg.theta = theta;
+            fdg.kernels = kernels;
+            fdg.threads = run_threads;
+            Components components = start;
+            fdg.update(components);  //  Warm up.
+
+            FDGSystem::Timings sum;
+            for (int s=0; s<steps; ++s) {
+                fdg.update(components);
+                const FDGSystem::Timings& t = fdg.get_timings();
+                sum.load += t.load;
+                sum.tree += t.tree;
+                sum.repulsion += t.repulsion;
+                sum.springs += t.springs;
+                sum.origin += t.origin;
+                sum.integrate += t.integrate;
+                sum.store += t.store;
+            }
+            double total = sum.load + sum.tree + sum.repulsion + sum.springs + sum.origin + sum.integrate + sum.store;
+            std::cerr << "passes: " << vertices << " vertices, " << kernels->name << ", " << run_threads
+                      << (run_threads == 1 ? " thread" : " threads") << ", ms per step:"
+                      << " load " << sum.load / steps
+                      << " tree " << sum.tree / steps
+                      << " repulsion " << sum.repulsion / steps
+                      << " springs " << sum.springs / steps
+                      << " origin " << sum.origin / steps
+                      << " integrate " << sum.integrate / steps
+                      << " store " << sum.store / steps
+                      << " total " << total / steps << "\n";
+        }
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    const std::map<std::string, void (*)(int, char**)> benchmarks {
+        { "layout", bench_layout },
+        { "passes", bench_passes },
+    };
+
+    if (argc < 2 || !benchmarks.count(argv[1])) {
+        std::cerr << "Usage: " << argv[0] << " benchmark [args]\n";
+        std::cerr << "Benchmarks:\n";
+        std::cerr << "  layout [steps] [theta] [vertices...]\n";
+        std::cerr << "                         Milliseconds per force directed layout step, exact and Barnes-Hut, and the\n";
+        std::cerr << "                         Barnes-Hut repulsion's error.  Graphs of 1k, 10k and 100k vertices by default.\n";
+        std::cerr << "  passes [steps] [threads] [theta] [vertices...]\n";
+        std::cerr << "                         Milliseconds per layout step in each pass, with each set of kernels on one\n";
+        std::cerr << "                         thread, then the fastest on all cores.  A theta of 0 repels exactly.\n";
+        return 1;
+    }
+
+    try {
+        benchmarks.at(argv[1])(argc - 2, argv + 2);
+    }
+    catch (const std::exception& e) {
+        std::cerr << argv[0] << ": " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,6 +1,9 @@
 #include <unistd.h>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 #include <sys/time.h>
 
 #include "Components.hpp"
@@ -16,6 +19,7 @@
 class Viewer {
 public:
     void open(const std::string& path);
+    void set_time_budget(std::chrono::microseconds budget) { network_model_system.set_time_budget(budget); }
     void run(const char*);
 
 private:
@@ -86,7 +90,16 @@ int main(int argc, char **argv)
 
         int i = 1;
         while (i < argc) {
-            viewer.open(argv[i++]);
+            std::string arg = argv[i++];
+            if (arg == "--budget" && i < argc) {
+                //  Milliseconds per frame to spend applying events.
+                double ms = atof(argv[i++]);
+                if (!(ms > 0))
+                    throw std::invalid_argument("--budget takes a positive number of milliseconds");
+                viewer.set_time_budget(std::chrono::microseconds(long(ms * 1000)));
+            }
+            else
+                viewer.open(arg);
         }
 
         viewer.run(argv[0]);